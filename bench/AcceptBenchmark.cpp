@@ -0,0 +1,156 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            AcceptBenchmark.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Measures the cost of accepting connections on loopback:
+//                  through the listener alone, where it also checks that the
+//                  accept path does not touch the heap once the listener's
+//                  request pool has warmed up, and through a BlockingServer.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "AllocationCounter.h"
+#include "Loopback.h"
+
+#include <Networking/BlockingServer.h>
+#include <Networking/DelegatorMT.h>
+#include <Networking/DelegatorSTSP.h>
+#include <Networking/DelegatorWS.h>
+#include <Networking/Interfaces/IDelegator.h>
+#include <Networking/Interfaces/IRequest.h>
+#include <Networking/NetworkAddress.h>
+#include <Networking/NetworkHost.h>
+#include <Networking/PeerAddress.h>
+#include <Networking/TCP/TCPListener.h>
+
+#include <benchmark/benchmark.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+using Listener = Networking::TCP::TCPListener<Networking::NetworkAddress>;
+
+// Connect, accept, handle and release one connection per iteration. Only the
+// listener's side of the exchange is counted against the allocation budget.
+// The handler takes the Peer type, which must not cost an allocation either.
+template<class HostType, class Peer>
+static void BM_AcceptSteadyState(benchmark::State& state)
+{
+  using SteadyListener = Networking::TCP::TCPListener
+    <HostType, std::function<void(unsigned int, const Peer&)>>;
+  SteadyListener listener = typename SteadyListener::Builder{}
+    .setListeningAddress(HostType{"127.0.0.1", 0})
+    .setBacklogSize(128)
+    .setBlocking(true)
+    .setUserHandler([](unsigned int, const Peer&) {})
+    .build();
+  const unsigned short port = Loopback::getBoundPort
+    (listener.getDescriptor());
+
+  // Warm the request pool.
+  for (int i = 0; i < 16; ++i)
+    {
+      int client = Loopback::connectTo(port);
+      listener.listen()->handle();
+      ::close(client);
+    }
+
+  std::size_t counted = 0;
+  for (auto _ : state)
+    {
+      int client = Loopback::connectTo(port);
+
+      const std::size_t before = AllocationCounter::getAllocations();
+      {
+        auto request = listener.listen();
+        request->handle();
+      }
+      counted += AllocationCounter::getAllocations() - before;
+
+      ::close(client);
+    }
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["allocs_per_conn"] = benchmark::Counter
+    (static_cast<double>(counted), benchmark::Counter::kAvgIterations);
+  if (0 != counted)
+    {
+      state.SkipWithError(("accept path allocated " + std::to_string(counted)
+                           + " times in steady state").c_str());
+    }
+}
+BENCHMARK_TEMPLATE(BM_AcceptSteadyState, Networking::NetworkAddress,
+                   Networking::NetworkAddress);
+BENCHMARK_TEMPLATE(BM_AcceptSteadyState, Networking::NetworkHost,
+                   Networking::PeerAddress);
+
+enum DelegatorKind
+  {
+    STSP,
+    MT,
+    WS
+  };
+
+static std::unique_ptr<Networking::Interfaces::IDelegator>
+makeDelegator(DelegatorKind kind)
+{
+  switch (kind)
+    {
+    case MT:
+      return std::make_unique<Networking::DelegatorMT>();
+    case WS:
+      return std::make_unique<Networking::DelegatorWS>();
+    default:
+      return std::make_unique<Networking::DelegatorSTSP>();
+    }
+}
+
+// Connections per second, from connect() until the client has read the byte
+// the handler writes.
+static void BM_BlockingServerConnections(benchmark::State& state)
+{
+  auto listener = std::make_unique<Listener>
+    (Listener::Builder{}
+     .setListeningAddress(Networking::NetworkAddress{"127.0.0.1", 0})
+     .setBacklogSize(128)
+     .setUserHandler([](unsigned int socket,
+                        const Networking::NetworkAddress&)
+       {
+         const char byte = 0;
+         (void)!::send(socket, &byte, sizeof(byte), MSG_NOSIGNAL);
+       })
+     .build());
+  const unsigned short port = Loopback::getBoundPort
+    (listener->getDescriptor());
+
+  Networking::BlockingServer server
+    {makeDelegator(static_cast<DelegatorKind>(state.range(0))),
+     std::move(listener)};
+  std::thread serverThread{[&server]() { server.start(); }};
+
+  for (auto _ : state)
+    {
+      int client = Loopback::connectTo(port);
+      char byte;
+      Loopback::readAll(client, &byte, sizeof(byte));
+      ::close(client);
+    }
+
+  server.stop();
+  serverThread.join();
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BlockingServerConnections)
+->ArgName("delegator")->Arg(STSP)->Arg(MT)->Arg(WS)
+->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
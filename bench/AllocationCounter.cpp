@@ -0,0 +1,67 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            AllocationCounter.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Replacements for the global operator new and delete, which
+//                  keep the counts reported by AllocationCounter.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <malloc.h>
+
+static std::atomic<std::size_t> allocations{0};
+static std::atomic<std::size_t> liveBytes{0};
+
+// The replacements below pair malloc with free, which GCC cannot see once
+// they are inlined into their callers.
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+void* operator new(std::size_t size)
+{
+  void* memory = std::malloc(0 == size ? 1 : size);
+  if (nullptr == memory)
+    {
+      throw std::bad_alloc{};
+    }
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  liveBytes.fetch_add(::malloc_usable_size(memory),
+                      std::memory_order_relaxed);
+  return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+  if (nullptr != memory)
+    {
+      liveBytes.fetch_sub(::malloc_usable_size(memory),
+                          std::memory_order_relaxed);
+      std::free(memory);
+    }
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+  operator delete(memory);
+}
+
+std::size_t AllocationCounter::getAllocations()
+{
+  return allocations.load(std::memory_order_relaxed);
+}
+
+std::size_t AllocationCounter::getLiveBytes()
+{
+  return liveBytes.load(std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
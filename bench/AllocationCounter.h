@@ -0,0 +1,29 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            AllocationCounter.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Counts calls to the global operator new, and the bytes
+//                  they hold, across the whole benchmark process.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_ALLOCATIONCOUNTER__
+#define __ET_ALLOCATIONCOUNTER__
+
+#include <cstddef>
+
+namespace AllocationCounter
+{
+  // Calls to operator new since the program started.
+  std::size_t getAllocations();
+  // Bytes currently allocated through operator new.
+  std::size_t getLiveBytes();
+};
+
+#endif // __ET_ALLOCATIONCOUNTER__
+
+///////////////////////////////////////////////////////////////////////////////
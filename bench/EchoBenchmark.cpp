@@ -0,0 +1,229 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            EchoBenchmark.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Measures echo round-trip latency, and the memory held per
+//                  idle connection, against a NonBlockingServer on loopback.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "AllocationCounter.h"
+#include "Loopback.h"
+
+#include <Networking/EventLoop.h>
+#include <Networking/NetworkAddress.h>
+#include <Networking/NonBlockingServer.h>
+#include <Networking/TCP/TCPListener.h>
+
+#include <benchmark/benchmark.h>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Listener = Networking::TCP::TCPListener<Networking::NetworkAddress>;
+
+// An echo server, as in examples/EchoServer.cpp, running on its own thread.
+class EchoServer
+{
+public:
+  explicit EchoServer(Networking::EventLoop::Engine engine)
+  {
+    auto listener = std::make_unique<Listener>
+      (Listener::Builder{}
+       .setListeningAddress(Networking::NetworkAddress{"127.0.0.1", 0})
+       .setBacklogSize(1024)
+       .setBlocking(false)
+       .setUserHandler([](unsigned int socket,
+                          const Networking::NetworkAddress&)
+         {
+           using Networking::EventLoop;
+           const int fd = socket;
+           EventLoop::current()->receive
+             (fd, [fd](const char* data, ssize_t length)
+              {
+                if (0 < length)
+                  {
+                    EventLoop::current()->send(fd, data, length);
+                  }
+                else
+                  {
+                    EventLoop::current()->remove(fd);
+                  }
+              });
+         })
+       .build());
+    m_port = Loopback::getBoundPort(listener->getDescriptor());
+    m_server = std::make_unique<Networking::NonBlockingServer>
+      (std::move(listener), engine);
+    m_thread = std::thread{[this]() { m_server->start(); }};
+  }
+
+  ~EchoServer()
+  {
+    m_server->stop();
+    m_thread.join();
+  }
+
+  unsigned short getPort() const { return m_port; }
+
+  // Waits (for up to ten seconds) until the server holds count connections.
+  bool waitForConnections(std::size_t count) const
+  {
+    for (int i = 0; i < 10000; ++i)
+      {
+        if (count == m_server->getStatistics().connections)
+          {
+            return true;
+          }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+      }
+    return false;
+  }
+
+private:
+  unsigned short m_port;
+  std::unique_ptr<Networking::NonBlockingServer> m_server;
+  std::thread m_thread;
+};
+
+static double percentile(const std::vector<double>& sorted, double fraction)
+{
+  if (sorted.empty())
+    {
+      return 0;
+    }
+  const std::size_t index = static_cast<std::size_t>
+    (fraction * (sorted.size() - 1));
+  return sorted[index];
+}
+
+// One round trip of state.range(1) bytes per iteration, on one connection.
+// Latencies are reported in microseconds.
+static void BM_EchoLatency(benchmark::State& state)
+{
+  EchoServer server{static_cast<Networking::EventLoop::Engine>
+      (state.range(0))};
+  const std::size_t payloadSize = state.range(1);
+  std::vector<char> payload(payloadSize, 'x');
+  std::vector<char> reply(payloadSize);
+
+  int client = Loopback::connectTo(server.getPort());
+  std::vector<double> latencies;
+  latencies.reserve(1 << 20);
+  for (auto _ : state)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      Loopback::writeAll(client, payload.data(), payload.size());
+      Loopback::readAll(client, reply.data(), reply.size());
+      const auto end = std::chrono::steady_clock::now();
+      latencies.push_back(std::chrono::duration<double, std::micro>
+                          (end - start).count());
+    }
+  ::close(client);
+
+  std::sort(latencies.begin(), latencies.end());
+  state.counters["p50_us"] = percentile(latencies, 0.50);
+  state.counters["p90_us"] = percentile(latencies, 0.90);
+  state.counters["p99_us"] = percentile(latencies, 0.99);
+  state.counters["p999_us"] = percentile(latencies, 0.999);
+  state.counters["max_us"] = latencies.empty() ? 0 : latencies.back();
+  state.SetBytesProcessed(2 * state.iterations() * payloadSize);
+}
+BENCHMARK(BM_EchoLatency)
+->ArgNames({"engine", "bytes"})
+->ArgsProduct({{Networking::EventLoop::EPOLL,
+                Networking::EventLoop::IO_URING}, {64, 4096}})
+->UseRealTime();
+
+// Resident set size of the process, from /proc.
+static std::size_t getResidentBytes()
+{
+  std::ifstream statm{"/proc/self/statm"};
+  std::size_t size = 0;
+  std::size_t resident = 0;
+  statm >> size >> resident;
+  return resident * ::sysconf(_SC_PAGESIZE);
+}
+
+// Opens state.range(1) connections and leaves them idle. Reports the heap
+// (operator new) and resident memory they cost the server, per connection.
+// Socket buffers are kernel memory, and are not counted.
+static void BM_IdleConnectionMemory(benchmark::State& state)
+{
+  const std::size_t connections = state.range(1);
+  struct rlimit limit;
+  if (0 == ::getrlimit(RLIMIT_NOFILE, &limit)
+      && limit.rlim_cur < 2 * connections + 64)
+    {
+      limit.rlim_cur = std::min<rlim_t>(limit.rlim_max,
+                                        2 * connections + 64);
+      ::setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+  for (auto _ : state)
+    {
+      EchoServer server{static_cast<Networking::EventLoop::Engine>
+          (state.range(0))};
+
+      // Let the server settle, so its own start-up is not counted.
+      int warmup = Loopback::connectTo(server.getPort());
+      server.waitForConnections(1);
+      ::close(warmup);
+      server.waitForConnections(0);
+
+      const std::size_t heapBefore = AllocationCounter::getLiveBytes();
+      const std::size_t residentBefore = getResidentBytes();
+
+      std::vector<int> clients;
+      clients.reserve(connections);
+      try
+        {
+          for (std::size_t i = 0; i < connections; ++i)
+            {
+              clients.push_back(Loopback::connectTo(server.getPort()));
+            }
+        }
+      catch (const std::exception& e)
+        {
+          state.SkipWithError(e.what());
+        }
+
+      if (!server.waitForConnections(clients.size()))
+        {
+          state.SkipWithError("server did not accept every connection");
+        }
+      const std::size_t heapAfter = AllocationCounter::getLiveBytes();
+      const std::size_t residentAfter = getResidentBytes();
+
+      for (int client : clients)
+        {
+          ::close(client);
+        }
+
+      const double count = std::max<std::size_t>(1, clients.size());
+      state.counters["heap_bytes_per_conn"]
+        = (static_cast<double>(heapAfter) - heapBefore) / count;
+      state.counters["rss_bytes_per_conn"]
+        = (static_cast<double>(residentAfter) - residentBefore) / count;
+    }
+}
+BENCHMARK(BM_IdleConnectionMemory)
+->ArgNames({"engine", "connections"})
+->ArgsProduct({{Networking::EventLoop::EPOLL,
+                Networking::EventLoop::IO_URING}, {1000}})
+->Iterations(1)
+->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,193 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            Loopback.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the loopback helpers.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "Loopback.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/obj_mac.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+
+unsigned short Loopback::getBoundPort(int socket)
+{
+  struct sockaddr_in address;
+  socklen_t length = sizeof(address);
+  if (-1 == ::getsockname(socket, reinterpret_cast<struct sockaddr*>
+                          (&address), &length))
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+  return ntohs(address.sin_port);
+}
+
+int Loopback::connectTo(unsigned short port)
+{
+  int client = ::socket(PF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (-1 == client)
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+
+  int noDelay = 1;
+  ::setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+  struct sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (-1 == ::connect(client, reinterpret_cast<struct sockaddr*>(&address),
+                      sizeof(address)))
+    {
+      const int error = errno;
+      ::close(client);
+      throw std::system_error{error, std::generic_category()};
+    }
+  return client;
+}
+
+void Loopback::writeAll(int socket, const void* data, std::size_t length)
+{
+  const char* bytes = static_cast<const char*>(data);
+  while (0 < length)
+    {
+      const ssize_t written = ::send(socket, bytes, length, MSG_NOSIGNAL);
+      if (0 > written)
+        {
+          if (EINTR == errno)
+            {
+              continue;
+            }
+          throw std::system_error{errno, std::generic_category()};
+        }
+      bytes += written;
+      length -= written;
+    }
+}
+
+void Loopback::readAll(int socket, void* data, std::size_t length)
+{
+  char* bytes = static_cast<char*>(data);
+  while (0 < length)
+    {
+      const ssize_t received = ::recv(socket, bytes, length, 0);
+      if (0 > received)
+        {
+          if (EINTR == errno)
+            {
+              continue;
+            }
+          throw std::system_error{errno, std::generic_category()};
+        }
+      else if (0 == received)
+        {
+          throw std::runtime_error{"Loopback: connection closed by peer"};
+        }
+      bytes += received;
+      length -= received;
+    }
+}
+
+static void writePEM(const std::string& path,
+                     const std::function<int(FILE*)>& write)
+{
+  std::unique_ptr<FILE, int(*)(FILE*)> file{std::fopen(path.c_str(), "w"),
+                                            std::fclose};
+  if (!file || 1 != write(file.get()))
+    {
+      throw std::runtime_error{"Loopback: could not write " + path};
+    }
+}
+
+Loopback::Certificate Loopback::createCertificate()
+{
+  // A P-256 key keeps the handshake cheap enough that the benchmark
+  // measures the library, not the RSA private key operation.
+  std::unique_ptr<EVP_PKEY_CTX, void(*)(EVP_PKEY_CTX*)> context
+    {EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr), EVP_PKEY_CTX_free};
+  EVP_PKEY* rawKey = nullptr;
+  if (!context || 0 >= EVP_PKEY_keygen_init(context.get())
+      || 0 >= EVP_PKEY_CTX_set_ec_paramgen_curve_nid
+      (context.get(), NID_X9_62_prime256v1)
+      || 0 >= EVP_PKEY_keygen(context.get(), &rawKey))
+    {
+      throw std::runtime_error{"Loopback: could not generate a key"};
+    }
+  std::unique_ptr<EVP_PKEY, void(*)(EVP_PKEY*)> key{rawKey, EVP_PKEY_free};
+
+  std::unique_ptr<X509, void(*)(X509*)> certificate{X509_new(), X509_free};
+  if (!certificate)
+    {
+      throw std::runtime_error{"Loopback: could not create a certificate"};
+    }
+  X509_set_version(certificate.get(), 2);
+  ASN1_INTEGER_set(X509_get_serialNumber(certificate.get()), 1);
+  X509_gmtime_adj(X509_getm_notBefore(certificate.get()), 0);
+  X509_gmtime_adj(X509_getm_notAfter(certificate.get()), 24 * 60 * 60);
+  X509_set_pubkey(certificate.get(), key.get());
+  X509_NAME* name = X509_get_subject_name(certificate.get());
+  X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+                             reinterpret_cast<const unsigned char*>
+                             ("localhost"), -1, -1, 0);
+  X509_set_issuer_name(certificate.get(), name);
+  if (0 >= X509_sign(certificate.get(), key.get(), EVP_sha256()))
+    {
+      throw std::runtime_error{"Loopback: could not sign the certificate"};
+    }
+
+  char directory[] = "/tmp/networking_bench.XXXXXX";
+  if (nullptr == ::mkdtemp(directory))
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+
+  Certificate paths{directory, std::string{directory} + "/cert.pem",
+                    std::string{directory} + "/key.pem"};
+  try
+    {
+      writePEM(paths.certificateFile, [&certificate](FILE* file)
+               { return PEM_write_X509(file, certificate.get()); });
+      writePEM(paths.privateKeyFile, [&key](FILE* file)
+               {
+                 return PEM_write_PrivateKey(file, key.get(), nullptr,
+                                             nullptr, 0, nullptr, nullptr);
+               });
+    }
+  catch (...)
+    {
+      removeCertificate(paths);
+      throw;
+    }
+  return paths;
+}
+
+void Loopback::removeCertificate(const Certificate& paths)
+{
+  ::unlink(paths.certificateFile.c_str());
+  ::unlink(paths.privateKeyFile.c_str());
+  ::rmdir(paths.directory.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,47 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            Loopback.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Helpers shared by the benchmarks for talking to a server
+//                  on the loopback interface.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_LOOPBACK__
+#define __ET_LOOPBACK__
+
+#include <cstddef>
+#include <string>
+
+namespace Loopback
+{
+  // The port a listening socket was bound to (e.g. when bound to port 0).
+  unsigned short getBoundPort(int socket);
+
+  // Opens a blocking connection to 127.0.0.1:port, with Nagle disabled.
+  int connectTo(unsigned short port);
+
+  // Loop until all length bytes have been written/read. Throw on error or
+  // end of stream.
+  void writeAll(int socket, const void* data, std::size_t length);
+  void readAll(int socket, void* data, std::size_t length);
+
+  // Writes a self-signed certificate and its private key into a temporary
+  // directory, returning the paths. removeCertificate() deletes them.
+  struct Certificate
+  {
+    std::string directory;
+    std::string certificateFile;
+    std::string privateKeyFile;
+  };
+  Certificate createCertificate();
+  void removeCertificate(const Certificate&);
+};
+
+#endif // __ET_LOOPBACK__
+
+///////////////////////////////////////////////////////////////////////////////
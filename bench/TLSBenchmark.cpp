@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSBenchmark.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Measures TLS handshakes per second through a TLSListener
+//                  served by a BlockingServer on loopback, with and without
+//                  session resumption.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "Loopback.h"
+
+#include <Networking/BlockingServer.h>
+#include <Networking/DelegatorSTSP.h>
+#include <Networking/NetworkAddress.h>
+#include <Networking/TCP/TLSListener.h>
+
+#include <benchmark/benchmark.h>
+
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+
+#include <unistd.h>
+
+#include <memory>
+#include <thread>
+
+using Listener = Networking::TCP::TLSListener<Networking::NetworkAddress>;
+
+// A TLSListener, behind a BlockingServer running on its own thread.
+class TLSServer
+{
+public:
+  // If tickets is false, resumption goes through the session cache.
+  explicit TLSServer(bool tickets)
+  {
+    const Loopback::Certificate certificate = Loopback::createCertificate();
+    std::unique_ptr<Listener> listener;
+    try
+      {
+        listener = std::make_unique<Listener>
+          (Listener::Builder{}
+           .setListeningAddress(Networking::NetworkAddress{"127.0.0.1", 0})
+           .setBacklogSize(128)
+           .setCertificateFile(certificate.certificateFile)
+           .setPrivateKeyFile(certificate.privateKeyFile)
+           .setSessionTickets(tickets)
+           .setUserHandler([](SSL* ssl, const Networking::NetworkAddress&)
+             {
+               const char byte = 0;
+               SSL_write(ssl, &byte, sizeof(byte));
+             })
+           .build());
+      }
+    catch (...)
+      {
+        Loopback::removeCertificate(certificate);
+        throw;
+      }
+    Loopback::removeCertificate(certificate);
+
+    m_port = Loopback::getBoundPort(listener->getDescriptor());
+    m_listener = listener.get();
+    m_server = std::make_unique<Networking::BlockingServer>
+      (std::make_unique<Networking::DelegatorSTSP>(), std::move(listener));
+    m_thread = std::thread{[this]() { m_server->start(); }};
+  }
+
+  ~TLSServer()
+  {
+    m_server->stop();
+    m_thread.join();
+  }
+
+  unsigned short getPort() const { return m_port; }
+  Listener::SessionStatistics getSessionStatistics() const
+  { return m_listener->getSessionStatistics(); }
+
+private:
+  unsigned short m_port;
+  Listener* m_listener;
+  std::unique_ptr<Networking::BlockingServer> m_server;
+  std::thread m_thread;
+};
+
+// Connects, resuming session if it is not null, and reads the byte the
+// handler writes. Returns the session to resume next time, or null on error.
+static SSL_SESSION* handshake(SSL_CTX* context, unsigned short port,
+                              SSL_SESSION* session)
+{
+  int client = Loopback::connectTo(port);
+  std::unique_ptr<SSL, void(*)(SSL*)> ssl{SSL_new(context), SSL_free};
+  SSL_set_fd(ssl.get(), client);
+  if (nullptr != session)
+    {
+      SSL_set_session(ssl.get(), session);
+    }
+
+  SSL_SESSION* next = nullptr;
+  char byte;
+  // TLS 1.3 tickets arrive after the handshake, so read before asking for
+  // the session.
+  if (0 < SSL_connect(ssl.get())
+      && 0 < SSL_read(ssl.get(), &byte, sizeof(byte)))
+    {
+      next = SSL_get1_session(ssl.get());
+      SSL_shutdown(ssl.get());
+    }
+  ERR_clear_error();
+  ::close(client);
+  return next;
+}
+
+// A full handshake per iteration, ending once the client has read the byte
+// the handler writes. The client does not resume sessions.
+static void BM_TLSHandshake(benchmark::State& state)
+{
+  TLSServer server{true};
+  std::unique_ptr<SSL_CTX, void(*)(SSL_CTX*)> context
+    {SSL_CTX_new(TLS_client_method()), SSL_CTX_free};
+  SSL_CTX_set_session_cache_mode(context.get(), SSL_SESS_CACHE_OFF);
+
+  for (auto _ : state)
+    {
+      SSL_SESSION* session = handshake(context.get(), server.getPort(),
+                                       nullptr);
+      if (nullptr == session)
+        {
+          state.SkipWithError("TLS handshake failed");
+          break;
+        }
+      SSL_SESSION_free(session);
+    }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TLSHandshake)->UseRealTime();
+
+// As above, but the client resumes the session from its previous
+// connection, through a ticket or through the server's session cache.
+static void BM_TLSResumedHandshake(benchmark::State& state)
+{
+  TLSServer server{0 != state.range(0)};
+  std::unique_ptr<SSL_CTX, void(*)(SSL_CTX*)> context
+    {SSL_CTX_new(TLS_client_method()), SSL_CTX_free};
+  SSL_CTX_set_session_cache_mode(context.get(), SSL_SESS_CACHE_CLIENT);
+
+  SSL_SESSION* session = handshake(context.get(), server.getPort(), nullptr);
+  for (auto _ : state)
+    {
+      SSL_SESSION* next = handshake(context.get(), server.getPort(),
+                                    session);
+      SSL_SESSION_free(session);
+      session = next;
+      if (nullptr == session)
+        {
+          state.SkipWithError("TLS handshake failed");
+          break;
+        }
+    }
+  SSL_SESSION_free(session);
+
+  const Listener::SessionStatistics statistics
+    = server.getSessionStatistics();
+  const double total = statistics.fullHandshakes
+    + statistics.resumedHandshakes;
+  state.counters["resumed_ratio"] = 0 == total ? 0
+    : statistics.resumedHandshakes / total;
+  state.counters["cache_hits"] = statistics.cache.hits;
+  state.counters["ticket_rejected"] = statistics.tickets.rejected;
+  state.counters["ticket_issued"] = statistics.tickets.issued;
+  state.counters["ticket_hits"] = statistics.tickets.accepted
+    + statistics.tickets.renewed;
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TLSResumedHandshake)
+->ArgName("tickets")->Arg(0)->Arg(1)
+->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
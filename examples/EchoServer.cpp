@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            EchoServer.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Example of using the NonBlockingServer to serve many
+//                  connections from a single thread.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/EventLoop.h>
+#include <Networking/NetworkAddress.h>
+#include <Networking/NonBlockingServer.h>
+#include <Networking/TCP/TCPListener.h>
+
+#include <iostream>
+#include <memory>
+
+#include <sys/types.h>
+
+int main()
+{
+  using namespace Networking;
+  using namespace Networking::TCP;
+
+  // Called on the loop's thread whenever a connection is accepted. Sockets
+  // accepted by a non-blocking listener are themselves non-blocking.
+  auto closure = [](unsigned int socket, const NetworkAddress& client)
+    {
+      std::cout << "Received connection from " << client.string() << "\n";
+      int fd = socket;
+
+      // Registering the socket keeps the connection open after we return.
+      // The loop reads the socket for us, and writes what we send once the
+      // round of callbacks is over.
+      EventLoop::current()->receive(fd, [fd](const char* data, ssize_t length)
+        {
+          if (0 < length)
+            {
+              EventLoop::current()->send(fd, data, length);
+            }
+          else
+            {
+              // End of stream or error. Closes the connection.
+              EventLoop::current()->remove(fd);
+            }
+        });
+    };
+
+  auto listener = TCPListener<NetworkAddress>::Builder()
+    .setListeningAddress(NetworkAddress{"127.0.0.1", 13001})
+    .setBlocking(false)
+    .setUserHandler(closure)
+    .build();
+  // Uses epoll instead if the kernel does not support io_uring.
+  NonBlockingServer server{std::make_unique<TCPListener<NetworkAddress>>
+      (std::move(listener)), EventLoop::IO_URING};
+  server.start();
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,29 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            Affinity.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Utility for binding workers to CPUs.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_AFFINITY__
+#define __ET_AFFINITY__
+
+#include <namespaces/Networking.h>
+
+namespace Networking
+{
+  // Binds the calling thread to the index'th CPU that the process may run
+  // on, wrapping around if index exceeds the number of such CPUs. Throws
+  // std::system_error on failure, and std::logic_error if the platform does
+  // not support CPU affinity.
+  void pinToCpu(unsigned int index);
+};
+
+#endif // __ET_AFFINITY__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -8,7 +8,7 @@
 //
 // CREATED:         04/02/2020
 //
-// LAST EDITED:     04/02/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_BLOCKINGSERVER__
@@ -18,6 +18,7 @@
 
 #include <Networking/Interfaces/IServer.h>
 
+#include <atomic>
 #include <memory>
 
 class Networking::BlockingServer : public Networking::Interfaces::IServer
@@ -26,11 +27,20 @@ public:
   BlockingServer(std::unique_ptr<Interfaces::IDelegator>,
                  std::unique_ptr<Interfaces::IListener>);
 
+  // Accepts and dispatches connections on the calling thread until stop()
+  // is called.
   virtual void start() final override;
 
+  // May be called from any thread. Shuts down the listening socket to wake
+  // start(), so the server cannot be started again.
+  void stop();
+
 private:
-  std::unique_ptr<Interfaces::IDelegator> m_delegator;
+  // Declared first, so destroyed last: requests still queued when the
+  // delegator is destroyed refer to the listener's handler and timeouts.
   std::unique_ptr<Interfaces::IListener> m_listener;
+  std::unique_ptr<Interfaces::IDelegator> m_delegator;
+  std::atomic<bool> m_stopping;
 };
 
 #endif // __ET_BLOCKINGSERVER__
@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            DelegatorMP.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     This delegator pre-forks a number of worker processes,
+//                  each of which runs the server's accept loop and handles
+//                  its requests in its own address space. The original
+//                  process becomes a supervisor that respawns workers which
+//                  crash. Since prepare() calls fork(), this delegator must
+//                  be used before any other threads have been started.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_DELEGATORMP__
+#define __ET_DELEGATORMP__
+
+#include <namespaces/Networking.h>
+
+#include <Networking/FileDescriptor.h>
+#include <Networking/Interfaces/IDelegator.h>
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+class Networking::DelegatorMP : public Networking::Interfaces::IDelegator
+{
+public:
+  using ListenerFactory
+  = std::function<std::unique_ptr<Interfaces::IListener>()>;
+
+  // A numWorkers of 0 selects one worker per hardware thread. If pinWorkers
+  // is set, worker i is bound to the i'th CPU the process may run on.
+  //
+  // By default, every worker accepts on the listener given to the server,
+  // which it inherits from the supervisor. If a listenerFactory is given,
+  // that listener is closed instead and each worker builds its own with the
+  // factory. The factory should build listeners with setReusePort(true), so
+  // that the kernel shards incoming connections across the workers.
+  DelegatorMP(unsigned int numWorkers = 0, bool pinWorkers = false,
+              ListenerFactory listenerFactory = nullptr,
+              // By default, simply send error messages to cerr.
+              std::function<void(const std::string&)> logStream
+              =[](const std::string& message)
+                {
+                  std::cerr << message << '\n';
+                });
+
+  // In the supervisor, does not return until every worker has exited
+  // normally, and then returns false. In the workers, returns true.
+  virtual bool prepare(std::unique_ptr<Interfaces::IListener>&)
+    final override;
+
+  virtual void dispatch(std::unique_ptr<Interfaces::IRequest>) final override;
+
+private:
+  pid_t spawn(unsigned int index, std::unique_ptr<Interfaces::IListener>&);
+  // Waits for one of the workers to exit, and returns its index. Other
+  // children of the process are left for their owners to reap.
+  unsigned int reap(int& status);
+
+  unsigned int m_numWorkers;
+  const bool m_pinWorkers;
+  ListenerFactory m_listenerFactory;
+  std::function<void(const std::string&)> m_logStream;
+
+  // Indexed by worker number; 0 once the worker has exited for good.
+  std::vector<pid_t> m_workers;
+  // A pidfd for each worker, readable once it exits; -1 where the kernel
+  // has no pidfd_open(2).
+  std::vector<FileDescriptor> m_exits;
+};
+
+#endif // __ET_DELEGATORMP__
+
+///////////////////////////////////////////////////////////////////////////////
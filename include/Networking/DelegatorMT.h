@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            DelegatorMT.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     This delegator dispatches the user handler on one of a
+//                  fixed pool of worker threads. Requests are handed to the
+//                  workers through a bounded queue.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_DELEGATORMT__
+#define __ET_DELEGATORMT__
+
+#include <namespaces/Networking.h>
+
+#include <Networking/Interfaces/IDelegator.h>
+
+#include <condition_variable>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class Networking::DelegatorMT : public Networking::Interfaces::IDelegator
+{
+public:
+  // What dispatch() does when the queue is full.
+  enum QueueFullPolicy
+    {
+      BLOCK,      // Wait until a worker frees a slot in the queue.
+      REJECT,     // Drop the request, which closes the connection.
+      RUN_INLINE  // Handle the request on the dispatching thread.
+    };
+
+  // A poolSize of 0 selects one worker per hardware thread.
+  DelegatorMT(unsigned int poolSize = 0, unsigned int queueSize = 64,
+              QueueFullPolicy policy = QueueFullPolicy::BLOCK,
+              // By default, simply send error messages to cerr.
+              std::function<void(const std::string&)> logStream
+              =[](const std::string& message)
+                {
+                  std::cerr << message << '\n';
+                });
+  DelegatorMT(const DelegatorMT&) = delete;
+  DelegatorMT& operator=(const DelegatorMT&) = delete;
+
+  // Requests that are still queued are handled before the workers exit.
+  virtual ~DelegatorMT();
+
+  virtual void dispatch(std::unique_ptr<Interfaces::IRequest>) final override;
+
+private:
+  void work();
+  void handle(std::unique_ptr<Interfaces::IRequest>) const;
+
+  const QueueFullPolicy m_policy;
+  std::function<void(const std::string&)> m_logStream;
+
+  // Ring buffer of pending requests, protected by m_mutex.
+  std::vector<std::unique_ptr<Interfaces::IRequest>> m_queue;
+  std::size_t m_head;
+  std::size_t m_count;
+  bool m_stopping;
+
+  std::mutex m_mutex;
+  std::condition_variable m_notEmpty;
+  std::condition_variable m_notFull;
+  std::vector<std::thread> m_workers;
+};
+
+#endif // __ET_DELEGATORMT__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            DelegatorWS.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     This delegator dispatches the user handler on a pool of
+//                  worker threads, each of which owns a lock-free queue of
+//                  requests. Workers that run out of work steal requests from
+//                  the queues of busy workers, so one slow request only holds
+//                  up its own worker.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_DELEGATORWS__
+#define __ET_DELEGATORWS__
+
+#include <namespaces/Networking.h>
+
+#include <Networking/Interfaces/IDelegator.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class Networking::DelegatorWS : public Networking::Interfaces::IDelegator
+{
+public:
+  struct WorkerStatistics
+  {
+    std::size_t queueDepth;  // Requests waiting in this worker's queue
+    std::uint64_t handled;   // Requests handled by this worker
+    std::uint64_t steals;    // Requests this worker took from other workers
+  };
+
+  // A poolSize of 0 selects one worker per hardware thread. queueSize is the
+  // capacity of each worker's queue, and is rounded up to a power of two.
+  // When every queue is full, dispatch() handles the request inline.
+  DelegatorWS(unsigned int poolSize = 0, unsigned int queueSize = 256,
+              // By default, simply send error messages to cerr.
+              std::function<void(const std::string&)> logStream
+              =[](const std::string& message)
+                {
+                  std::cerr << message << '\n';
+                });
+  DelegatorWS(const DelegatorWS&) = delete;
+  DelegatorWS& operator=(const DelegatorWS&) = delete;
+
+  // Requests that are still queued are handled before the workers exit.
+  virtual ~DelegatorWS();
+
+  virtual void dispatch(std::unique_ptr<Interfaces::IRequest>) final override;
+
+  std::vector<WorkerStatistics> getStatistics() const;
+
+private:
+  class RequestQueue;
+  struct Worker;
+
+  void work(std::size_t index);
+  Interfaces::IRequest* steal(std::size_t thief);
+  bool hasWork() const;
+  void handle(std::unique_ptr<Interfaces::IRequest>) const;
+
+  std::function<void(const std::string&)> m_logStream;
+  std::vector<std::unique_ptr<Worker>> m_workers;
+
+  // Serializes producers, so that each queue has a single producer. This is
+  // uncontended when a single server thread is dispatching.
+  std::mutex m_dispatchMutex;
+  std::size_t m_nextWorker;
+
+  // Idle workers park on m_wakeup; m_sleepers lets dispatch() skip the
+  // notification when every worker is busy.
+  std::mutex m_mutex;
+  std::condition_variable m_wakeup;
+  std::atomic<unsigned int> m_sleepers;
+  bool m_stopping;
+};
+
+#endif // __ET_DELEGATORWS__
+
+///////////////////////////////////////////////////////////////////////////////
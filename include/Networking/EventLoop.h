@@ -0,0 +1,175 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            EventLoop.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Edge-triggered I/O reactor. File descriptors are
+//                  registered with a callback, which the loop invokes with
+//                  the set of events that occurred whenever the descriptor
+//                  becomes ready. The loop waits on either epoll or io_uring.
+//                  The loop also keeps timers, and deadlines for idle
+//                  connections. Registration is not thread-safe; only
+//                  stop() and size() may be called from another thread.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_EVENTLOOP__
+#define __ET_EVENTLOOP__
+
+#include <namespaces/Networking.h>
+
+#include <Networking/TimerWheel.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+class Networking::EventLoop
+{
+public:
+  enum Event : unsigned int
+    {
+      READABLE = 1 << 0,
+      WRITABLE = 1 << 1,
+      HANGUP = 1 << 2,      // Delivered whether or not it was requested
+      ERROR = 1 << 3        // Delivered whether or not it was requested
+    };
+
+  // The kernel interface the loop waits on.
+  enum Engine
+    {
+      EPOLL,
+      // Multishot accept and receive into a ring of kernel-selected buffers,
+      // and one system call per round for all sends. Falls back to EPOLL if
+      // the kernel does not support it (Linux 5.19 or later is required).
+      IO_URING
+    };
+
+  using Callback = std::function<void(unsigned int events)>;
+
+  // Called with each chunk of data received, with a length of 0 at the end
+  // of the stream, or with a negative errno on error. The data is only valid
+  // for the duration of the call.
+  using ReceiveCallback = std::function<void(const char* data,
+                                             ssize_t length)>;
+
+  // Called with each socket accepted (which is non-blocking and owned by the
+  // callee), or with a negative errno on error.
+  using AcceptCallback = std::function<void(int socket)>;
+
+  EventLoop(Engine engine = Engine::EPOLL,
+            unsigned int maxEventsPerWait = 256,
+            // By default, simply send error messages to cerr.
+            std::function<void(const std::string&)> logStream
+            =[](const std::string& message)
+              {
+                std::cerr << message << '\n';
+              });
+  EventLoop(const EventLoop&) = delete;
+  EventLoop& operator=(const EventLoop&) = delete;
+  ~EventLoop();
+
+  // The engine actually in use, which may differ from the one requested.
+  Engine getEngine() const;
+
+  // Since notification is edge-triggered, a callback must read (or write)
+  // until the call would block, or it will not be invoked again. If a
+  // callback throws, the exception is logged and the descriptor removed.
+  void add(int fd, unsigned int events, Callback callback);
+  void modify(int fd, unsigned int events);
+
+  // Alternatives to add(), for which the loop performs the I/O itself: a
+  // descriptor registered with receive() has its data delivered to the
+  // callback, and one registered with accept() (a listening socket) has its
+  // connections accepted.
+  void receive(int fd, ReceiveCallback callback);
+  void accept(int fd, AcceptCallback callback);
+
+  // Queues data to be written to a registered socket. Data queued during
+  // one round of callbacks is written once the round is over, so a number of
+  // small sends cost a single system call. Should not be mixed with writes
+  // made directly to the socket.
+  void send(int fd, const void* data, std::size_t length);
+
+  // Must be called before the descriptor is closed. The callback (and any
+  // request adopted with the descriptor) is destroyed after the current
+  // round of callbacks, so it is safe for a callback to remove itself. Data
+  // still queued by send() is written before the socket is finally closed.
+  void remove(int fd);
+  bool contains(int fd) const;
+
+  // Ties the lifetime of the request to the registration of fd, which must
+  // already have been added. Requests own their socket, so the connection is
+  // closed when the descriptor is removed.
+  void adopt(int fd, std::unique_ptr<Interfaces::IRequest> request);
+
+  // Hangs up on a registered socket once it has had no events for
+  // idleTimeout or, until it is first readable, for firstReadTimeout. The
+  // socket is shut down, and so its callback sees the end of the stream (or
+  // a HANGUP), and removes it, as if the peer had gone. A timeout of 0 is
+  // no timeout, and two zeros cancel the deadline.
+  void setIdleTimeout(int fd, std::chrono::milliseconds idleTimeout,
+                      std::chrono::milliseconds firstReadTimeout
+                      = std::chrono::milliseconds{0});
+  // Counts I/O done on a registered socket outside of its callbacks (e.g.
+  // by an AsyncStream that found data already there) against its idle
+  // deadline. READABLE in events counts as its first read.
+  void noteActivity(int fd, unsigned int events);
+
+  // Timers that are called on the loop's thread, once the round of
+  // callbacks in which they fall due is over. runOnce() waits no longer
+  // than until the next one.
+  TimerWheel& getTimers();
+
+  // Number of descriptors currently registered.
+  std::size_t size() const;
+
+  // Run until stop() is called.
+  void run();
+  // Wait at most timeoutMilliseconds (-1 to wait forever) for one round of
+  // events, and dispatch them. Returns the number of events dispatched.
+  unsigned int runOnce(int timeoutMilliseconds);
+  void stop();
+
+  // The loop that is dispatching callbacks on the calling thread, or nullptr
+  static EventLoop* current();
+
+  class Backend;
+
+private:
+  struct Registration;
+  struct Idle;
+
+  Registration* find(int fd) const;
+  Registration* find(std::uint64_t token) const;
+  Registration& insert(int fd);
+  void ready(std::uint64_t token, unsigned int events);
+  void received(std::uint64_t token, const char* data, ssize_t length);
+  void accepted(std::uint64_t token, int socket);
+  void failed(std::uint64_t token, const std::exception&);
+  void expire(Registration& registration);
+
+  std::function<void(const std::string&)> m_logStream;
+  TimerWheel m_timers;
+  std::unique_ptr<Backend> m_backend;
+  std::vector<std::unique_ptr<Registration>> m_registrations; // by fd
+  std::vector<std::unique_ptr<Registration>> m_removed;
+  std::atomic<std::size_t> m_size;
+  std::uint32_t m_generation;
+  std::atomic<bool> m_stopping;
+};
+
+#endif // __ET_EVENTLOOP__
+
+///////////////////////////////////////////////////////////////////////////////
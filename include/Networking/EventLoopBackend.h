@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            EventLoopBackend.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Interface between the EventLoop and the kernel interface
+//                  it waits on. Each registration is identified to the
+//                  backend by a token, which the backend passes back with
+//                  every notification for it. A backend must drop
+//                  notifications for tokens that have been removed.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_EVENTLOOPBACKEND__
+#define __ET_EVENTLOOPBACKEND__
+
+#include <namespaces/Networking.h>
+#include <Networking/EventLoop.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+class Networking::EventLoop::Backend
+{
+public:
+  virtual ~Backend() {}
+
+  virtual Engine getEngine() const = 0;
+
+  virtual void add(int fd, std::uint64_t token, unsigned int events) = 0;
+  virtual void modify(int fd, std::uint64_t token, unsigned int events) = 0;
+  virtual void receive(int fd, std::uint64_t token) = 0;
+  virtual void accept(int fd, std::uint64_t token) = 0;
+  virtual void send(int fd, std::uint64_t token, const char* data,
+                    std::size_t length) = 0;
+  // May be called from a notification for the same token.
+  virtual void remove(int fd, std::uint64_t token) = 0;
+
+  // Waits for one round of notifications and delivers them to the loop.
+  // Returns the number of notifications delivered.
+  virtual unsigned int wait(EventLoop& loop, int timeoutMilliseconds) = 0;
+
+  // Interrupts wait(). May be called from any thread.
+  virtual void wakeup() = 0;
+
+  static std::unique_ptr<Backend>
+  createEpoll(unsigned int maxEventsPerWait,
+              std::function<void(const std::string&)> logStream);
+
+  // Returns nullptr if io_uring is not available.
+  static std::unique_ptr<Backend>
+  createUring(unsigned int entries,
+              std::function<void(const std::string&)> logStream);
+
+protected:
+  // Notifications; tokens that no longer match a registration are ignored.
+  static void ready(EventLoop& loop, std::uint64_t token, unsigned int events)
+  { loop.ready(token, events); }
+
+  static void received(EventLoop& loop, std::uint64_t token, const char* data,
+                       ssize_t length)
+  { loop.received(token, data, length); }
+
+  static void accepted(EventLoop& loop, std::uint64_t token, int socket)
+  { loop.accepted(token, socket); }
+};
+
+#endif // __ET_EVENTLOOPBACKEND__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            FileDescriptor.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Move-only owner of a file descriptor, which closes it on
+//                  destruction. Unlike a std::shared_ptr<int>, costs nothing
+//                  more than the int it wraps.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_FILEDESCRIPTOR__
+#define __ET_FILEDESCRIPTOR__
+
+#include <namespaces/Networking.h>
+
+#include <unistd.h>
+
+class Networking::FileDescriptor
+{
+public:
+  FileDescriptor() noexcept;
+  explicit FileDescriptor(int fd) noexcept;
+  FileDescriptor(FileDescriptor&&) noexcept;
+  FileDescriptor& operator=(FileDescriptor&&) noexcept;
+  FileDescriptor(const FileDescriptor&) = delete;
+  FileDescriptor& operator=(const FileDescriptor&) = delete;
+  ~FileDescriptor();
+
+  // -1 if empty.
+  int get() const noexcept;
+  explicit operator bool() const noexcept;
+
+  // Gives up ownership without closing the descriptor.
+  int release() noexcept;
+  // Closes the current descriptor, if any, and takes ownership of fd.
+  void reset(int fd = -1) noexcept;
+
+private:
+  int m_fd;
+};
+
+inline Networking::FileDescriptor::FileDescriptor() noexcept
+  : m_fd{-1}
+{}
+
+inline Networking::FileDescriptor::FileDescriptor(int fd) noexcept
+  : m_fd{fd}
+{}
+
+inline Networking::FileDescriptor
+::FileDescriptor(FileDescriptor&& that) noexcept
+  : m_fd{that.release()}
+{}
+
+inline Networking::FileDescriptor&
+Networking::FileDescriptor::operator=(FileDescriptor&& that) noexcept
+{
+  reset(that.release());
+  return *this;
+}
+
+inline Networking::FileDescriptor::~FileDescriptor()
+{
+  reset();
+}
+
+inline int Networking::FileDescriptor::get() const noexcept
+{
+  return m_fd;
+}
+
+inline Networking::FileDescriptor::operator bool() const noexcept
+{
+  return -1 != m_fd;
+}
+
+inline int Networking::FileDescriptor::release() noexcept
+{
+  const int fd = m_fd;
+  m_fd = -1;
+  return fd;
+}
+
+inline void Networking::FileDescriptor::reset(int fd) noexcept
+{
+  if (-1 != m_fd && fd != m_fd)
+    {
+      ::close(m_fd);
+    }
+  m_fd = fd;
+}
+
+#endif // __ET_FILEDESCRIPTOR__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -9,7 +9,7 @@
 //
 // CREATED:         04/02/2020
 //
-// LAST EDITED:     04/02/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_IDELEGATOR__
@@ -24,6 +24,13 @@ class Networking::Interfaces::IDelegator
 public:
   virtual ~IDelegator() {}
 
+  // Called by the server once, before it accepts the first request. A
+  // delegator may use this to set up its execution environment, and may
+  // replace the listener the server accepts from. Returns false if the
+  // calling process should not accept requests at all, in which case the
+  // server returns from start().
+  virtual bool prepare(std::unique_ptr<IListener>&) { return true; }
+
   virtual void dispatch(std::unique_ptr<IRequest>) = 0;
 };
 
@@ -8,7 +8,7 @@
 //
 // CREATED:         04/02/2020
 //
-// LAST EDITED:     04/02/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_ILISTENER__
@@ -16,14 +16,43 @@
 
 #include <namespaces/Networking.h>
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 class Networking::Interfaces::IListener
 {
 public:
   virtual ~IListener() {}
 
+  // If the listener is non-blocking, returns nullptr when no connection is
+  // pending.
   virtual std::unique_ptr<IRequest> listen() = 0;
+
+  // Accepts every pending connection, up to maxBatchSize, and appends a
+  // request for each to batch. Returns the number of requests appended. A
+  // blocking listener waits for the first connection, and then only accepts
+  // that one, since waiting for any more would stall the batch. An error
+  // accepting is thrown, and the requests appended before it are left in
+  // batch.
+  virtual std::size_t
+  listenBatch(std::vector<std::unique_ptr<IRequest>>& batch,
+              std::size_t maxBatchSize) = 0;
+
+  // Wraps a connection that was accepted on the listening socket by other
+  // means (e.g. by an EventLoop), as listen() would have. Takes ownership of
+  // the socket, and closes it if the request cannot be created.
+  virtual std::unique_ptr<IRequest> adopt(int socket) = 0;
+
+  // The listening socket, e.g. for registering with an EventLoop. A
+  // listener with several sockets (e.g. one per address of a host) gathers
+  // them in an epoll instance, which is readable when any of them is, and
+  // returns that instead.
+  virtual int getDescriptor() const = 0;
+
+  // Shuts the listening sockets down, so that a thread waiting in listen()
+  // wakes up and throws. No more connections are accepted.
+  virtual void shutdown() = 0;
 };
 
 #endif // __ET_ILISTENER__
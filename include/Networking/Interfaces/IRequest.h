@@ -8,7 +8,7 @@
 //
 // CREATED:         04/02/2020
 //
-// LAST EDITED:     04/02/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_IREQUEST__
@@ -22,6 +22,9 @@ public:
   virtual ~IRequest() {}
 
   virtual void handle() = 0;
+
+  // The connected socket owned by this request, or -1 if it has none.
+  virtual int getDescriptor() const { return -1; }
 };
 
 #endif // __ET_IREQUEST__
@@ -0,0 +1,82 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            MultiReactorServer.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of a server that runs one NonBlockingServer
+//                  per core, each on its own thread and with its own
+//                  listening socket. The listeners should share their address
+//                  with SO_REUSEPORT (see TCPListener::Builder::setReusePort)
+//                  so that the kernel balances incoming connections between
+//                  the loops. A connection stays on the loop that accepted
+//                  it for its whole lifetime.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_MULTIREACTORSERVER__
+#define __ET_MULTIREACTORSERVER__
+
+#include <namespaces/Networking.h>
+
+#include <Networking/Interfaces/IServer.h>
+#include <Networking/NonBlockingServer.h>
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Networking::MultiReactorServer : public Networking::Interfaces::IServer
+{
+public:
+  using ListenerFactory
+  = std::function<std::unique_ptr<Interfaces::IListener>()>;
+
+  enum PinningPolicy
+    {
+      NONE,         // Let the scheduler place the loops.
+      PIN_TO_CPU    // Bind loop i to the i'th CPU the process may run on.
+    };
+
+  // Builds numLoops listeners with the factory, which must produce
+  // non-blocking listeners. A numLoops of 0 selects one loop per hardware
+  // thread. Every loop waits on the given engine.
+  MultiReactorServer(ListenerFactory listenerFactory,
+                     unsigned int numLoops = 0,
+                     PinningPolicy pinningPolicy = PinningPolicy::NONE,
+                     EventLoop::Engine engine = EventLoop::EPOLL,
+                     // By default, simply send error messages to cerr.
+                     std::function<void(const std::string&)> logStream
+                     =[](const std::string& message)
+                       {
+                         std::cerr << message << '\n';
+                       });
+  MultiReactorServer(const MultiReactorServer&) = delete;
+  MultiReactorServer& operator=(const MultiReactorServer&) = delete;
+
+  // Runs the first loop on the calling thread and the others on threads of
+  // their own. Returns once every loop has been stopped.
+  virtual void start() final override;
+
+  // May be called from any thread.
+  void stop();
+
+  // Statistics for each loop, indexed like the loops. May be called from any
+  // thread.
+  std::vector<NonBlockingServer::Statistics> getStatistics() const;
+
+private:
+  void run(std::size_t index);
+
+  const PinningPolicy m_pinningPolicy;
+  std::function<void(const std::string&)> m_logStream;
+  std::vector<std::unique_ptr<NonBlockingServer>> m_loops;
+};
+
+#endif // __ET_MULTIREACTORSERVER__
+
+///////////////////////////////////////////////////////////////////////////////
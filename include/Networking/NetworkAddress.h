@@ -3,11 +3,12 @@
 //
 // AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
 //
-// DESCRIPTION:     Class for encapsulating one single address specification.
+// DESCRIPTION:     Class for encapsulating one single address specification,
+//                  IPv4 or IPv6.
 //
 // CREATED:         04/17/2020
 //
-// LAST EDITED:     05/01/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_NETWORKADDRESS__
@@ -16,6 +17,7 @@
 #include <namespaces/Networking.h>
 
 #include <netinet/in.h>
+#include <sys/socket.h>
 
 #include <string>
 
@@ -23,21 +25,34 @@ class Networking::NetworkAddress
 {
 public:
   NetworkAddress(struct sockaddr_in);
+  NetworkAddress(struct sockaddr_in6);
+  // Throws std::invalid_argument unless address is AF_INET or AF_INET6.
+  NetworkAddress(const struct sockaddr* address, socklen_t length);
   NetworkAddress(unsigned int ipHostOrder, unsigned short portHostOrder);
+  // ipAddress may be IPv4, or IPv6 with an optional zone ("fe80::1%eth0")
+  // and optional brackets ("[::1]").
   NetworkAddress(const std::string& ipAddress, unsigned short portHostOrder);
+  // The same address, with another port.
+  NetworkAddress(const NetworkAddress& address, unsigned short portHostOrder);
 
+  // AF_INET or AF_INET6.
+  int getFamily() const;
+  // Throws std::logic_error if the address is not IPv4.
   unsigned int getIPHostOrder() const;
+  // The numeric form of the IP, in either family.
   std::string getIPDotNotation() const;
   unsigned short getPortHostOrder() const;
-  const struct sockaddr_in& getSockAddr() const;  
+  const struct sockaddr* getSockAddr() const;
+  socklen_t getSockAddrLength() const;
 
+  // "(<ip>, <port>)"
   std::string string() const;
 
   bool operator==(const NetworkAddress&) const;
   bool operator!=(const NetworkAddress&) const;
 
 private:
-  struct sockaddr_in m_address;
+  struct sockaddr_storage m_address;
 };
 
 #endif // __ET_NETWORKADDRESS__
@@ -4,11 +4,14 @@
 // AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
 //
 // DESCRIPTION:     Utility class encapsulating useful logic for dealing with
-//                  inet addresses.
+//                  inet addresses. Names are resolved through the default
+//                  Resolver, so repeated lookups are answered from its
+//                  cache, and the name of a host given by address is only
+//                  looked up when it is asked for.
 //
 // CREATED:         04/04/2020
 //
-// LAST EDITED:     04/18/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_NETADDRESS__
@@ -16,7 +19,9 @@
 
 #include <namespaces/Networking.h>
 #include <Networking/NetworkAddress.h>
+#include <Networking/Resolver.h>
 
+#include <future>
 #include <iterator>
 #include <list>
 #include <string>
@@ -26,7 +31,7 @@ class Networking::NetworkHost
 public:
   NetworkHost(NetworkAddress address);
 
-  // Must be in the form "<IPv4 | IPv6 | Hostname>:<port>"
+  // Must be in the form "<IPv4 | [IPv6] | Hostname>:<port>"
   // If a hostname is given, the ctor will attempt to resolve it using DNS.
   NetworkHost(std::string hostString);
 
@@ -34,6 +39,15 @@ public:
   // If a hostname is given, the ctor will attempt to resolve it using DNS.
   NetworkHost(std::string ipOrHostname, unsigned short portHostOrder);
 
+  // Starts resolving ipOrHostname, and returns without waiting for it. The
+  // future throws if the name does not resolve.
+  static std::future<NetworkHost>
+  lookup(std::string ipOrHostname, unsigned short portHostOrder,
+         Resolver& resolver = Resolver::getDefault());
+
+  // The name the host was given by, if any. Otherwise, performs (or takes
+  // from the Resolver's cache) a reverse lookup of the first address,
+  // falling back to its numeric form.
   std::string getHostname() const;
   unsigned short getPortHostOrder() const;
   std::string string() const;
@@ -46,10 +60,14 @@ public:
   const_iterator cend() const;
 
 private:
-  void getAddresses(std::string hostname, unsigned short portHostOrder);
-  std::string nameLookup() const;
+  NetworkHost(std::string hostname, unsigned short portHostOrder,
+              const Resolver::Addresses& addresses);
+
+  void setAddresses(const Resolver::Addresses& addresses,
+                    unsigned short portHostOrder);
 
   std::list<NetworkAddress> m_addresses;
+  // Empty if the host was given by address.
   std::string m_hostname;
 };
 
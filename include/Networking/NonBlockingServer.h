@@ -0,0 +1,92 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            NonBlockingServer.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of a server that multiplexes the listening
+//                  socket and every accepted connection on one thread, using
+//                  an EventLoop. The user handler is called on the loop's
+//                  thread as soon as a connection is accepted. A handler that
+//                  wants to keep the connection registers the socket with
+//                  EventLoop::current(), and the server then keeps the
+//                  connection open until the socket is removed from the
+//                  loop. Otherwise, the connection is closed as soon as the
+//                  handler returns, as with the BlockingServer.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_NONBLOCKINGSERVER__
+#define __ET_NONBLOCKINGSERVER__
+
+#include <namespaces/Networking.h>
+
+#include <Networking/EventLoop.h>
+#include <Networking/Interfaces/IServer.h>
+#include <Networking/TimerWheel.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Networking::NonBlockingServer : public Networking::Interfaces::IServer
+{
+public:
+  struct Statistics
+  {
+    std::uint64_t accepted;    // Connections accepted since start()
+    std::uint64_t failed;      // Connections whose handler threw
+    std::size_t connections;   // Connections currently kept open
+  };
+
+  // The listener must be non-blocking. With the IO_URING engine, the loop
+  // accepts connections itself, and they reach the handler through
+  // IListener::adopt().
+  NonBlockingServer(std::unique_ptr<Interfaces::IListener>,
+                    EventLoop::Engine engine = EventLoop::EPOLL,
+                    // By default, simply send error messages to cerr.
+                    std::function<void(const std::string&)> logStream
+                    =[](const std::string& message)
+                      {
+                        std::cerr << message << '\n';
+                      });
+  NonBlockingServer(const NonBlockingServer&) = delete;
+  NonBlockingServer& operator=(const NonBlockingServer&) = delete;
+  ~NonBlockingServer();
+
+  // Runs the event loop on the calling thread until stop() is called.
+  virtual void start() final override;
+
+  // May be called from any thread.
+  void stop();
+
+  EventLoop& getEventLoop();
+
+  // May be called from any thread.
+  Statistics getStatistics() const;
+
+private:
+  void accept();
+  void adopt(int socket);
+  void handle(std::unique_ptr<Interfaces::IRequest>);
+
+  std::unique_ptr<Interfaces::IListener> m_listener;
+  std::function<void(const std::string&)> m_logStream;
+  EventLoop m_loop;
+  std::atomic<std::uint64_t> m_accepted;
+  std::atomic<std::uint64_t> m_failed;
+  std::vector<std::unique_ptr<Interfaces::IRequest>> m_batch;
+  // Accepts again after an error (e.g. EMFILE), as the connections left in
+  // the backlog will not make the listener ready a second time.
+  TimerWheel::Timer m_acceptRetry;
+};
+
+#endif // __ET_NONBLOCKINGSERVER__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            PeerAddress.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     The address of the other end of a connection, exactly as
+//                  the kernel reported it. Unlike NetworkHost, it holds the
+//                  address inline and is trivially copyable, so accepting a
+//                  connection costs no allocation; it is formatted, or its
+//                  name looked up, only when asked.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_PEERADDRESS__
+#define __ET_PEERADDRESS__
+
+#include <namespaces/Networking.h>
+#include <Networking/NetworkAddress.h>
+
+#include <string>
+#include <type_traits>
+
+#include <sys/socket.h>
+
+class Networking::PeerAddress
+{
+public:
+  // An empty address, of family AF_UNSPEC, ready to be filled in.
+  PeerAddress() noexcept;
+  PeerAddress(const struct sockaddr* address, socklen_t length) noexcept;
+  PeerAddress(const NetworkAddress& address) noexcept;
+
+  int getFamily() const noexcept;
+  const struct sockaddr* getSockAddr() const noexcept;
+  socklen_t getLength() const noexcept;
+  // For accept(2), getpeername(2) and the like to fill in. The length is
+  // that of the storage until then.
+  struct sockaddr* getSockAddr() noexcept;
+  socklen_t& getLength() noexcept;
+
+  unsigned short getPortHostOrder() const;
+  std::string getIPString() const;
+  // Reverse lookup through the default Resolver, falling back to the IP.
+  std::string getHostname() const;
+  // "(<ip>, <port>)", without a lookup.
+  std::string string() const;
+
+  // Throws std::invalid_argument if the address is not IPv4 or IPv6.
+  NetworkAddress getNetworkAddress() const;
+
+private:
+  struct sockaddr_storage m_address;
+  socklen_t m_length;
+};
+
+static_assert(std::is_trivially_copyable_v<Networking::PeerAddress>,
+              "PeerAddress must be trivially copyable");
+
+#endif // __ET_PEERADDRESS__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            RequestPool.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Pool of fixed-size blocks from which a listener allocates
+//                  its requests, so that accepting a connection does not go
+//                  to the heap once the pool has warmed up. Blocks may be
+//                  returned from any thread, and the pool is destroyed once
+//                  its owner has released it and the last block has been
+//                  returned. The requests made in the blocks refer to the
+//                  listener, though, which must outlive them.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_REQUESTPOOL__
+#define __ET_REQUESTPOOL__
+
+#include <namespaces/Networking.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class Networking::RequestPool
+{
+public:
+  // Blocks are blockSize bytes. At most maxFree returned blocks are kept
+  // for reuse; the rest go back to the heap.
+  static std::shared_ptr<RequestPool> create(std::size_t blockSize,
+                                             std::size_t maxFree = 1024);
+
+  RequestPool(const RequestPool&) = delete;
+  RequestPool& operator=(const RequestPool&) = delete;
+
+  // Throws std::bad_alloc if size exceeds the block size, or if the heap is
+  // exhausted.
+  void* allocate(std::size_t size);
+  // Returns a block to the pool it came from.
+  static void deallocate(void* block) noexcept;
+
+  std::size_t getBlockSize() const;
+
+private:
+  RequestPool(std::size_t blockSize, std::size_t maxFree);
+  ~RequestPool();
+
+  // Called by the owner in place of the destructor.
+  void release() noexcept;
+
+  const std::size_t m_blockSize;
+  const std::size_t m_maxFree;
+  std::mutex m_mutex;
+  std::vector<void*> m_free;
+  std::size_t m_outstanding;
+  bool m_released;
+};
+
+#endif // __ET_REQUESTPOOL__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            Resolver.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Asynchronous, caching DNS resolver. Lookups run on a pool
+//                  of worker threads; their results (including failures)
+//                  are cached for a time, and concurrent lookups of the same
+//                  name share a single query.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_RESOLVER__
+#define __ET_RESOLVER__
+
+#include <namespaces/Networking.h>
+#include <Networking/NetworkAddress.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class Networking::Resolver
+{
+public:
+  // Addresses of a name, with the port left 0.
+  using Addresses = std::vector<NetworkAddress>;
+  // Throws std::system_error if the name does not resolve.
+  using ForwardLookup = std::function<Addresses(const std::string&)>;
+  // Returns "" if the address has no name.
+  using ReverseLookup = std::function<std::string(const NetworkAddress&)>;
+
+  struct Statistics
+  {
+    std::uint64_t hits;          // Answered from the cache
+    std::uint64_t negativeHits;  // ...with a cached failure
+    std::uint64_t coalesced;     // Joined a lookup already in flight
+    std::uint64_t lookups;       // Sent to the workers
+    std::uint64_t evictions;     // Dropped to stay within capacity
+    std::size_t entries;
+  };
+
+  class Builder;
+
+  // forward and reverse default to getaddrinfo(3) and getnameinfo(3). They
+  // may be replaced, e.g. by a stub for testing. The workers are started by
+  // the first lookup in each process, so that a resolver used before a
+  // fork(2) (e.g. by DelegatorMP) still works in the children. Lookups in
+  // flight when the process forks are abandoned in the child.
+  Resolver(unsigned int numWorkers, std::chrono::seconds ttl,
+           std::chrono::seconds negativeTtl, std::size_t capacity,
+           ForwardLookup forward, ReverseLookup reverse);
+  Resolver(const Resolver&) = delete;
+  Resolver& operator=(const Resolver&) = delete;
+  // Waits for the lookups in flight; those not yet started are abandoned,
+  // and their futures hold std::future_error (broken_promise).
+  ~Resolver();
+
+  // The resolver used by NetworkHost.
+  static Resolver& getDefault();
+
+  // Neither blocks, unless the answer is already cached. The future throws
+  // the lookup's exception, if it failed. May be called from any thread.
+  std::shared_future<Addresses> resolve(const std::string& hostname);
+  std::shared_future<std::string> reverse(const NetworkAddress& address);
+
+  void clear();
+  Statistics getStatistics() const;
+
+  static Addresses getAddrInfo(const std::string& hostname);
+  static std::string getNameInfo(const NetworkAddress& address);
+
+private:
+  template<class T>
+  struct Entry
+  {
+    std::shared_future<T> result;
+    std::chrono::steady_clock::time_point expiry;
+    std::uint64_t id;  // Tells a lookup whether its entry is still there
+    bool pending;
+    bool failed;
+  };
+
+  template<class T>
+  using Cache = std::unordered_map<std::string, Entry<T>>;
+
+  template<class T>
+  std::shared_future<T> find(Cache<T>& cache, const std::string& key,
+                             std::function<T()> lookup);
+  template<class T>
+  void makeRoom(Cache<T>& cache, std::chrono::steady_clock::time_point now);
+  void work();
+  // Called with the lock held.
+  void startWorkers();
+
+  // Registered with pthread_atfork(3), for every resolver.
+  static void prepareFork();
+  static void parentFork();
+  static void childFork();
+
+  const unsigned int m_numWorkers;
+  const std::chrono::seconds m_ttl;
+  const std::chrono::seconds m_negativeTtl;
+  // Per cache; there is one for each direction.
+  const std::size_t m_capacity;
+  const ForwardLookup m_forward;
+  const ReverseLookup m_reverse;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_ready;
+  std::deque<std::function<void()>> m_queue;
+  bool m_stopping;
+  Cache<Addresses> m_forwardCache;
+  Cache<std::string> m_reverseCache;
+  Statistics m_statistics;
+  std::uint64_t m_nextId;
+  std::vector<std::thread> m_workers;
+};
+
+class Networking::Resolver::Builder
+{
+public:
+  Builder setNumWorkers(unsigned int);
+  Builder setTtl(std::chrono::seconds);
+  Builder setNegativeTtl(std::chrono::seconds);
+  Builder setCapacity(std::size_t);
+  Builder setForwardLookup(ForwardLookup);
+  Builder setReverseLookup(ReverseLookup);
+
+  // Returned by pointer, as the workers refer to the resolver.
+  std::unique_ptr<Resolver> build() const;
+
+private:
+  unsigned int numWorkers = 4;
+  std::chrono::seconds ttl{60};
+  std::chrono::seconds negativeTtl{5};
+  std::size_t capacity = 4096;
+  ForwardLookup forward = getAddrInfo;
+  ReverseLookup reverse = getNameInfo;
+};
+
+#endif // __ET_RESOLVER__
+
+///////////////////////////////////////////////////////////////////////////////
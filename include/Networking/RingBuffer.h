@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            RingBuffer.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Byte queue of fixed capacity, whose memory is mapped
+//                  twice in succession, so that both the data it holds and
+//                  the room it has left are always contiguous, however they
+//                  wrap around the end of the buffer. Data can then be read
+//                  into it, and parsed out of it, in place.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_RINGBUFFER__
+#define __ET_RINGBUFFER__
+
+#include <namespaces/Networking.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+class Networking::RingBuffer
+{
+public:
+  // The capacity is rounded up to a multiple of the page size. Throws
+  // std::system_error if the memory cannot be mapped.
+  explicit RingBuffer(std::size_t capacity);
+  RingBuffer(RingBuffer&&) noexcept;
+  RingBuffer& operator=(RingBuffer&&) = delete;
+  RingBuffer(const RingBuffer&) = delete;
+  RingBuffer& operator=(const RingBuffer&) = delete;
+  ~RingBuffer();
+
+  std::size_t getCapacity() const;
+  // Bytes held, and bytes of room left.
+  std::size_t size() const;
+  std::size_t space() const;
+
+  // The data held, in order.
+  std::string_view data() const;
+  void consume(std::size_t length);
+
+  // The room left, space() bytes long. Data written there is added to the
+  // buffer by commit().
+  char* getWritePointer();
+  void commit(std::size_t length);
+
+private:
+  char* m_memory;
+  std::size_t m_capacity;
+  // Offsets of the first byte held and of the first byte of room, which
+  // only ever increase: the difference is the size.
+  std::uint64_t m_head;
+  std::uint64_t m_tail;
+};
+
+#endif // __ET_RINGBUFFER__
+
+///////////////////////////////////////////////////////////////////////////////
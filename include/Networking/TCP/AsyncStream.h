@@ -0,0 +1,217 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            AsyncStream.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Reads and writes on a connection, plain or TLS, which a
+//                  coroutine awaits rather than blocking on. The socket is
+//                  registered with an EventLoop, and the coroutine is
+//                  resumed by the loop once the socket is ready, so that one
+//                  thread may serve any number of connections, each written
+//                  as straight-line code. Only available if
+//                  NETWORKING_COROUTINES is defined.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_ASYNCSTREAM__
+#define __ET_ASYNCSTREAM__
+
+#include <namespaces/Networking.h>
+
+#ifdef NETWORKING_COROUTINES
+
+#include <Networking/EventLoop.h>
+#include <Networking/FileDescriptor.h>
+#include <Networking/NetworkAddress.h>
+#include <Networking/PeerAddress.h>
+#include <Networking/Task.h>
+#include <Networking/TCP/TLSHandshake.h>
+#include <Networking/TimerWheel.h>
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Need forward declaration for compilation
+typedef struct ssl_st SSL;
+
+// A stream may be awaited by one read and one write at once, which may be
+// in different coroutines. It must only be used on the loop's thread.
+class Networking::TCP::AsyncStream
+{
+public:
+  // Registers the socket with the loop, and makes it non-blocking. The
+  // socket, and the SSL attached to it if there is one, are borrowed, and
+  // must outlive the stream...
+  AsyncStream(EventLoop& loop, int socket, SSL* ssl = nullptr);
+  // ...or the socket is owned, and closed once the stream is destroyed.
+  AsyncStream(EventLoop& loop, FileDescriptor socket);
+  AsyncStream(AsyncStream&&) noexcept;
+  AsyncStream& operator=(AsyncStream&&) = delete;
+  AsyncStream(const AsyncStream&) = delete;
+  AsyncStream& operator=(const AsyncStream&) = delete;
+  // Removes the socket from the loop. An owned TLS connection is shut down.
+  ~AsyncStream();
+
+  class Read;
+  class Write;
+  class Wait;
+  class Handshake;
+
+  // co_await read() evaluates to the number of bytes read, which is 0 only
+  // at the end of the stream.
+  Read read(void* data, std::size_t length);
+  // co_await write() returns once all of the data has been written.
+  Write write(const void* data, std::size_t length);
+  // Until one of the EventLoop::Events occurs (or a HANGUP or ERROR).
+  Wait wait(unsigned int events);
+  // Drives the handshake of the SSL (which must be set to accept or
+  // connect) until it is over, and evaluates to it, whether or not it
+  // completed. Not subject to the timeout, only to the deadline.
+  Handshake handshake(std::chrono::steady_clock::time_point deadline);
+
+  // Encrypts the connection from now on with ssl, which is attached to the
+  // socket and owned by the stream.
+  void setSSL(std::unique_ptr<SSL, void(*)(SSL*)> ssl);
+  // A read, write or wait that is suspended for longer than this throws
+  // std::system_error (ETIMEDOUT). 0, the default, waits for ever.
+  void setTimeout(std::chrono::milliseconds timeout);
+
+  int getDescriptor() const;
+  SSL* getSSL() const;
+
+private:
+  class Operation;
+  struct State;
+
+  std::shared_ptr<State> m_state;
+};
+
+// What every awaitable of the stream has in common: it tries the I/O when
+// it is awaited, and only suspends the coroutine if that would block.
+class Networking::TCP::AsyncStream::Operation
+{
+public:
+  bool await_ready();
+  void await_suspend(std::coroutine_handle<> awaiter);
+
+protected:
+  Operation(State& state, unsigned int events, bool writes);
+  Operation(const Operation&) = default;
+  virtual ~Operation() = default;
+
+  // Makes what progress it can without blocking. Returns false if it must
+  // wait for m_events first, or true once it is over (whether or not it
+  // succeeded: errors are kept for rethrow()).
+  virtual bool attempt() = 0;
+  virtual std::chrono::steady_clock::time_point getDeadline() const;
+  // Called instead of attempt() once the deadline has passed.
+  virtual void expire();
+  void rethrow() const;
+
+  State& m_state;
+  unsigned int m_events;
+  std::exception_ptr m_error;
+
+private:
+  friend struct State;
+
+  const bool m_writes;
+  std::chrono::steady_clock::time_point m_deadline;
+  std::coroutine_handle<> m_awaiter;
+};
+
+class Networking::TCP::AsyncStream::Read : public Operation
+{
+public:
+  std::size_t await_resume() const;
+
+private:
+  friend class AsyncStream;
+
+  Read(State& state, void* data, std::size_t length);
+  virtual bool attempt() final override;
+
+  char* m_data;
+  std::size_t m_length;
+  std::size_t m_received;
+};
+
+class Networking::TCP::AsyncStream::Write : public Operation
+{
+public:
+  void await_resume() const;
+
+private:
+  friend class AsyncStream;
+
+  Write(State& state, const void* data, std::size_t length);
+  virtual bool attempt() final override;
+
+  const char* m_data;
+  std::size_t m_length;
+};
+
+class Networking::TCP::AsyncStream::Wait : public Operation
+{
+public:
+  // Always suspends: readiness is only known once the loop says so.
+  bool await_ready() const;
+  void await_resume() const;
+
+private:
+  friend class AsyncStream;
+
+  Wait(State& state, unsigned int events);
+  virtual bool attempt() final override;
+};
+
+class Networking::TCP::AsyncStream::Handshake : public Operation
+{
+public:
+  TLSHandshake await_resume() const;
+
+private:
+  friend class AsyncStream;
+
+  Handshake(State& state, std::chrono::steady_clock::time_point deadline);
+  virtual bool attempt() final override;
+  virtual std::chrono::steady_clock::time_point getDeadline() const
+    final override;
+  virtual void expire() final override;
+
+  TLSHandshake m_handshake;
+};
+
+namespace Networking::TCP
+{
+  // Whether Handler is a coroutine handler, which the listeners call as
+  // Task<>(AsyncStream, const PeerAddress&), or as
+  // Task<>(AsyncStream, const HostType&) if it cannot take the former.
+  template<class Handler, class HostType>
+  inline constexpr bool isAsyncHandler =
+    std::is_invocable_r_v<Task<>, Handler&, AsyncStream, const PeerAddress&>
+    || std::is_invocable_r_v<Task<>, Handler&, AsyncStream, const HostType&>;
+
+  // Connects to each of the addresses in turn, giving each attemptTimeout
+  // to accept, and evaluates to a stream that owns the first connection
+  // made. Throws std::system_error if none is.
+  Task<AsyncStream> connect(EventLoop& loop,
+                            std::vector<NetworkAddress> addresses,
+                            std::chrono::milliseconds attemptTimeout);
+};
+
+#include <Networking/TCP/AsyncStream.tcc>
+
+#endif // NETWORKING_COROUTINES
+
+#endif // __ET_ASYNCSTREAM__
+
+///////////////////////////////////////////////////////////////////////////////
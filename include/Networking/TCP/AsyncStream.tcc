@@ -0,0 +1,584 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            AsyncStream.tcc
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the awaitable connection stream. It is
+//                  in a header, rather than in the library, so that the
+//                  library can still be built as C++17.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TCP/AsyncStream.h>
+#include <Networking/TCP/TLSException.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+
+// What the stream's registration with the loop shares with the stream: it
+// outlives the stream until the loop has destroyed the callback.
+struct Networking::TCP::AsyncStream::State
+{
+  using Clock = std::chrono::steady_clock;
+
+  State(EventLoop& loop, int socket, FileDescriptor ownedSocket,
+        SSL* ssl);
+
+  // The socket is ready: resumes the operations that are no longer
+  // blocked.
+  void dispatch(unsigned int events);
+  // The timer has fired: resumes the operations past their deadline.
+  void expire();
+  // Schedules the timer for the earliest deadline of the operations
+  // suspended.
+  void arm();
+  void resume(Operation* State::* slot);
+
+  EventLoop& loop;
+  FileDescriptor ownedSocket;
+  int socket;
+  SSL* ssl;
+  std::unique_ptr<SSL, void(*)(SSL*)> ownedSSL;
+  std::chrono::milliseconds timeout;
+  TimerWheel::Timer timer;
+  Operation* reader;
+  Operation* writer;
+};
+
+inline Networking::TCP::AsyncStream::State
+::State(EventLoop& theLoop, int theSocket, FileDescriptor theOwnedSocket,
+        SSL* theSSL)
+  : loop{theLoop}, ownedSocket{std::move(theOwnedSocket)}, socket{theSocket},
+    ssl{theSSL}, ownedSSL{nullptr, SSL_free}, timeout{0},
+    timer{[this]()
+      {
+        expire();
+      }},
+    reader{nullptr}, writer{nullptr}
+{}
+
+inline void Networking::TCP::AsyncStream::State::dispatch(unsigned int events)
+{
+  for (Operation* State::* slot : {&State::reader, &State::writer})
+    {
+      Operation* operation = this->*slot;
+      if (nullptr == operation
+          || 0 == (events & (operation->m_events | EventLoop::HANGUP
+                             | EventLoop::ERROR)))
+        {
+          continue;
+        }
+
+      bool over = true;
+      try
+        {
+          over = operation->attempt();
+        }
+      catch (...)
+        {
+          operation->m_error = std::current_exception();
+        }
+      if (over)
+        {
+          resume(slot);
+        }
+    }
+}
+
+inline void Networking::TCP::AsyncStream::State::expire()
+{
+  const Clock::time_point now = Clock::now();
+  for (Operation* State::* slot : {&State::reader, &State::writer})
+    {
+      Operation* operation = this->*slot;
+      if (nullptr != operation && operation->m_deadline <= now)
+        {
+          operation->expire();
+          resume(slot);
+        }
+    }
+  arm();
+}
+
+inline void Networking::TCP::AsyncStream::State::arm()
+{
+  Clock::time_point deadline = Clock::time_point::max();
+  for (const Operation* operation : {reader, writer})
+    {
+      if (nullptr != operation)
+        {
+          deadline = std::min(deadline, operation->m_deadline);
+        }
+    }
+
+  if (Clock::time_point::max() == deadline)
+    {
+      loop.getTimers().cancel(timer);
+    }
+  else
+    {
+      loop.getTimers().schedule(timer, deadline);
+    }
+}
+
+inline void Networking::TCP::AsyncStream::State
+::resume(Operation* State::* slot)
+{
+  // The coroutine may await the next operation before this returns.
+  Operation* operation = std::exchange(this->*slot, nullptr);
+  arm();
+  operation->m_awaiter.resume();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// AsyncStream
+////
+
+inline Networking::TCP::AsyncStream::AsyncStream(EventLoop& loop, int socket,
+                                                 SSL* ssl)
+  : m_state{std::make_shared<State>(loop, socket, FileDescriptor{}, ssl)}
+{
+  const int flags = ::fcntl(socket, F_GETFL);
+  if (-1 == flags || (0 == (flags & O_NONBLOCK)
+                      && -1 == ::fcntl(socket, F_SETFL, flags | O_NONBLOCK)))
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+
+  loop.add(socket, EventLoop::READABLE | EventLoop::WRITABLE,
+           [state = m_state](unsigned int events)
+           {
+             state->dispatch(events);
+           });
+}
+
+inline Networking::TCP::AsyncStream::AsyncStream(EventLoop& loop,
+                                                 FileDescriptor socket)
+  : AsyncStream{loop, socket.get()}
+{
+  m_state->ownedSocket = std::move(socket);
+}
+
+inline Networking::TCP::AsyncStream::AsyncStream(AsyncStream&& other)
+  noexcept
+  : m_state{std::move(other.m_state)}
+{}
+
+inline Networking::TCP::AsyncStream::~AsyncStream()
+{
+  if (!m_state)
+    {
+      return;
+    }
+
+  if (m_state->ownedSSL)
+    {
+      // Sends the close_notify if it can, but does not wait for the peer's.
+      ERR_clear_error();
+      SSL_shutdown(m_state->ownedSSL.get());
+    }
+  m_state->loop.getTimers().cancel(m_state->timer);
+  // The loop closes an owned socket (and frees an owned SSL) when it
+  // destroys the callback, after the current round.
+  m_state->loop.remove(m_state->socket);
+}
+
+inline Networking::TCP::AsyncStream::Read
+Networking::TCP::AsyncStream::read(void* data, std::size_t length)
+{
+  return Read{*m_state, data, length};
+}
+
+inline Networking::TCP::AsyncStream::Write
+Networking::TCP::AsyncStream::write(const void* data, std::size_t length)
+{
+  return Write{*m_state, data, length};
+}
+
+inline Networking::TCP::AsyncStream::Wait
+Networking::TCP::AsyncStream::wait(unsigned int events)
+{
+  return Wait{*m_state, events};
+}
+
+inline Networking::TCP::AsyncStream::Handshake
+Networking::TCP::AsyncStream
+::handshake(std::chrono::steady_clock::time_point deadline)
+{
+  if (nullptr == m_state->ssl)
+    {
+      throw std::logic_error{"AsyncStream: there is no SSL to handshake"};
+    }
+  return Handshake{*m_state, deadline};
+}
+
+inline void
+Networking::TCP::AsyncStream::setSSL(std::unique_ptr<SSL, void(*)(SSL*)> ssl)
+{
+  m_state->ssl = ssl.get();
+  m_state->ownedSSL = std::move(ssl);
+}
+
+inline void
+Networking::TCP::AsyncStream::setTimeout(std::chrono::milliseconds timeout)
+{
+  m_state->timeout = timeout;
+}
+
+inline int Networking::TCP::AsyncStream::getDescriptor() const
+{
+  return m_state->socket;
+}
+
+inline SSL* Networking::TCP::AsyncStream::getSSL() const
+{
+  return m_state->ssl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// AsyncStream::Operation
+////
+
+inline Networking::TCP::AsyncStream::Operation
+::Operation(State& state, unsigned int events, bool writes)
+  : m_state{state}, m_events{events}, m_writes{writes}
+{}
+
+inline bool Networking::TCP::AsyncStream::Operation::await_ready()
+{
+  return attempt();
+}
+
+inline void Networking::TCP::AsyncStream::Operation
+::await_suspend(std::coroutine_handle<> awaiter)
+{
+  // Writes wait in one slot, and everything else in the other, whichever
+  // event TLS has them wait for.
+  Operation*& slot = m_writes ? m_state.writer : m_state.reader;
+  if (nullptr != slot)
+    {
+      throw std::logic_error{"AsyncStream: another coroutine is already"
+          " waiting to " + std::string{&slot == &m_state.writer ? "write"
+                                       : "read"}};
+    }
+
+  m_deadline = getDeadline();
+  m_awaiter = awaiter;
+  slot = this;
+  m_state.arm();
+}
+
+inline std::chrono::steady_clock::time_point
+Networking::TCP::AsyncStream::Operation::getDeadline() const
+{
+  return 0 == m_state.timeout.count() ? State::Clock::time_point::max()
+    : State::Clock::now() + m_state.timeout;
+}
+
+inline void Networking::TCP::AsyncStream::Operation::expire()
+{
+  m_error = std::make_exception_ptr
+    (std::system_error{ETIMEDOUT, std::generic_category()});
+}
+
+inline void Networking::TCP::AsyncStream::Operation::rethrow() const
+{
+  if (m_error)
+    {
+      std::rethrow_exception(m_error);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// AsyncStream::Read
+////
+
+inline Networking::TCP::AsyncStream::Read
+::Read(State& state, void* data, std::size_t length)
+  : Operation{state, EventLoop::READABLE, false},
+    m_data{static_cast<char*>(data)},
+    m_length{length}, m_received{0}
+{}
+
+inline bool Networking::TCP::AsyncStream::Read::attempt()
+{
+  if (nullptr == m_state.ssl)
+    {
+      for (;;)
+        {
+          const ssize_t result = ::recv(m_state.socket, m_data, m_length, 0);
+          if (0 <= result)
+            {
+              // The loop only sees the I/O that waited on it.
+              m_state.loop.noteActivity(m_state.socket, EventLoop::READABLE);
+              m_received = result;
+              return true;
+            }
+          else if (EAGAIN == errno || EWOULDBLOCK == errno)
+            {
+              m_events = EventLoop::READABLE;
+              return false;
+            }
+          else if (EINTR != errno)
+            {
+              throw std::system_error{errno, std::generic_category()};
+            }
+        }
+    }
+
+  ERR_clear_error();
+  errno = 0;
+  const int result = SSL_read(m_state.ssl, m_data, static_cast<int>
+                              (std::min<std::size_t>(m_length, INT_MAX)));
+  if (0 < result)
+    {
+      m_state.loop.noteActivity(m_state.socket, EventLoop::READABLE);
+      m_received = result;
+      return true;
+    }
+
+  switch (SSL_get_error(m_state.ssl, result))
+    {
+    case SSL_ERROR_ZERO_RETURN:
+      return true;
+    case SSL_ERROR_WANT_READ:
+      m_events = EventLoop::READABLE;
+      return false;
+    case SSL_ERROR_WANT_WRITE:
+      m_events = EventLoop::WRITABLE;
+      return false;
+    case SSL_ERROR_SYSCALL:
+      if (0 == ERR_peek_error())
+        {
+          if (0 == errno)
+            {
+              // The peer closed the connection without a close_notify.
+              return true;
+            }
+          throw std::system_error{errno, std::generic_category()};
+        }
+      [[fallthrough]];
+    default:
+      throw std::runtime_error{"AsyncStream: could not read from the TLS"
+          " connection; error trace:\n" + getSSLErrors()};
+    }
+}
+
+inline std::size_t Networking::TCP::AsyncStream::Read::await_resume() const
+{
+  rethrow();
+  return m_received;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// AsyncStream::Write
+////
+
+inline Networking::TCP::AsyncStream::Write
+::Write(State& state, const void* data, std::size_t length)
+  : Operation{state, EventLoop::WRITABLE, true},
+    m_data{static_cast<const char*>(data)}, m_length{length}
+{}
+
+inline bool Networking::TCP::AsyncStream::Write::attempt()
+{
+  while (0 < m_length)
+    {
+      if (nullptr == m_state.ssl)
+        {
+          const ssize_t result = ::send(m_state.socket, m_data, m_length,
+                                        MSG_NOSIGNAL);
+          if (-1 == result)
+            {
+              if (EAGAIN == errno || EWOULDBLOCK == errno)
+                {
+                  m_events = EventLoop::WRITABLE;
+                  return false;
+                }
+              else if (EINTR != errno)
+                {
+                  throw std::system_error{errno, std::generic_category()};
+                }
+              continue;
+            }
+          m_state.loop.noteActivity(m_state.socket, EventLoop::WRITABLE);
+          m_data += result;
+          m_length -= result;
+          continue;
+        }
+
+      ERR_clear_error();
+      errno = 0;
+      // SSL_write must be retried with the same arguments.
+      const int result = SSL_write
+        (m_state.ssl, m_data,
+         static_cast<int>(std::min<std::size_t>(m_length, INT_MAX)));
+      if (0 < result)
+        {
+          m_state.loop.noteActivity(m_state.socket, EventLoop::WRITABLE);
+          m_data += result;
+          m_length -= result;
+          continue;
+        }
+
+      switch (SSL_get_error(m_state.ssl, result))
+        {
+        case SSL_ERROR_WANT_WRITE:
+          m_events = EventLoop::WRITABLE;
+          return false;
+        case SSL_ERROR_WANT_READ:
+          m_events = EventLoop::READABLE;
+          return false;
+        case SSL_ERROR_SYSCALL:
+          if (0 == ERR_peek_error() && 0 != errno)
+            {
+              throw std::system_error{errno, std::generic_category()};
+            }
+          [[fallthrough]];
+        default:
+          throw std::runtime_error{"AsyncStream: could not write to the TLS"
+              " connection; error trace:\n" + getSSLErrors()};
+        }
+    }
+  return true;
+}
+
+inline void Networking::TCP::AsyncStream::Write::await_resume() const
+{
+  rethrow();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// AsyncStream::Wait
+////
+
+inline Networking::TCP::AsyncStream::Wait::Wait(State& state,
+                                                unsigned int events)
+  : Operation{state, events, EventLoop::WRITABLE == events}
+{}
+
+inline bool Networking::TCP::AsyncStream::Wait::await_ready() const
+{
+  return false;
+}
+
+inline bool Networking::TCP::AsyncStream::Wait::attempt()
+{
+  // Only called once the loop has reported one of the events.
+  return true;
+}
+
+inline void Networking::TCP::AsyncStream::Wait::await_resume() const
+{
+  rethrow();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// AsyncStream::Handshake
+////
+
+inline Networking::TCP::AsyncStream::Handshake
+::Handshake(State& state, std::chrono::steady_clock::time_point deadline)
+  : Operation{state, EventLoop::READABLE, false},
+    m_handshake{state.ssl, deadline}
+{}
+
+inline bool Networking::TCP::AsyncStream::Handshake::attempt()
+{
+  m_handshake.step();
+  m_events = m_handshake.getEvents();
+  return m_handshake.isOver();
+}
+
+inline std::chrono::steady_clock::time_point
+Networking::TCP::AsyncStream::Handshake::getDeadline() const
+{
+  return m_handshake.getDeadline();
+}
+
+inline void Networking::TCP::AsyncStream::Handshake::expire()
+{
+  m_handshake.expire();
+}
+
+inline Networking::TCP::TLSHandshake
+Networking::TCP::AsyncStream::Handshake::await_resume() const
+{
+  rethrow();
+  return m_handshake;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// connect
+////
+
+inline Networking::Task<Networking::TCP::AsyncStream>
+Networking::TCP::connect(EventLoop& loop,
+                         std::vector<NetworkAddress> addresses,
+                         std::chrono::milliseconds attemptTimeout)
+{
+  int error = EHOSTUNREACH;
+  for (const NetworkAddress& address : addresses)
+    {
+      FileDescriptor socket{::socket(address.getFamily(),
+                                     SOCK_STREAM | SOCK_NONBLOCK
+                                     | SOCK_CLOEXEC, 0)};
+      if (!socket)
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+
+      if (0 == ::connect(socket.get(), address.getSockAddr(),
+                         address.getSockAddrLength()))
+        {
+          co_return AsyncStream{loop, std::move(socket)};
+        }
+      else if (EINPROGRESS != errno)
+        {
+          error = errno;
+          continue;
+        }
+
+      AsyncStream stream{loop, std::move(socket)};
+      stream.setTimeout(attemptTimeout);
+      try
+        {
+          co_await stream.wait(EventLoop::WRITABLE);
+        }
+      catch (const std::system_error& timedOut)
+        {
+          error = timedOut.code().value();
+          continue;
+        }
+
+      socklen_t length = sizeof(error);
+      if (-1 == ::getsockopt(stream.getDescriptor(), SOL_SOCKET, SO_ERROR,
+                             &error, &length))
+        {
+          error = errno;
+        }
+      if (0 == error)
+        {
+          stream.setTimeout(std::chrono::milliseconds{0});
+          co_return std::move(stream);
+        }
+    }
+  throw std::system_error{error, std::generic_category()};
+}
+
+///////////////////////////////////////////////////////////////////////////////
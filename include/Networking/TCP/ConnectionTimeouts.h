@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            ConnectionTimeouts.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     How long the listeners let a connection stall before
+//                  they close it, so that a client that stops sending (or
+//                  receiving) does not keep its socket, or its worker, for
+//                  ever.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_CONNECTIONTIMEOUTS__
+#define __ET_CONNECTIONTIMEOUTS__
+
+#include <namespaces/Networking.h>
+
+#include <Networking/TimerWheel.h>
+
+#include <chrono>
+
+// A timeout of 0 is no timeout, which is the default for each. A connection
+// that times out is shut down, rather than closed under its handler: reads
+// then see the end of the stream, and writes fail, so that the handler
+// returns, and the request is finished as usual.
+//
+// Under an EventLoop (e.g. by the NonBlockingServer), the loop keeps the
+// deadlines of each connection whose handler has registered its socket (see
+// EventLoop::setIdleTimeout()), and the read and write timeout is that of
+// the AsyncStream given to a coroutine handler. With blocking handlers, the
+// read and write timeouts are the socket's own (SO_RCVTIMEO and
+// SO_SNDTIMEO), and the idle timeout is kept by the listener's TimerThread.
+struct Networking::TCP::ConnectionTimeouts
+{
+  // From accepting the connection until the client first sends something
+  // (which, for TLS, is the start of the handshake).
+  std::chrono::milliseconds firstByte{0};
+  // For each read or write to complete.
+  std::chrono::milliseconds readWrite{0};
+  // Without data in either direction, e.g. between the requests on a
+  // keep-alive connection.
+  std::chrono::milliseconds idle{0};
+
+  class Guard;
+};
+
+// Enforces the timeouts on a connection handled by blocking calls, for as
+// long as it lives. The idle timeout is checked against the kernel's
+// record of when data was last sent and received (TCP_INFO), so that the
+// timer need not be reset on every read and write.
+class Networking::TCP::ConnectionTimeouts::Guard
+{
+public:
+  // Sets the read and write timeouts of the socket. The timer thread is
+  // only needed for an idle timeout.
+  Guard(int socket, const ConnectionTimeouts& timeouts,
+        TimerThread* timerThread);
+  Guard(const Guard&) = delete;
+  Guard& operator=(const Guard&) = delete;
+  ~Guard();
+
+  // Waits at most the first byte timeout for the client to send something
+  // (or to hang up). Returns false if it did not, and the connection should
+  // be dropped.
+  bool awaitFirstByte() const;
+
+private:
+  void check();
+
+  const int m_socket;
+  const ConnectionTimeouts& m_timeouts;
+  TimerThread* const m_timerThread;
+  TimerWheel::Timer m_timer;
+};
+
+#endif // __ET_CONNECTIONTIMEOUTS__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,98 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            FrameCodec.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Splits the bytes of a connection into messages, either
+//                  prefixed by their length or ended by a delimiter, and
+//                  writes messages framed the same way. Frames are parsed in
+//                  place, out of a RingBuffer that the connection is read
+//                  into, so that receiving a message does not allocate.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_FRAMECODEC__
+#define __ET_FRAMECODEC__
+
+#include <namespaces/Networking.h>
+#include <Networking/RingBuffer.h>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Reads through a Stream, and so works alike over TCP and TLS. A frame
+// may arrive over any number of reads, and a read may hold any number of
+// frames. Throws std::runtime_error if the peer sends a frame longer than
+// the maximum.
+class Networking::TCP::FrameCodec
+{
+public:
+  enum Framing
+    {
+      // A big-endian unsigned integer of 1, 2, 4 or 8 bytes, then that
+      // many bytes of payload.
+      LENGTH_PREFIXED,
+      // The payload, then the delimiter (which it must not contain).
+      DELIMITED
+    };
+
+  FrameCodec(Framing framing, unsigned int prefixSize,
+             std::string delimiter, std::size_t maxFrameSize);
+
+  class Builder;
+
+  // Reads what is available from the stream into the buffer, with at most
+  // one call to the kernel. Returns the number of bytes read, which is 0 at
+  // the end of the stream (see Stream::atEnd()), or if the socket is
+  // non-blocking and nothing has arrived. Frames must be taken with next()
+  // before the buffer fills: it always has room for one more.
+  std::size_t fill(Stream& stream);
+  // For data that has been read elsewhere (e.g. by the EventLoop).
+  void append(std::string_view data);
+
+  // The payload of the next complete frame, or nothing if it has not all
+  // arrived. The view is valid until the next call to fill() or append().
+  std::optional<std::string_view> next();
+
+  // Bytes received that are not yet part of a frame returned by next().
+  std::size_t getBuffered() const;
+
+  // Writes a frame holding payload to the stream's buffer.
+  void write(Stream& stream, std::string_view payload) const;
+
+private:
+  void check(std::size_t frameSize) const;
+
+  const Framing m_framing;
+  const unsigned int m_prefixSize;
+  const std::string m_delimiter;
+  const std::size_t m_maxFrameSize;
+  RingBuffer m_buffer;
+  // How far into the buffer the delimiter has been searched for.
+  std::size_t m_scanned;
+};
+
+class Networking::TCP::FrameCodec::Builder
+{
+public:
+  Builder setLengthPrefixed(unsigned int prefixSize);
+  Builder setDelimited(std::string delimiter);
+  Builder setMaxFrameSize(std::size_t);
+
+  FrameCodec build() const;
+
+private:
+  Framing framing = LENGTH_PREFIXED;
+  unsigned int prefixSize = 4;
+  std::string delimiter = "\r\n";
+  std::size_t maxFrameSize = 65536;
+};
+
+#endif // __ET_FRAMECODEC__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,44 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            HappyEyeballs.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Connects to the first of several addresses of a host to
+//                  answer, in the manner of RFC 8305 ("Happy Eyeballs").
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_HAPPYEYEBALLS__
+#define __ET_HAPPYEYEBALLS__
+
+#include <namespaces/Networking.h>
+#include <Networking/FileDescriptor.h>
+#include <Networking/NetworkAddress.h>
+
+#include <chrono>
+#include <vector>
+
+namespace Networking
+{
+  namespace TCP
+  {
+    // Starts a non-blocking connect to each address in turn, alternating
+    // between IPv6 and IPv4 (starting with the family of the first address)
+    // so that one broken family does not hold up the other, giving each a
+    // head start of attemptDelay (or less, if it fails sooner) before the
+    // next is started, and abandoning each after attemptTimeout. Returns
+    // the first connection to succeed, in blocking mode, and closes the
+    // others. Throws std::system_error, listing every failure, if none
+    // does.
+    FileDescriptor connectFirst(const std::vector<NetworkAddress>& addresses,
+                                std::chrono::milliseconds attemptDelay,
+                                std::chrono::milliseconds attemptTimeout);
+  };
+};
+
+#endif // __ET_HAPPYEYEBALLS__
+
+///////////////////////////////////////////////////////////////////////////////
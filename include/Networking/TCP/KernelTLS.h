@@ -0,0 +1,58 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            KernelTLS.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Kernel TLS offload. Once the handshake has completed,
+//                  OpenSSL may hand the keys to the kernel, which then
+//                  encrypts and decrypts records itself, so that data need
+//                  not pass through OpenSSL's record layer, and the socket
+//                  may be used with read(2), write(2) and sendfile(2).
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_KERNELTLS__
+#define __ET_KERNELTLS__
+
+#include <namespaces/Networking.h>
+
+#include <string>
+
+// Need forward declaration for compilation
+typedef struct ssl_ctx_st SSL_CTX;
+typedef struct ssl_st SSL;
+
+namespace Networking
+{
+  namespace TCP
+  {
+    enum KernelTLSMode
+      {
+        KTLS_DISABLED,
+        // Offload when the kernel supports the negotiated protocol version
+        // and cipher, and otherwise carry on in userspace, logging why.
+        KTLS_PREFERRED,
+        // Fail the handshake unless both directions are offloaded. Note
+        // that OpenSSL 3.0 offloads only the writes of a TLS 1.3
+        // connection.
+        KTLS_REQUIRED
+      };
+
+    // Enables the offload (SSL_OP_ENABLE_KTLS) for connections made from
+    // context, unless mode is KTLS_DISABLED. Throws std::runtime_error if
+    // OpenSSL was built without kernel TLS and mode is KTLS_REQUIRED.
+    void configureKernelTLS(SSL_CTX* context, KernelTLSMode mode);
+
+    // Once the handshake has completed, returns "" if both directions of
+    // the connection are offloaded, and otherwise which are not, with the
+    // protocol version and cipher that were negotiated.
+    std::string checkKernelTLS(SSL* ssl);
+  };
+};
+
+#endif // __ET_KERNELTLS__
+
+///////////////////////////////////////////////////////////////////////////////
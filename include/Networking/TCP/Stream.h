@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            Stream.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Buffered reads and writes on a connection, with the same
+//                  interface over a plain socket and a TLS connection, so
+//                  that a handler need not write its own read loops, and can
+//                  gather a number of small writes into one system call (or
+//                  one TLS record).
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_STREAM__
+#define __ET_STREAM__
+
+#include <namespaces/Networking.h>
+#include <Networking/RequestPool.h>
+
+#include <cstddef>
+#include <memory>
+
+#include <sys/uio.h>
+
+// Need forward declaration for compilation
+typedef struct ssl_st SSL;
+
+// Wraps the socket (or SSL*) handed to a handler, which keeps ownership of
+// it. Reads on a non-blocking socket return what is available without
+// waiting; writes are buffered until flush(), and never leave data
+// half-sent: if the socket is non-blocking, they wait for it to become
+// writable. Errors are thrown as std::system_error, or as
+// std::runtime_error with the OpenSSL error trace. On a blocking socket
+// with read and write timeouts (see ConnectionTimeouts), one that times out
+// throws std::system_error (ETIMEDOUT).
+class Networking::TCP::Stream
+{
+public:
+  // Buffers are blocks of the pool, taken when first needed and returned
+  // when the stream is destroyed. By default, they are of 16KiB: the most a
+  // TLS record can hold.
+  explicit Stream(int socket, std::shared_ptr<RequestPool> bufferPool
+                  = getDefaultBufferPool());
+  explicit Stream(SSL* ssl, std::shared_ptr<RequestPool> bufferPool
+                  = getDefaultBufferPool());
+  Stream(Stream&&) noexcept;
+  Stream& operator=(Stream&&) = delete;
+  Stream(const Stream&) = delete;
+  Stream& operator=(const Stream&) = delete;
+  // Flushes (and uncorks) what is left, ignoring errors: call flush() first
+  // to see them.
+  ~Stream();
+
+  static std::shared_ptr<RequestPool> getDefaultBufferPool();
+
+  // Returns the number of bytes read, with at most one call to the kernel.
+  // This is 0 at the end of the stream, or if the socket is non-blocking
+  // and nothing has arrived; atEnd() tells the two apart.
+  std::size_t read(void* data, std::size_t length);
+  // Scatters what is read across the vector, reading ahead into the buffer
+  // in the same call.
+  std::size_t readv(const struct iovec* vector, int count);
+  bool atEnd() const;
+
+  void write(const void* data, std::size_t length);
+  // If the data does not fit in what is left of the buffer, it is sent
+  // along with what was buffered: in one call to sendmsg(2), or as
+  // buffer-sized TLS records.
+  void writev(const struct iovec* vector, int count);
+  void flush();
+
+  // While corked (with TCP_CORK), the kernel sends only full segments, so
+  // that flushes, and e.g. sendFile(), made in between are coalesced.
+  // Uncorking flushes the stream and sends any partial segment.
+  void setCork(bool corked);
+  bool isCorked() const;
+
+  int getDescriptor() const;
+  // nullptr on a plain socket.
+  SSL* getSSL() const;
+  std::size_t getBufferSize() const;
+
+private:
+  struct ReturnBlock
+  {
+    void operator()(char* block) const noexcept;
+  };
+  using Buffer = std::unique_ptr<char, ReturnBlock>;
+
+  char* getReadBuffer();
+  char* getWriteBuffer();
+  // One call to the kernel (or SSL_read).
+  std::size_t receive(void* data, std::size_t length);
+  std::size_t receive(const struct iovec* vector, int count);
+  // All of it, waiting for the socket as need be.
+  void send(const struct iovec* vector, int count);
+  void send(const char* data, std::size_t length);
+
+  std::shared_ptr<RequestPool> m_bufferPool;
+  int m_socket;
+  SSL* m_ssl;
+  Buffer m_readBuffer;
+  std::size_t m_readStart;
+  std::size_t m_readEnd;
+  Buffer m_writeBuffer;
+  std::size_t m_writeLength;
+  bool m_corked;
+  bool m_atEnd;
+};
+
+#endif // __ET_STREAM__
+
+///////////////////////////////////////////////////////////////////////////////
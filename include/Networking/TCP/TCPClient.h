@@ -7,23 +7,36 @@
 //
 // CREATED:         04/03/2020
 //
-// LAST EDITED:     04/18/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_TCPCLIENT__
 #define __ET_TCPCLIENT__
 
 #include <namespaces/Networking.h>
+#include <Networking/FileDescriptor.h>
 #include <Networking/NetworkHost.h>
+#include <Networking/TCP/AsyncStream.h>
 
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 template<class HostType>
 class Networking::TCP::TCPClient
 {
 public:
+  // How the addresses of the host are raced (see connectFirst()).
+  struct ConnectOptions
+  {
+    // The head start each address gets before the next is tried. RFC 8305
+    // recommends 250ms.
+    std::chrono::milliseconds attemptDelay{250};
+    std::chrono::milliseconds attemptTimeout{10000};
+  };
+
   TCPClient(HostType hostAddress,
             std::function<void(int)> userHandler,
             // By default, simply send error messages to cerr.
@@ -32,13 +45,37 @@ public:
               {
                 std::cerr << message << '\n';
               });
+  TCPClient(HostType hostAddress,
+            std::function<void(int)> userHandler,
+            std::function<void(const std::string&)> logStream,
+            ConnectOptions connectOptions);
+  // Opens a new connection to the host for each call, and passes it to the
+  // user handler. The connection is closed when the handler returns.
   void connect();
 
+  // Returns a new connection to the first of hostAddress's addresses to
+  // accept; throws std::system_error if none does.
+  static FileDescriptor open(const HostType& hostAddress);
+  static FileDescriptor open(const HostType& hostAddress,
+                             const ConnectOptions& connectOptions);
+  // The addresses that open() tries.
+  static std::vector<NetworkAddress> getAddresses(const HostType&);
+
+#ifdef NETWORKING_COROUTINES
+  // Evaluates to a new connection to the host (or to hostAddress), made on
+  // the loop's thread without blocking it, which the stream owns. The
+  // addresses are tried in turn, rather than raced, each for the attempt
+  // timeout.
+  Task<AsyncStream> connect(EventLoop& loop) const;
+  Task<AsyncStream> connect(EventLoop& loop,
+                            const HostType& hostAddress) const;
+#endif
+
 private:
-  std::shared_ptr<int> m_socket;
   HostType m_hostAddress;
   std::function<void(int)> m_userHandler;
   std::function<void(const std::string&)> m_logStream;
+  ConnectOptions m_connectOptions;
 };
 
 #include <Networking/TCP/TCPClient.tcc>
@@ -7,78 +7,92 @@
 //
 // CREATED:         04/03/2020
 //
-// LAST EDITED:     05/01/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #include <Networking/TCP/TCPClient.h>
+#include <Networking/TCP/HappyEyeballs.h>
 
-#include <system_error>
-
-#include <sys/socket.h>
-#include <unistd.h>
+#include <vector>
 
 template<class HostType>
 Networking::TCP::TCPClient<HostType>
 ::TCPClient(HostType hostAddress,
             std::function<void(int)> userHandler,
             std::function<void(const std::string&)> logStream)
-  : m_socket{0}, m_hostAddress{hostAddress}, m_userHandler{userHandler},
-    m_logStream{logStream}
+  : TCPClient{hostAddress, userHandler, logStream, ConnectOptions{}}
+{}
+
+template<class HostType>
+Networking::TCP::TCPClient<HostType>
+::TCPClient(HostType hostAddress,
+            std::function<void(int)> userHandler,
+            std::function<void(const std::string&)> logStream,
+            ConnectOptions connectOptions)
+  : m_hostAddress{hostAddress}, m_userHandler{userHandler},
+    m_logStream{logStream}, m_connectOptions{connectOptions}
+{}
+
+template<class HostType>
+void Networking::TCP::TCPClient<HostType>::connect()
 {
-  errno = 0;
-  // TODO: Enable IPv6
-  int socket= ::socket(PF_INET, SOCK_STREAM, 0);
-  if (-1 == socket)
-    {
-      throw std::system_error{errno, std::generic_category()};
-    }
-  m_socket = std::shared_ptr<int>{new int, [](int* pInt){
-      ::close(*pInt);
-      delete pInt;
-    }};
-  *m_socket = socket;
+  FileDescriptor socket = open(m_hostAddress, m_connectOptions);
+  m_userHandler(socket.get());
 }
 
-template<>
-void Networking::TCP::TCPClient<Networking::NetworkAddress>::connect()
+template<class HostType>
+Networking::FileDescriptor
+Networking::TCP::TCPClient<HostType>::open(const HostType& hostAddress)
 {
-  errno = 0;
-  const struct sockaddr_in& hostAddress = m_hostAddress.getSockAddr();
+  return open(hostAddress, ConnectOptions{});
+}
 
-  if (-1 == ::connect(*m_socket,
-                      reinterpret_cast<const struct sockaddr*>(&hostAddress),
-                      sizeof(struct sockaddr_in)))
-    {
-      throw std::system_error{errno, std::generic_category()};
-    }
+// Unlike trying each address in turn, a blackholed address costs only the
+// attempt delay, rather than the kernel's SYN timeout.
+template<class HostType>
+Networking::FileDescriptor
+Networking::TCP::TCPClient<HostType>
+::open(const HostType& hostAddress, const ConnectOptions& connectOptions)
+{
+  return connectFirst(getAddresses(hostAddress), connectOptions.attemptDelay,
+                      connectOptions.attemptTimeout);
+}
 
-  m_userHandler(*m_socket);
+template<>
+inline std::vector<Networking::NetworkAddress>
+Networking::TCP::TCPClient<Networking::NetworkAddress>
+::getAddresses(const NetworkAddress& hostAddress)
+{
+  return {hostAddress};
 }
 
 template<>
-void Networking::TCP::TCPClient<Networking::NetworkHost>::connect()
+inline std::vector<Networking::NetworkAddress>
+Networking::TCP::TCPClient<Networking::NetworkHost>
+::getAddresses(const NetworkHost& hostAddress)
 {
-  std::string errorStack = "Host Connect Failures:";
+  return {hostAddress.begin(), hostAddress.end()};
+}
 
-  for (auto const& address : m_hostAddress)
-    {
-      const struct sockaddr& socketAddress
-        = reinterpret_cast<const struct sockaddr&>(address.getSockAddr());
-      errno = 0;
-      if (-1 == ::connect(*m_socket, &socketAddress,
-                          sizeof(struct sockaddr_in)))
-        {
-          errorStack += "\n" + address.string() + " (errno="
-            + std::to_string(errno) + ") " + std::string{strerror(errno)};
-        }
-      else
-        {
-          m_userHandler(*m_socket);
-          return;
-        }
-    }
+#ifdef NETWORKING_COROUTINES
+template<class HostType>
+Networking::Task<Networking::TCP::AsyncStream>
+Networking::TCP::TCPClient<HostType>::connect(EventLoop& loop) const
+{
+  return connect(loop, m_hostAddress);
+}
 
-  throw std::system_error{errno, std::generic_category(), errorStack};
+// The addresses are resolved now, so the task holds no reference to the
+// host.
+template<class HostType>
+Networking::Task<Networking::TCP::AsyncStream>
+Networking::TCP::TCPClient<HostType>::connect(EventLoop& loop,
+                                              const HostType& hostAddress)
+  const
+{
+  return Networking::TCP::connect(loop, getAddresses(hostAddress),
+                                  m_connectOptions.attemptTimeout);
 }
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
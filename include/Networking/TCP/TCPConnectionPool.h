@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TCPConnectionPool.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Pool of client connections, kept open between calls to
+//                  the same host so that each call does not pay for a new
+//                  handshake. Connections are checked out, and return to
+//                  the pool when the caller lets go of them.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_TCPCONNECTIONPOOL__
+#define __ET_TCPCONNECTIONPOOL__
+
+#include <namespaces/Networking.h>
+#include <Networking/FileDescriptor.h>
+#include <Networking/TCP/TCPClient.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+template<class HostType>
+class Networking::TCP::TCPConnectionPool
+{
+public:
+  // TCP keepalive probes, which let the kernel notice a peer that has gone
+  // away while a connection sits idle.
+  struct KeepAlive
+  {
+    bool enabled;
+    std::chrono::seconds idle;      // Before the first probe
+    std::chrono::seconds interval;  // Between probes
+    unsigned int count;             // Unanswered probes before giving up
+  };
+
+  struct Configuration
+  {
+    // Connections open to one host, whether checked out or idle. 0 means
+    // no limit.
+    std::size_t maxPerHost;
+    std::size_t maxIdlePerHost;
+    std::chrono::seconds maxIdleTime;
+    // How long checkout() waits for a host that is at its limit.
+    std::chrono::milliseconds checkoutTimeout;
+    KeepAlive keepAlive;
+    typename TCPClient<HostType>::ConnectOptions connectOptions;
+  };
+
+  struct Statistics
+  {
+    std::uint64_t created;
+    std::uint64_t reused;
+    std::uint64_t expired;     // Idle for longer than maxIdleTime
+    std::uint64_t evicted;     // Found closed by the peer
+    std::uint64_t waits;       // Checkouts that waited for a connection
+    std::uint64_t timeouts;    // Checkouts that gave up waiting
+    std::size_t idle;
+    std::size_t checkedOut;
+  };
+
+  class Connection;
+  class Builder;
+
+  TCPConnectionPool(Configuration configuration);
+
+  // Returns an idle connection to hostAddress, or opens a new one. If the
+  // host already has maxPerHost connections, waits for one to be returned,
+  // and throws std::system_error (ETIMEDOUT) if none is within the checkout
+  // timeout. May be called from any thread.
+  Connection checkout(const HostType& hostAddress);
+
+  // Closes the idle connections that have expired, or that the peer has
+  // closed. Checkout does the same for the host it is asked for, so this
+  // need only be called to release resources held for quiet hosts.
+  void evictDeadConnections();
+  void closeIdleConnections();
+
+  Statistics getStatistics() const;
+
+private:
+  struct Idle
+  {
+    FileDescriptor socket;
+    std::chrono::steady_clock::time_point since;
+  };
+
+  struct Host
+  {
+    // Least recently returned first.
+    std::deque<Idle> idle;
+    std::size_t checkedOut = 0;
+    // Per host, as each waiter is waiting on its own host's limit. (Hosts
+    // are never erased, so waiters may keep a reference.)
+    std::condition_variable returned;
+  };
+
+  // Shared with the connections, which may outlive the pool.
+  struct State
+  {
+    explicit State(Configuration configuration);
+    void checkin(const std::string& key, FileDescriptor socket, bool reuse);
+    bool isAlive(int socket) const;
+
+    const Configuration configuration;
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Host> hosts;
+    Statistics statistics;
+  };
+
+  void configure(int socket) const;
+
+  std::shared_ptr<State> m_state;
+};
+
+// A checked-out connection. Returns to the pool on destruction, unless it
+// has been discarded.
+template<class HostType>
+class Networking::TCP::TCPConnectionPool<HostType>::Connection
+{
+public:
+  Connection(Connection&&) noexcept = default;
+  Connection& operator=(Connection&&) noexcept;
+  Connection(const Connection&) = delete;
+  Connection& operator=(const Connection&) = delete;
+  ~Connection();
+
+  int get() const noexcept;
+  explicit operator bool() const noexcept;
+
+  // Call when the connection is in an unknown state (e.g. after a protocol
+  // error), so that it is closed rather than handed out again.
+  void discard() noexcept;
+
+private:
+  friend class TCPConnectionPool<HostType>;
+  Connection(std::shared_ptr<State> state, std::string key,
+             FileDescriptor socket);
+  void release() noexcept;
+
+  std::shared_ptr<State> m_state;
+  std::string m_key;
+  FileDescriptor m_socket;
+  bool m_reuse;
+};
+
+template<class HostType>
+class Networking::TCP::TCPConnectionPool<HostType>::Builder
+{
+public:
+  Builder setMaxConnectionsPerHost(std::size_t);
+  Builder setMaxIdlePerHost(std::size_t);
+  Builder setMaxIdleTime(std::chrono::seconds);
+  Builder setCheckoutTimeout(std::chrono::milliseconds);
+  Builder setKeepAlive(bool);
+  Builder setKeepAliveIdle(std::chrono::seconds);
+  Builder setKeepAliveInterval(std::chrono::seconds);
+  Builder setKeepAliveCount(unsigned int);
+  Builder setAttemptDelay(std::chrono::milliseconds);
+  Builder setAttemptTimeout(std::chrono::milliseconds);
+
+  TCPConnectionPool build() const;
+
+private:
+  Configuration configuration =
+    {16, 8, std::chrono::seconds{60}, std::chrono::seconds{5},
+     {true, std::chrono::seconds{30}, std::chrono::seconds{10}, 3}, {}};
+};
+
+#include <Networking/TCP/TCPConnectionPool.tcc>
+
+#endif // __ET_TCPCONNECTIONPOOL__
+
+///////////////////////////////////////////////////////////////////////////////
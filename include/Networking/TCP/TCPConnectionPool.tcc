@@ -0,0 +1,415 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TCPConnectionPool.tcc
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the TCP connection pool.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TCP/TCPConnectionPool.h>
+
+#include <system_error>
+#include <vector>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+
+template<class HostType>
+Networking::TCP::TCPConnectionPool<HostType>
+::TCPConnectionPool(Configuration configuration)
+  : m_state{std::make_shared<State>(configuration)}
+{}
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Connection
+Networking::TCP::TCPConnectionPool<HostType>
+::checkout(const HostType& hostAddress)
+{
+  State& state = *m_state;
+  const std::string key = hostAddress.string();
+  const auto deadline = std::chrono::steady_clock::now()
+    + state.configuration.checkoutTimeout;
+  bool waited = false;
+
+  // Declared before the lock, so that these are closed after it is released.
+  std::vector<Idle> expired;
+  std::unique_lock<std::mutex> lock{state.mutex};
+  for (;;)
+    {
+      Host& host = state.hosts[key];
+      const auto now = std::chrono::steady_clock::now();
+      while (!host.idle.empty() && now - host.idle.front().since
+             >= state.configuration.maxIdleTime)
+        {
+          expired.push_back(std::move(host.idle.front()));
+          host.idle.pop_front();
+          ++state.statistics.expired;
+        }
+
+      if (!host.idle.empty())
+        {
+          // The most recently used connection is the likeliest to be alive.
+          FileDescriptor socket = std::move(host.idle.back().socket);
+          host.idle.pop_back();
+          ++host.checkedOut;
+          lock.unlock();
+
+          if (state.isAlive(socket.get()))
+            {
+              lock.lock();
+              ++state.statistics.reused;
+              return Connection{m_state, key, std::move(socket)};
+            }
+
+          socket.reset();
+          lock.lock();
+          --host.checkedOut;
+          ++state.statistics.evicted;
+          continue;
+        }
+
+      if (0 == state.configuration.maxPerHost
+          || host.checkedOut < state.configuration.maxPerHost)
+        {
+          ++host.checkedOut;
+          lock.unlock();
+
+          try
+            {
+              FileDescriptor socket = TCPClient<HostType>::open
+                (hostAddress, state.configuration.connectOptions);
+              configure(socket.get());
+              lock.lock();
+              ++state.statistics.created;
+              return Connection{m_state, key, std::move(socket)};
+            }
+          catch (...)
+            {
+              lock.lock();
+              --host.checkedOut;
+              host.returned.notify_one();
+              throw;
+            }
+        }
+
+      if (!waited)
+        {
+          waited = true;
+          ++state.statistics.waits;
+        }
+      if (std::cv_status::timeout == host.returned.wait_until(lock,
+                                                              deadline))
+        {
+          ++state.statistics.timeouts;
+          throw std::system_error{ETIMEDOUT, std::generic_category(),
+              "Timed out waiting for a connection to " + key};
+        }
+    }
+}
+
+template<class HostType>
+void Networking::TCP::TCPConnectionPool<HostType>::evictDeadConnections()
+{
+  State& state = *m_state;
+  std::vector<Idle> candidates;
+  {
+    std::lock_guard<std::mutex> lock{state.mutex};
+    const auto now = std::chrono::steady_clock::now();
+    for (auto& host : state.hosts)
+      {
+        std::deque<Idle> kept;
+        for (Idle& idle : host.second.idle)
+          {
+            if (now - idle.since >= state.configuration.maxIdleTime)
+              {
+                ++state.statistics.expired;
+              }
+            else if (!state.isAlive(idle.socket.get()))
+              {
+                ++state.statistics.evicted;
+              }
+            else
+              {
+                kept.push_back(std::move(idle));
+                continue;
+              }
+            candidates.push_back(std::move(idle));
+          }
+        host.second.idle.swap(kept);
+      }
+  }
+  // The sockets in candidates are closed here, once the lock is released.
+}
+
+template<class HostType>
+void Networking::TCP::TCPConnectionPool<HostType>::closeIdleConnections()
+{
+  State& state = *m_state;
+  std::vector<Idle> closed;
+  {
+    std::lock_guard<std::mutex> lock{state.mutex};
+    for (auto& host : state.hosts)
+      {
+        for (Idle& idle : host.second.idle)
+          {
+            closed.push_back(std::move(idle));
+          }
+        host.second.idle.clear();
+      }
+  }
+}
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Statistics
+Networking::TCP::TCPConnectionPool<HostType>::getStatistics() const
+{
+  std::lock_guard<std::mutex> lock{m_state->mutex};
+  Statistics statistics = m_state->statistics;
+  statistics.idle = 0;
+  statistics.checkedOut = 0;
+  for (const auto& host : m_state->hosts)
+    {
+      statistics.idle += host.second.idle.size();
+      statistics.checkedOut += host.second.checkedOut;
+    }
+  return statistics;
+}
+
+template<class HostType>
+void Networking::TCP::TCPConnectionPool<HostType>::configure(int socket) const
+{
+  const KeepAlive& keepAlive = m_state->configuration.keepAlive;
+  const int enabled = keepAlive.enabled ? 1 : 0;
+  errno = 0;
+  if (-1 == setsockopt(socket, SOL_SOCKET, SO_KEEPALIVE, &enabled,
+                       sizeof(enabled)))
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+  if (!keepAlive.enabled)
+    {
+      return;
+    }
+
+  const int idle = static_cast<int>(keepAlive.idle.count());
+  const int interval = static_cast<int>(keepAlive.interval.count());
+  const int count = static_cast<int>(keepAlive.count);
+  if (-1 == setsockopt(socket, IPPROTO_TCP, TCP_KEEPIDLE, &idle,
+                       sizeof(idle))
+      || -1 == setsockopt(socket, IPPROTO_TCP, TCP_KEEPINTVL, &interval,
+                          sizeof(interval))
+      || -1 == setsockopt(socket, IPPROTO_TCP, TCP_KEEPCNT, &count,
+                          sizeof(count)))
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// TCPConnectionPool::State
+////
+
+template<class HostType>
+Networking::TCP::TCPConnectionPool<HostType>::State
+::State(Configuration configuration)
+  : configuration{configuration}, statistics{}
+{}
+
+template<class HostType>
+void Networking::TCP::TCPConnectionPool<HostType>::State
+::checkin(const std::string& key, FileDescriptor socket, bool reuse)
+{
+  FileDescriptor closed;
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    Host& host = hosts[key];
+    --host.checkedOut;
+    if (reuse && host.idle.size() < configuration.maxIdlePerHost)
+      {
+        host.idle.push_back(Idle{std::move(socket),
+                                 std::chrono::steady_clock::now()});
+      }
+    else
+      {
+        closed = std::move(socket);
+      }
+    host.returned.notify_one();
+  }
+}
+
+// A connection is alive if the peer has neither closed it nor sent anything
+// on it while it sat idle. Unsolicited data means the connection is out of
+// step with the peer's protocol, so it cannot be handed out either.
+template<class HostType>
+bool Networking::TCP::TCPConnectionPool<HostType>::State
+::isAlive(int socket) const
+{
+  struct pollfd pending{socket, POLLIN, 0};
+  const int ready = ::poll(&pending, 1, 0);
+  if (0 == ready)
+    {
+      return true;
+    }
+  else if (-1 == ready)
+    {
+      return false;
+    }
+
+  char byte = 0;
+  return -1 == ::recv(socket, &byte, 1, MSG_PEEK | MSG_DONTWAIT)
+    && (EAGAIN == errno || EWOULDBLOCK == errno);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// TCPConnectionPool::Connection
+////
+
+template<class HostType>
+Networking::TCP::TCPConnectionPool<HostType>::Connection
+::Connection(std::shared_ptr<State> state, std::string key,
+             FileDescriptor socket)
+  : m_state{std::move(state)}, m_key{std::move(key)},
+    m_socket{std::move(socket)}, m_reuse{true}
+{}
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Connection&
+Networking::TCP::TCPConnectionPool<HostType>::Connection
+::operator=(Connection&& that) noexcept
+{
+  if (this != &that)
+    {
+      release();
+      m_state = std::move(that.m_state);
+      m_key = std::move(that.m_key);
+      m_socket = std::move(that.m_socket);
+      m_reuse = that.m_reuse;
+    }
+  return *this;
+}
+
+template<class HostType>
+Networking::TCP::TCPConnectionPool<HostType>::Connection::~Connection()
+{
+  release();
+}
+
+template<class HostType>
+int Networking::TCP::TCPConnectionPool<HostType>::Connection::get()
+  const noexcept
+{
+  return m_socket.get();
+}
+
+template<class HostType>
+Networking::TCP::TCPConnectionPool<HostType>::Connection
+::operator bool() const noexcept
+{
+  return static_cast<bool>(m_socket);
+}
+
+template<class HostType>
+void Networking::TCP::TCPConnectionPool<HostType>::Connection::discard()
+  noexcept
+{
+  m_reuse = false;
+}
+
+template<class HostType>
+void Networking::TCP::TCPConnectionPool<HostType>::Connection::release()
+  noexcept
+{
+  if (nullptr == m_state)
+    {
+      return;
+    }
+
+  try
+    {
+      m_state->checkin(m_key, std::move(m_socket), m_reuse);
+    }
+  catch (...)
+    {
+      // The socket has been closed; only the bookkeeping is lost.
+    }
+  m_state.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// TCPConnectionPool::Builder
+////
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Builder
+Networking::TCP::TCPConnectionPool<HostType>::Builder
+::setMaxConnectionsPerHost(std::size_t maxPerHost)
+{ configuration.maxPerHost = maxPerHost; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Builder
+Networking::TCP::TCPConnectionPool<HostType>::Builder
+::setMaxIdlePerHost(std::size_t maxIdlePerHost)
+{ configuration.maxIdlePerHost = maxIdlePerHost; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Builder
+Networking::TCP::TCPConnectionPool<HostType>::Builder
+::setMaxIdleTime(std::chrono::seconds maxIdleTime)
+{ configuration.maxIdleTime = maxIdleTime; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Builder
+Networking::TCP::TCPConnectionPool<HostType>::Builder
+::setCheckoutTimeout(std::chrono::milliseconds checkoutTimeout)
+{ configuration.checkoutTimeout = checkoutTimeout; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Builder
+Networking::TCP::TCPConnectionPool<HostType>::Builder
+::setKeepAlive(bool enabled)
+{ configuration.keepAlive.enabled = enabled; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Builder
+Networking::TCP::TCPConnectionPool<HostType>::Builder
+::setKeepAliveIdle(std::chrono::seconds idle)
+{ configuration.keepAlive.idle = idle; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Builder
+Networking::TCP::TCPConnectionPool<HostType>::Builder
+::setKeepAliveInterval(std::chrono::seconds interval)
+{ configuration.keepAlive.interval = interval; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Builder
+Networking::TCP::TCPConnectionPool<HostType>::Builder
+::setKeepAliveCount(unsigned int count)
+{ configuration.keepAlive.count = count; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Builder
+Networking::TCP::TCPConnectionPool<HostType>::Builder
+::setAttemptDelay(std::chrono::milliseconds attemptDelay)
+{ configuration.connectOptions.attemptDelay = attemptDelay; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TCPConnectionPool<HostType>::Builder
+Networking::TCP::TCPConnectionPool<HostType>::Builder
+::setAttemptTimeout(std::chrono::milliseconds attemptTimeout)
+{ configuration.connectOptions.attemptTimeout = attemptTimeout; return *this; }
+
+template<class HostType>
+Networking::TCP::TCPConnectionPool<HostType>
+Networking::TCP::TCPConnectionPool<HostType>::Builder::build() const
+{
+  return TCPConnectionPool<HostType>{configuration};
+}
+
+///////////////////////////////////////////////////////////////////////////////
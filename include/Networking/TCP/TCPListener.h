@@ -7,7 +7,7 @@
 //
 // CREATED:         04/02/2020
 //
-// LAST EDITED:     04/21/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_TCPLISTENER__
@@ -15,48 +15,105 @@
 
 #include <namespaces/Networking.h>
 
+#include <Networking/FileDescriptor.h>
 #include <Networking/Interfaces/IListener.h>
+#include <Networking/PeerAddress.h>
+#include <Networking/TCP/ConnectionTimeouts.h>
 
 #include <functional>
 #include <memory>
 #include <iostream>
+#include <optional>
+#include <vector>
 
-struct sockaddr;
 
-template<class HostType>
+// Handler is called as void(unsigned int socket, const PeerAddress&), or as
+// void(unsigned int socket, const HostType&) if it cannot take the former.
+// With C++20, it may instead be a coroutine taking an AsyncStream in place
+// of the socket, which must be run by an EventLoop (see TCPRequest.h).
+template<class HostType, class Handler>
 class Networking::TCP::TCPListener : public Networking::Interfaces::IListener
 {
 public:
   TCPListener(HostType acceptedClients, unsigned int theBacklogSize,
-              bool reuseAddress, bool blocking, bool maskSigPipe,
-              std::function<void(unsigned int,const HostType&)> userHandler,
-              std::function<void(const std::string&)> logStream);
+              bool reuseAddress, bool reusePort, bool v6Only, bool blocking,
+              bool maskSigPipe, Handler userHandler,
+              std::function<void(const std::string&)> logStream,
+              ConnectionTimeouts timeouts);
 
+  // If the listener is non-blocking, the sockets it accepts are, too.
   virtual std::unique_ptr<Interfaces::IRequest> listen() final override;
+  virtual std::size_t
+  listenBatch(std::vector<std::unique_ptr<Interfaces::IRequest>>& batch,
+              std::size_t maxBatchSize) final override;
+  virtual std::unique_ptr<Interfaces::IRequest> adopt(int socket)
+    final override;
+  virtual int getDescriptor() const final override;
+  virtual void shutdown() final override;
 
   class Builder;
 
 private:
-  int getConfiguredSocket(bool reuseAddress, bool blocking) const;
-  void doBind() const;
+  FileDescriptor getConfiguredSocket(int family, bool reuseAddress,
+                                     bool reusePort, bool v6Only,
+                                     bool blocking) const;
+  int acceptSocket(PeerAddress& connectingEntity) const;
+  // One call to accept(2), retried if the connection was aborted.
+  int acceptFrom(int listeningSocket, PeerAddress& connectingEntity) const;
+  std::unique_ptr<Interfaces::IRequest>
+  makeRequest(int receivingSocket, const PeerAddress& connectingEntity);
+  std::vector<FileDescriptor>
+  bindAll(const NetworkHost& host, bool reuseAddress, bool reusePort,
+          bool v6Only, bool blocking) const;
+  std::vector<FileDescriptor>
+  bindAll(const NetworkAddress& address, bool reuseAddress, bool reusePort,
+          bool v6Only, bool blocking) const;
+  FileDescriptor bindTo(const NetworkAddress& address, bool reuseAddress,
+                        bool reusePort, bool v6Only, bool blocking) const;
 
   HostType m_listeningAddress;
-  std::function<void(unsigned int,const HostType&)> m_userHandler;
+  Handler m_userHandler;
   std::function<void(const std::string&)> m_logStream;
+  // The only socket, or an epoll instance gathering several.
   std::shared_ptr<int> m_listeningSocket;
+  // Each bound to one address of the host, if there are several. They are
+  // always non-blocking: listen() waits on m_listeningSocket instead.
+  std::shared_ptr<std::vector<FileDescriptor>> m_boundSockets;
+  mutable std::size_t m_nextSocket;
+  // Shared by copies of the listener; outlives it while requests remain.
+  std::shared_ptr<RequestPool> m_requestPool;
+  bool m_blocking;
+  ConnectionTimeouts m_timeouts;
+  // Keeps the idle timeouts of a blocking listener's connections.
+  std::shared_ptr<TimerThread> m_timerThread;
 };
 
-template<class HostType>
-class Networking::TCP::TCPListener<HostType>::Builder
+template<class HostType, class Handler>
+class Networking::TCP::TCPListener<HostType, Handler>::Builder
 {
 public:
   Builder();
+  // A NetworkHost is listened on at every address it resolves to (e.g. at
+  // both 127.0.0.1 and ::1 for "localhost"), with a socket for each.
   Builder setListeningAddress(HostType);
   Builder setBacklogSize(unsigned int);
   Builder setReuseAddress(bool);
+  // Allow several sockets to bind the same address, so that the kernel
+  // balances incoming connections between them (SO_REUSEPORT).
+  Builder setReusePort(bool);
+  // Whether a listener bound to an IPv6 address accepts only IPv6
+  // connections. If not (the default), one bound to the IPv6 wildcard
+  // ("::") serves IPv4 clients as well, as IPv4-mapped addresses.
+  Builder setV6Only(bool);
   Builder setBlocking(bool);
   Builder setMaskSigPipe(bool);
-  using UserHandler = std::function<void(unsigned int,const HostType&)>;
+  // How long a connection may stall before it is closed (see
+  // ConnectionTimeouts.h). Not enforced by default. With an idle timeout,
+  // a blocking listener starts a TimerThread to keep it.
+  Builder setTimeouts(ConnectionTimeouts);
+  // Required, unless Handler can be constructed from a function pointer
+  // (in which case it defaults to doing nothing).
+  using UserHandler = Handler;
   Builder setUserHandler(UserHandler userHandler);
   Builder setLogStream(std::function<void(const std::string&)> logStream);
 
@@ -66,9 +123,12 @@ private:
   HostType listeningAddress;
   unsigned int backlogSize = 8;
   bool reuseAddress = true;
+  bool reusePort = false;
+  bool v6Only = false;
   bool blocking = true;
   bool maskSigPipe = true;
-  UserHandler userHandler = [](unsigned int,const HostType&){ return; };
+  ConnectionTimeouts timeouts = {};
+  std::optional<UserHandler> userHandler;
   std::function<void(const std::string&)> logStream =
     [](const std::string& message)
   {
@@ -7,34 +7,58 @@
 //
 // CREATED:         04/02/2020
 //
-// LAST EDITED:     05/01/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #include <Networking/TCP/TCPListener.h>
+#include <Networking/FileDescriptor.h>
+#include <Networking/NetworkAddress.h>
+#include <Networking/NetworkHost.h>
+#include <Networking/PeerAddress.h>
+#include <Networking/RequestPool.h>
 #include <Networking/TCP/TCPRequest.h>
+#include <Networking/TimerThread.h>
 
 #include <fcntl.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/epoll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
 #include <system_error>
+#include <type_traits>
+#include <utility>
 
-template<class HostType>
-Networking::TCP::TCPListener<HostType>
+template<class HostType, class Handler>
+Networking::TCP::TCPListener<HostType, Handler>
 ::TCPListener(HostType acceptedClients, unsigned int theBacklogSize,
-              bool reuseAddress, bool blocking, bool maskSigPipe,
-              std::function<void(unsigned int,const HostType&)> userHandler,
-              std::function<void(const std::string&)> logStream)
-  : m_listeningAddress{acceptedClients}, m_userHandler{userHandler},
-    m_logStream{logStream}
+              bool reuseAddress, bool reusePort, bool v6Only, bool blocking,
+              bool maskSigPipe, Handler userHandler,
+              std::function<void(const std::string&)> logStream,
+              ConnectionTimeouts timeouts)
+  : m_listeningAddress{acceptedClients},
+    m_userHandler{std::move(userHandler)}, m_logStream{logStream},
+    m_nextSocket{0}, m_requestPool{RequestPool::create
+        (sizeof(TCPRequest<HostType, Handler>))},
+    m_blocking{blocking}, m_timeouts{timeouts}
 {
+  // The connections of a non-blocking listener are watched by their loop.
+  if (blocking && 0 < m_timeouts.idle.count())
+    {
+      m_timerThread = std::make_shared<TimerThread>
+        (std::chrono::milliseconds{10}, logStream);
+    }
+
   m_listeningSocket
-    = std::shared_ptr<int>(new int, [maskSigPipe](int *pInt) {
+    = std::shared_ptr<int>(new int{-1}, [maskSigPipe](int *pInt) {
         ::close(*pInt);
         if (maskSigPipe)
           {
@@ -50,71 +74,169 @@ Networking::TCP::TCPListener<HostType>
           __FILE__ ": Could not mask SIGPIPE"};
     }
 
-  *m_listeningSocket = getConfiguredSocket(reuseAddress, blocking);
+  std::vector<FileDescriptor> sockets = bindAll
+    (m_listeningAddress, reuseAddress, reusePort, v6Only, blocking);
+  for (const FileDescriptor& socket : sockets)
+    {
+      if (0 != ::listen(socket.get(), theBacklogSize))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+    }
 
-  doBind();
+  if (1 == sockets.size())
+    {
+      *m_listeningSocket = sockets.front().release();
+      return;
+    }
 
-  if (0 != ::listen(*m_listeningSocket, theBacklogSize))
+  *m_listeningSocket = ::epoll_create1(EPOLL_CLOEXEC);
+  if (-1 == *m_listeningSocket
+      || (!blocking && -1 == ::fcntl(*m_listeningSocket, F_SETFL,
+                                     O_NONBLOCK)))
     {
       throw std::system_error{errno, std::generic_category()};
     }
+  for (const FileDescriptor& socket : sockets)
+    {
+      struct epoll_event event = {};
+      event.events = EPOLLIN;
+      event.data.fd = socket.get();
+      if (-1 == ::epoll_ctl(*m_listeningSocket, EPOLL_CTL_ADD, socket.get(),
+                            &event)
+          || -1 == ::fcntl(socket.get(), F_SETFL, O_NONBLOCK))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+    }
+  m_boundSockets = std::make_shared<std::vector<FileDescriptor>>
+    (std::move(sockets));
 }
 
-template<>
-void Networking::TCP::TCPListener<Networking::NetworkHost>
-::doBind() const
+// Binds each of the addresses of the host that can be bound, so that a host
+// with addresses of both families serves both IPv4 and IPv6 clients.
+template<class HostType, class Handler>
+std::vector<Networking::FileDescriptor>
+Networking::TCP::TCPListener<HostType, Handler>
+::bindAll(const NetworkHost& host, bool reuseAddress, bool reusePort,
+          bool v6Only, bool blocking) const
 {
-  const size_t sockLen = sizeof(struct sockaddr_in);
-  for (auto const& address : m_listeningAddress)
+  std::vector<NetworkAddress> addresses;
+  bool hasIPv4 = false;
+  for (auto const& address : host)
     {
-      if (0 == ::bind(*m_listeningSocket,
-                      reinterpret_cast<const struct sockaddr*>
-                      (&address.getSockAddr()),
-                      sockLen))
+      if (addresses.end() == std::find(addresses.begin(), addresses.end(),
+                                       address))
         {
-          return;
+          addresses.push_back(address);
+          hasIPv4 = hasIPv4 || AF_INET == address.getFamily();
         }
     }
-  throw std::system_error{errno, std::generic_category()};
+
+  std::vector<FileDescriptor> sockets;
+  std::vector<std::string> failures;
+  int error = EADDRNOTAVAIL;
+  for (auto const& address : addresses)
+    {
+      try
+        {
+          // The IPv4 addresses have sockets of their own, which "::" would
+          // otherwise conflict with.
+          sockets.push_back(bindTo(address, reuseAddress, reusePort,
+                                   v6Only || (hasIPv4 && AF_INET6
+                                              == address.getFamily()),
+                                   blocking));
+        }
+      catch (const std::system_error& e)
+        {
+          error = e.code().value();
+          failures.push_back("TCPListener: could not bind "
+                             + address.string() + ": " + e.what());
+        }
+    }
+
+  if (sockets.empty())
+    {
+      throw std::system_error{error, std::generic_category()};
+    }
+  // e.g. ::1 on a machine without IPv6. The listener goes on without it.
+  for (const std::string& failure : failures)
+    {
+      m_logStream(failure);
+    }
+  return sockets;
+}
+
+template<class HostType, class Handler>
+std::vector<Networking::FileDescriptor>
+Networking::TCP::TCPListener<HostType, Handler>
+::bindAll(const NetworkAddress& address, bool reuseAddress, bool reusePort,
+          bool v6Only, bool blocking) const
+{
+  std::vector<FileDescriptor> sockets;
+  sockets.push_back(bindTo(address, reuseAddress, reusePort, v6Only,
+                           blocking));
+  return sockets;
 }
 
-template<>
-void Networking::TCP::TCPListener<Networking::NetworkAddress>
-::doBind() const
+template<class HostType, class Handler>
+Networking::FileDescriptor Networking::TCP::TCPListener<HostType, Handler>
+::bindTo(const NetworkAddress& address, bool reuseAddress, bool reusePort,
+         bool v6Only, bool blocking) const
 {
-  const size_t sockLen = sizeof(struct sockaddr_in);
-  if (-1 == ::bind(*m_listeningSocket,
-                   reinterpret_cast<const struct sockaddr*>
-                   (&m_listeningAddress.getSockAddr()),
-                   sockLen))
+  FileDescriptor theSocket = getConfiguredSocket
+    (address.getFamily(), reuseAddress, reusePort, v6Only, blocking);
+  if (-1 == ::bind(theSocket.get(), address.getSockAddr(),
+                   address.getSockAddrLength()))
     {
       throw std::system_error{errno, std::generic_category()};
     }
+  return theSocket;
 }
 
-template<class HostType>
-int Networking::TCP::TCPListener<HostType>
-::getConfiguredSocket(bool reuseAddress, bool blocking) const
+template<class HostType, class Handler>
+Networking::FileDescriptor Networking::TCP::TCPListener<HostType, Handler>
+::getConfiguredSocket(int family, bool reuseAddress, bool reusePort,
+                      bool v6Only, bool blocking) const
 {
   errno = 0;
-  int theSocket = 0;
-  // TODO: Enable IPv6
-  if (-1 == (theSocket = ::socket(PF_INET, SOCK_STREAM, 0)))
+  FileDescriptor theSocket{::socket(family, SOCK_STREAM, 0)};
+  if (!theSocket)
     {
       throw std::system_error{errno, std::generic_category()};
     }
 
   // Set the socket to reuse local addresses (or not)
   int optVal = reuseAddress;
-  if (-1 == ::setsockopt(theSocket, SOL_SOCKET, SO_REUSEADDR,
+  if (-1 == ::setsockopt(theSocket.get(), SOL_SOCKET, SO_REUSEADDR,
                          reinterpret_cast<const void*>(&optVal),
                          sizeof(optVal)))
     {
       throw std::system_error{errno, std::generic_category()};
     }
 
+  // Set the socket to share its port with other sockets (or not)
+  optVal = reusePort;
+  if (-1 == ::setsockopt(theSocket.get(), SOL_SOCKET, SO_REUSEPORT,
+                         reinterpret_cast<const void*>(&optVal),
+                         sizeof(optVal)))
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+
+  // Set an IPv6 socket to accept IPv4 connections, too (or not). This is
+  // set explicitly, rather than left to the net.ipv6.bindv6only sysctl.
+  optVal = v6Only;
+  if (AF_INET6 == family
+      && -1 == ::setsockopt(theSocket.get(), IPPROTO_IPV6, IPV6_V6ONLY,
+                            reinterpret_cast<const void*>(&optVal),
+                            sizeof(optVal)))
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+
   // Set the socket to blocking/non-blocking
-  if (!blocking && -1 == ::fcntl(theSocket, F_SETFL, O_NONBLOCK))
+  if (!blocking && -1 == ::fcntl(theSocket.get(), F_SETFL, O_NONBLOCK))
     {
       throw std::system_error{errno, std::generic_category()};
     }
@@ -122,33 +244,176 @@ int Networking::TCP::TCPListener<HostType>
   return theSocket;
 }
 
-template<class HostType>
+template<class HostType, class Handler>
 std::unique_ptr<Networking::Interfaces::IRequest>
-Networking::TCP::TCPListener<HostType>::listen()
+Networking::TCP::TCPListener<HostType, Handler>::listen()
 {
-  int receivingSocket = -1;
-  struct sockaddr_in connectingEntity;
-  size_t addrSize = sizeof(struct sockaddr_in);
-
-  memset(&connectingEntity, 0, sizeof(connectingEntity));
-  if (-1 == (receivingSocket = ::accept
-             (*m_listeningSocket,
-              reinterpret_cast<struct sockaddr*>(&connectingEntity),
-              reinterpret_cast<socklen_t*>(&addrSize))))
+  PeerAddress connectingEntity;
+  int receivingSocket = acceptSocket(connectingEntity);
+  if (-1 == receivingSocket)
     {
-      throw std::system_error{errno, std::generic_category()};
+      return nullptr;
     }
+  return makeRequest(receivingSocket, connectingEntity);
+}
 
-  try
+template<class HostType, class Handler>
+std::size_t
+Networking::TCP::TCPListener<HostType, Handler>
+::listenBatch(std::vector<std::unique_ptr<Interfaces::IRequest>>& batch,
+              std::size_t maxBatchSize)
+{
+  // Stop at the end of the backlog (or after one connection, if blocking).
+  const std::size_t limit = m_blocking ? 1 : maxBatchSize;
+  std::size_t accepted = 0;
+  PeerAddress connectingEntity;
+  while (accepted < limit)
     {
-      return std::make_unique<TCP::TCPRequest<HostType>>
-        (receivingSocket, HostType{connectingEntity}, m_userHandler,
-         m_logStream);
+      // An error leaves what has been accepted so far in the batch.
+      const int receivingSocket = acceptSocket(connectingEntity);
+      if (-1 == receivingSocket)
+        {
+          break;
+        }
+
+      batch.push_back(makeRequest(receivingSocket, connectingEntity));
+      ++accepted;
     }
-  catch (const std::bad_alloc& e)
+  return accepted;
+}
+
+template<class HostType, class Handler>
+std::unique_ptr<Networking::Interfaces::IRequest>
+Networking::TCP::TCPListener<HostType, Handler>::adopt(int receivingSocket)
+{
+  PeerAddress connectingEntity;
+  if (-1 == ::getpeername(receivingSocket, connectingEntity.getSockAddr(),
+                          &connectingEntity.getLength()))
     {
+      const int error = errno;
       ::close(receivingSocket);
-      throw;
+      throw std::system_error{error, std::generic_category()};
+    }
+  return makeRequest(receivingSocket, connectingEntity);
+}
+
+// Returns -1 if the listener is non-blocking and no connection is pending.
+template<class HostType, class Handler>
+int Networking::TCP::TCPListener<HostType, Handler>
+::acceptSocket(PeerAddress& connectingEntity) const
+{
+  if (!m_boundSockets)
+    {
+      const int receivingSocket = acceptFrom(*m_listeningSocket,
+                                             connectingEntity);
+      if (-1 == receivingSocket
+          && (m_blocking || (EAGAIN != errno && EWOULDBLOCK != errno)))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+      return receivingSocket;
+    }
+
+  // Take from each socket in turn, so that none is starved.
+  const std::size_t count = m_boundSockets->size();
+  while (1)
+    {
+      for (std::size_t i = 0; i < count; ++i)
+        {
+          const int listeningSocket = (*m_boundSockets)[m_nextSocket].get();
+          m_nextSocket = (m_nextSocket + 1) % count;
+          const int receivingSocket = acceptFrom(listeningSocket,
+                                                 connectingEntity);
+          if (-1 != receivingSocket)
+            {
+              return receivingSocket;
+            }
+          else if (EAGAIN != errno && EWOULDBLOCK != errno)
+            {
+              throw std::system_error{errno, std::generic_category()};
+            }
+        }
+
+      if (!m_blocking)
+        {
+          return -1;
+        }
+
+      // Another process sharing the listener may take the connection first,
+      // and so the sockets are only ever tried without blocking.
+      struct pollfd ready = {*m_listeningSocket, POLLIN, 0};
+      if (-1 == ::poll(&ready, 1, -1) && EINTR != errno)
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+    }
+}
+
+// Returns -1, with errno set, if accept(2) fails.
+template<class HostType, class Handler>
+int Networking::TCP::TCPListener<HostType, Handler>
+::acceptFrom(int listeningSocket, PeerAddress& connectingEntity) const
+{
+  int receivingSocket = -1;
+  while (1)
+    {
+      connectingEntity = PeerAddress{};
+#ifdef SOCK_NONBLOCK
+      receivingSocket = ::accept4
+        (listeningSocket, connectingEntity.getSockAddr(),
+         &connectingEntity.getLength(),
+         SOCK_CLOEXEC | (m_blocking ? 0 : SOCK_NONBLOCK));
+#else
+      receivingSocket = ::accept
+        (listeningSocket, connectingEntity.getSockAddr(),
+         &connectingEntity.getLength());
+      if (-1 != receivingSocket && !m_blocking
+          && -1 == ::fcntl(receivingSocket, F_SETFL, O_NONBLOCK))
+        {
+          ::close(receivingSocket);
+          receivingSocket = -1;
+        }
+#endif
+      // The connection was reset while in the backlog. Try the next one.
+      if (-1 != receivingSocket || ECONNABORTED != errno)
+        {
+          break;
+        }
+    }
+  return receivingSocket;
+}
+
+template<class HostType, class Handler>
+std::unique_ptr<Networking::Interfaces::IRequest>
+Networking::TCP::TCPListener<HostType, Handler>
+::makeRequest(int receivingSocket, const PeerAddress& connectingEntity)
+{
+  // Owned from here on, so that it is closed if anything below throws.
+  FileDescriptor socket{receivingSocket};
+  return std::unique_ptr<Interfaces::IRequest>
+    {new (*m_requestPool) TCPRequest<HostType, Handler>
+        {std::move(socket), connectingEntity, m_userHandler, m_timeouts,
+            m_timerThread.get()}};
+}
+
+template<class HostType, class Handler>
+int Networking::TCP::TCPListener<HostType, Handler>::getDescriptor() const
+{
+  return *m_listeningSocket;
+}
+
+template<class HostType, class Handler>
+void Networking::TCP::TCPListener<HostType, Handler>::shutdown()
+{
+  if (!m_boundSockets)
+    {
+      ::shutdown(*m_listeningSocket, SHUT_RDWR);
+      return;
+    }
+
+  for (const FileDescriptor& socket : *m_boundSockets)
+    {
+      ::shutdown(socket.get(), SHUT_RDWR);
     }
 }
 
@@ -156,60 +421,89 @@ Networking::TCP::TCPListener<HostType>::listen()
 // TCPListener::Builder
 ////
 
-template<class HostType>
-Networking::TCP::TCPListener<HostType>::Builder
+template<class HostType, class Handler>
+Networking::TCP::TCPListener<HostType, Handler>::Builder
 ::Builder()
   : listeningAddress{"127.0.0.1", 80}
-{}
+{
+  using NoHandler = void(*)(unsigned int,const HostType&);
+  if constexpr (std::is_constructible_v<UserHandler, NoHandler>)
+    {
+      userHandler.emplace(NoHandler{[](unsigned int,const HostType&){}});
+    }
+}
 
-template<class HostType>
-typename Networking::TCP::TCPListener<HostType>::Builder
-Networking::TCP::TCPListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TCPListener<HostType, Handler>::Builder
+Networking::TCP::TCPListener<HostType, Handler>::Builder
 ::setListeningAddress(HostType theListeningAddress)
 { listeningAddress = theListeningAddress; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TCPListener<HostType>::Builder
-Networking::TCP::TCPListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TCPListener<HostType, Handler>::Builder
+Networking::TCP::TCPListener<HostType, Handler>::Builder
 ::setBacklogSize(unsigned int theBacklogSize)
 { backlogSize = theBacklogSize; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TCPListener<HostType>::Builder
-Networking::TCP::TCPListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TCPListener<HostType, Handler>::Builder
+Networking::TCP::TCPListener<HostType, Handler>::Builder
 ::setReuseAddress(bool isReuseAddress)
 { reuseAddress = isReuseAddress; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TCPListener<HostType>::Builder
-Networking::TCP::TCPListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TCPListener<HostType, Handler>::Builder
+Networking::TCP::TCPListener<HostType, Handler>::Builder
+::setReusePort(bool isReusePort)
+{ reusePort = isReusePort; return *this; }
+
+template<class HostType, class Handler>
+typename Networking::TCP::TCPListener<HostType, Handler>::Builder
+Networking::TCP::TCPListener<HostType, Handler>::Builder
+::setV6Only(bool isV6Only)
+{ v6Only = isV6Only; return *this; }
+
+template<class HostType, class Handler>
+typename Networking::TCP::TCPListener<HostType, Handler>::Builder
+Networking::TCP::TCPListener<HostType, Handler>::Builder
 ::setBlocking(bool isBlocking)
 { blocking = isBlocking; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TCPListener<HostType>::Builder
-Networking::TCP::TCPListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TCPListener<HostType, Handler>::Builder
+Networking::TCP::TCPListener<HostType, Handler>::Builder
 ::setMaskSigPipe(bool theMaskSigPipe)
 { maskSigPipe = theMaskSigPipe; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TCPListener<HostType>::Builder
-Networking::TCP::TCPListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TCPListener<HostType, Handler>::Builder
+Networking::TCP::TCPListener<HostType, Handler>::Builder
+::setTimeouts(ConnectionTimeouts theTimeouts)
+{ timeouts = theTimeouts; return *this; }
+
+template<class HostType, class Handler>
+typename Networking::TCP::TCPListener<HostType, Handler>::Builder
+Networking::TCP::TCPListener<HostType, Handler>::Builder
 ::setUserHandler(UserHandler theUserHandler)
-{ userHandler = theUserHandler; return *this; }
+{ userHandler.emplace(std::move(theUserHandler)); return *this; }
 
-template<class HostType>
-typename Networking::TCP::TCPListener<HostType>::Builder
-Networking::TCP::TCPListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TCPListener<HostType, Handler>::Builder
+Networking::TCP::TCPListener<HostType, Handler>::Builder
 ::setLogStream(std::function<void(const std::string&)> theLogStream)
 { logStream = theLogStream; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TCPListener<HostType>
-Networking::TCP::TCPListener<HostType>::Builder::build() const
+template<class HostType, class Handler>
+typename Networking::TCP::TCPListener<HostType, Handler>
+Networking::TCP::TCPListener<HostType, Handler>::Builder::build() const
 {
-  return TCPListener{listeningAddress, backlogSize, reuseAddress, blocking,
-      maskSigPipe, userHandler, logStream};
+  if (!userHandler)
+    {
+      throw std::logic_error{"TCPListener::Builder: a user handler is"
+          " required for this handler type"};
+    }
+  return TCPListener{listeningAddress, backlogSize, reuseAddress, reusePort,
+      v6Only, blocking, maskSigPipe, *userHandler, logStream, timeouts};
 }
 
 ///////////////////////////////////////////////////////////////////////////////
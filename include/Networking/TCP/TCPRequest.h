@@ -7,33 +7,56 @@
 //
 // CREATED:         04/02/2020
 //
-// LAST EDITED:     04/17/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_TCPREQUEST__
 #define __ET_TCPREQUEST__
 
+#include <Networking/FileDescriptor.h>
 #include <Networking/Interfaces/IRequest.h>
 #include <Networking/NetworkHost.h>
+#include <Networking/PeerAddress.h>
+#include <Networking/RequestPool.h>
+#include <Networking/TCP/ConnectionTimeouts.h>
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <ostream>
 
-template<class HostType>
+// Handler is anything callable as void(unsigned int, const PeerAddress&) or
+// void(unsigned int, const HostType&). It is held by reference, and must
+// outlive the request. The HostType, if that is what the handler takes, is
+// only made when the request is handled, off the accept path. With C++20, it
+// may instead be a coroutine, called as Task<>(AsyncStream, ...) on the
+// thread of an EventLoop (see AsyncStream.h). The timeouts, and the timer
+// thread (if any), belong to the listener, and must outlive the request.
+template<class HostType, class Handler>
 class Networking::TCP::TCPRequest : public Networking::Interfaces::IRequest
 {
 public:
-  TCPRequest(int socket, HostType connectingAddress,
-             std::function<void(unsigned int,const HostType&)>& userHandler,
-             std::function<void(const std::string&)> logStream);
+  TCPRequest(FileDescriptor socket, PeerAddress connectingAddress,
+             Handler& userHandler, const ConnectionTimeouts& timeouts,
+             TimerThread* timerThread);
   virtual void handle() final override;
+  virtual int getDescriptor() const final override;
+
+  // Requests allocated from a pool are returned to it on delete.
+  static void* operator new(std::size_t size, RequestPool& pool);
+  static void operator delete(void* request, RequestPool& pool) noexcept;
+  static void operator delete(void* request) noexcept;
 
 private:
-  std::shared_ptr<int> m_socket;
-  HostType m_connectingAddress;
-  std::function<void(unsigned int,const HostType&)>& m_userHandler;
-  std::function<void(const std::string&)> m_logStream;
+  void dispatch(EventLoop* loop);
+  // Has the loop keep the idle deadlines of a connection the handler keeps.
+  void keepDeadlines(EventLoop& loop);
+
+  FileDescriptor m_socket;
+  PeerAddress m_connectingAddress;
+  Handler& m_userHandler;
+  const ConnectionTimeouts& m_timeouts;
+  TimerThread* m_timerThread;
 };
 
 #include <Networking/TCP/TCPRequest.tcc>
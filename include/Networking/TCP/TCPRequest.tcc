@@ -7,32 +7,142 @@
 //
 // CREATED:         04/02/2020
 //
-// LAST EDITED:     04/18/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #include <Networking/TCP/TCPRequest.h>
+#include <Networking/EventLoop.h>
 
-#include <unistd.h>
+#ifdef NETWORKING_COROUTINES
+#include <Networking/TCP/AsyncStream.h>
 
-template<class HostType>
-Networking::TCP::TCPRequest<HostType>
-::TCPRequest(int socket, HostType connectingAddress,
-             std::function<void(unsigned int,const HostType&)>& userHandler,
-             std::function<void(const std::string&)> logStream)
-  : m_socket{0}, m_connectingAddress{connectingAddress},
-    m_userHandler{userHandler}, m_logStream{logStream}
+#include <stdexcept>
+#endif
+
+#include <type_traits>
+#include <utility>
+
+template<class HostType, class Handler>
+Networking::TCP::TCPRequest<HostType, Handler>
+::TCPRequest(FileDescriptor socket, PeerAddress connectingAddress,
+             Handler& userHandler, const ConnectionTimeouts& timeouts,
+             TimerThread* timerThread)
+  : m_socket{std::move(socket)}, m_connectingAddress{connectingAddress},
+    m_userHandler{userHandler}, m_timeouts{timeouts},
+    m_timerThread{timerThread}
+{}
+
+template<class HostType, class Handler>
+void Networking::TCP::TCPRequest<HostType, Handler>::handle()
+{
+  EventLoop* loop = EventLoop::current();
+  if (nullptr == loop)
+    {
+      // Nothing else watches the connection while the handler blocks on it.
+      ConnectionTimeouts::Guard guard{m_socket.get(), m_timeouts,
+          m_timerThread};
+      if (guard.awaitFirstByte())
+        {
+          dispatch(nullptr);
+        }
+      return;
+    }
+
+  dispatch(loop);
+}
+
+template<class HostType, class Handler>
+void Networking::TCP::TCPRequest<HostType, Handler>::dispatch(EventLoop* loop)
+{
+#ifdef NETWORKING_COROUTINES
+  if constexpr (isAsyncHandler<Handler, HostType>)
+    {
+      if (nullptr == loop)
+        {
+          throw std::logic_error{"TCPRequest: coroutine handlers must be"
+              " run by an EventLoop (e.g. by the NonBlockingServer)"};
+        }
+
+      // The handler runs until it first suspends. The server then adopts
+      // the request, as the stream has registered the socket, and the
+      // connection stays open until the stream is destroyed.
+      AsyncStream stream{*loop, m_socket.get()};
+      stream.setTimeout(m_timeouts.readWrite);
+      // Before the handler runs, so that the I/O it does before it first
+      // suspends counts against the deadlines.
+      keepDeadlines(*loop);
+      if constexpr (std::is_invocable_v<Handler&, AsyncStream,
+                                        const PeerAddress&>)
+        {
+          spawn(m_userHandler(std::move(stream), m_connectingAddress));
+        }
+      else
+        {
+          spawn(m_userHandler(std::move(stream),
+                              HostType{m_connectingAddress
+                                       .getNetworkAddress()}));
+        }
+    }
+  else
+#endif
+    {
+      if constexpr (std::is_invocable_v<Handler&, unsigned int,
+                                        const PeerAddress&>)
+        {
+          m_userHandler(m_socket.get(), m_connectingAddress);
+        }
+      else
+        {
+          m_userHandler(m_socket.get(),
+                        HostType{m_connectingAddress.getNetworkAddress()});
+        }
+
+      // The handler keeps the connection by registering the socket.
+      if (nullptr != loop)
+        {
+          keepDeadlines(*loop);
+        }
+    }
+}
+
+template<class HostType, class Handler>
+void Networking::TCP::TCPRequest<HostType, Handler>
+::keepDeadlines(EventLoop& loop)
+{
+  if ((0 < m_timeouts.idle.count() || 0 < m_timeouts.firstByte.count())
+      && loop.contains(m_socket.get()))
+    {
+      loop.setIdleTimeout(m_socket.get(), m_timeouts.idle,
+                          m_timeouts.firstByte);
+    }
+}
+
+template<class HostType, class Handler>
+int Networking::TCP::TCPRequest<HostType, Handler>::getDescriptor() const
+{
+  return m_socket.get();
+}
+
+template<class HostType, class Handler>
+void* Networking::TCP::TCPRequest<HostType, Handler>
+::operator new(std::size_t size, RequestPool& pool)
+{
+  return pool.allocate(size);
+}
+
+// Only called if the constructor of a pooled request throws.
+template<class HostType, class Handler>
+void Networking::TCP::TCPRequest<HostType, Handler>
+::operator delete(void* request, RequestPool&) noexcept
 {
-  m_socket = std::shared_ptr<int>{new int, [](int* pInt){
-      ::close(*pInt);
-      delete pInt;
-    }};
-  *m_socket = socket;
+  RequestPool::deallocate(request);
 }
 
-template<class HostType>
-void Networking::TCP::TCPRequest<HostType>::handle()
+template<class HostType, class Handler>
+void Networking::TCP::TCPRequest<HostType, Handler>
+::operator delete(void* request) noexcept
 {
-  m_userHandler(*m_socket, m_connectingAddress);
+  RequestPool::deallocate(request);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
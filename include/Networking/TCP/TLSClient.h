@@ -4,10 +4,14 @@
 // AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
 //
 // DESCRIPTION:     Client for initiating TLS connections to a TLS server.
+//                  Connections are pooled: once the user handler returns,
+//                  the connection is kept open for the next call to
+//                  connect() to the same host, and the session negotiated
+//                  with each host is kept to resume the next handshake.
 //
 // CREATED:         04/09/2020
 //
-// LAST EDITED:     04/18/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_TLSCLIENT__
@@ -15,8 +19,16 @@
 
 #include <namespaces/Networking.h>
 #include <Networking/NetworkHost.h>
+#include <Networking/TCP/AsyncStream.h>
+#include <Networking/TCP/KernelTLS.h>
+#include <Networking/TCP/TLSConnectionPool.h>
 
+#include <chrono>
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <string>
 
 #include <openssl/ssl.h>
 
@@ -24,25 +36,69 @@ template<class HostType>
 class Networking::TCP::TLSClient
 {
 public:
+  // How connections are kept between calls to connect().
+  struct PoolConfiguration
+  {
+    // Idle connections kept per host. 0 closes every connection once the
+    // user handler returns.
+    std::size_t maxIdlePerHost;
+    // How long a connection may sit idle, and how long it may be used for
+    // in all, before it is closed.
+    std::chrono::seconds maxIdleTime;
+    std::chrono::seconds maxLifetime;
+    // Resume the last session with a host when a new connection is needed.
+    bool sessionReuse;
+  };
+
   TLSClient(HostType hostAddress,
             std::function<void(BIO*)> userHandler,
             bool useTwoWayAuthentication,
             std::string customCACertificatePath,
-            std::function<void(const std::string&)> logStream);
-
+            std::function<void(const std::string&)> logStream,
+            PoolConfiguration poolConfiguration,
+            KernelTLSMode kernelTLSMode);
+
+  // Calls the user handler with a connection to the host address (or to
+  // hostAddress), which is taken from the pool if there is a healthy one
+  // idle. The handler must not free the BIO. If it shuts the connection
+  // down, or throws, the connection is not returned to the pool.
   void connect();
+  void connect(const HostType& hostAddress);
+
+#ifdef NETWORKING_COROUTINES
+  // Evaluates to a new, verified connection to the host (or to
+  // hostAddress), made on the loop's thread without blocking it, which the
+  // stream owns. These connections are not pooled (though the session is
+  // resumed as for connect()), and the client must outlive the task. The
+  // connection, and then the handshake, are each given the TCPClient's
+  // attempt timeout.
+  Task<AsyncStream> connect(EventLoop& loop);
+  Task<AsyncStream> connect(EventLoop& loop, HostType hostAddress);
+#endif
+
+  // Closes every idle connection, and forgets every session.
+  void closeIdleConnections();
+  // May be called from any thread.
+  TLSConnectionPool::Statistics getPoolStatistics() const;
 
   class Builder;
 
 private:
-  SSL_CTX* createContext(std::string);
-  std::string getHostString() const;
+  SSL_CTX* createContext(std::string, KernelTLSMode);
+  BIO* handshake(const HostType& hostAddress, const std::string& hostString);
+  void prepare(SSL* ssl, const std::string& hostString);
+  void verify(SSL* ssl, const HostType& hostAddress);
+  static std::string getHostString(const HostType& hostAddress);
 
   std::unique_ptr<SSL_CTX, std::function<void(SSL_CTX*)>> m_sslContext;
+  // Declared after the context, so that the idle connections, which each
+  // hold a reference to it, are freed first.
+  std::unique_ptr<TLSConnectionPool> m_connectionPool;
 
   HostType m_hostAddress;
   std::function<void(BIO*)> m_userHandler;
   const bool m_useTwoWayAuthentication;
+  const KernelTLSMode m_kernelTLSMode;
   std::function<void(const std::string&)> m_logStream;
 };
 
@@ -56,6 +112,14 @@ public:
   Builder setTwoWayAuthentication(bool);
   Builder setCustomCACertificatePath(std::string);
   Builder setLogStream(std::function<void(const std::string&)>);
+  Builder setMaxIdleConnections(std::size_t);
+  Builder setMaxIdleTime(std::chrono::seconds);
+  Builder setMaxConnectionLifetime(std::chrono::seconds);
+  Builder setSessionReuse(bool);
+  // Once the handshake completes, hand record encryption to the kernel, so
+  // that the user handler may use the socket (BIO_get_fd) directly.
+  // Checked only for new connections, not for those taken from the pool.
+  Builder setKernelTLS(KernelTLSMode);
 
   TLSClient<HostType> build() const;
 
@@ -74,6 +138,11 @@ private:
   {
     std::cerr << message << '\n';
   };
+
+  PoolConfiguration m_poolConfiguration =
+    {4, std::chrono::seconds{60}, std::chrono::minutes{10}, true};
+
+  KernelTLSMode m_kernelTLSMode = KTLS_DISABLED;
 };
 
 #include <Networking/TCP/TLSClient.tcc>
@@ -7,12 +7,17 @@
 //
 // CREATED:         04/09/2020
 //
-// LAST EDITED:     05/01/2020
+// LAST EDITED:     10/18/2026
 ////
 
+#include <Networking/TCP/TCPClient.h>
 #include <Networking/TCP/TLSClient.h>
 #include <Networking/TCP/TLSException.h>
 
+#include <cstring>
+#include <memory>
+#include <system_error>
+
 #include <sys/stat.h>
 
 #include <openssl/err.h>
@@ -20,31 +25,30 @@
 #define str(x) _str(x)
 #define _str(x) #x
 
-static std::string getSSLErrors()
-{
-  BIO* bio = BIO_new(BIO_s_mem());
-  ERR_print_errors(bio);
-  char* buf = nullptr;
-  BIO_get_mem_data(bio, &buf);
-  return std::string{buf};
-}
-
 template<class HostType>
 Networking::TCP::TLSClient<HostType>
 ::TLSClient(HostType hostAddress, std::function<void(BIO*)> userHandler,
             bool useTwoWayAuthentication, std::string customCACertificatePath,
-            std::function<void(const std::string&)> logStream)
-  : m_sslContext{createContext(customCACertificatePath), [](SSL_CTX* ctx)
+            std::function<void(const std::string&)> logStream,
+            PoolConfiguration poolConfiguration, KernelTLSMode kernelTLSMode)
+  : m_sslContext{createContext(customCACertificatePath, kernelTLSMode),
+    [](SSL_CTX* ctx)
     {
       SSL_CTX_free(ctx);
-    }}, m_hostAddress{hostAddress}, m_userHandler{userHandler},
+    }},
+    m_connectionPool{TLSConnectionPool::attach
+      (m_sslContext.get(), poolConfiguration.maxIdlePerHost,
+       poolConfiguration.maxIdleTime, poolConfiguration.maxLifetime,
+       poolConfiguration.sessionReuse)},
+    m_hostAddress{hostAddress}, m_userHandler{userHandler},
     m_useTwoWayAuthentication{useTwoWayAuthentication},
-    m_logStream{logStream}
+    m_kernelTLSMode{kernelTLSMode}, m_logStream{logStream}
 {}
 
 template<class HostType>
 SSL_CTX* Networking::TCP::TLSClient<HostType>
-::createContext(std::string customCACertificatePath)
+::createContext(std::string customCACertificatePath,
+                KernelTLSMode kernelTLSMode)
 {
   SSL_CTX* context = nullptr;
   const SSL_METHOD* method = TLS_method();
@@ -70,6 +74,7 @@ SSL_CTX* Networking::TCP::TLSClient<HostType>
   // Disable SSLv2/3 and compression.
   const long flags = SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_COMPRESSION;
   SSL_CTX_set_options(context, flags);
+  configureKernelTLS(context, kernelTLSMode);
 
   long result = 1;
 
@@ -115,13 +120,49 @@ SSL_CTX* Networking::TCP::TLSClient<HostType>
 template<class HostType>
 void Networking::TCP::TLSClient<HostType>::connect()
 {
-  // Similar to TLSListener, we wrap the BIO pointer in a shared_ptr, but then
-  // we pass the raw pointer to the user. Why? Because the SSL library
-  // functions require the raw pointer, so the user will have to get it from
-  // the shared_ptr anyways. We bother wrapping it at all so that we can ensure
-  // the BIO is freed even if the normal flow of logic is interrupted (e.g. by
-  // exception).
-  std::shared_ptr<BIO> sslBIO{
+  connect(m_hostAddress);
+}
+
+template<class HostType>
+void Networking::TCP::TLSClient<HostType>
+::connect(const HostType& hostAddress)
+{
+  const std::string hostString = getHostString(hostAddress);
+  std::unique_ptr<BIO, void(*)(BIO*)> sslBIO{
+    m_connectionPool->checkout(hostString), BIO_free_all};
+  if (!sslBIO)
+    {
+      sslBIO.reset(handshake(hostAddress, hostString));
+      m_logStream("Successfully connected to " + hostAddress.string());
+    }
+
+  // If the handler throws, the connection is in an unknown state, so it is
+  // freed rather than checked in.
+  m_userHandler(sslBIO.get());
+  m_connectionPool->checkin(sslBIO.release());
+}
+
+template<class HostType>
+void Networking::TCP::TLSClient<HostType>::closeIdleConnections()
+{
+  m_connectionPool->clear();
+}
+
+template<class HostType>
+Networking::TCP::TLSConnectionPool::Statistics
+Networking::TCP::TLSClient<HostType>::getPoolStatistics() const
+{
+  return m_connectionPool->getStatistics();
+}
+
+// Returns a new, verified connection to hostAddress.
+template<class HostType>
+BIO* Networking::TCP::TLSClient<HostType>
+::handshake(const HostType& hostAddress, const std::string& hostString)
+{
+  // We hold the BIO in a unique_ptr until the handshake has succeeded, so
+  // that it is freed if we throw.
+  std::unique_ptr<BIO, void(*)(BIO*)> sslBIO{
     [this]() -> BIO*{
       BIO* theBio = BIO_new_ssl_connect(m_sslContext.get());
       if (nullptr == theBio)
@@ -130,13 +171,10 @@ void Networking::TCP::TLSClient<HostType>::connect()
             + "Could not create connect BIO; error trace:\n" + getSSLErrors()};
         }
       return theBio;
-    }(), [](BIO* bio){
-      BIO_free_all(bio);
-    }};
+    }(), BIO_free_all};
   BIO* stream = sslBIO.get();
 
   long result = 1;
-  std::string hostString = getHostString();
   result = BIO_set_conn_hostname(stream, hostString.c_str());
   if (1 != result)
     {
@@ -153,24 +191,14 @@ void Networking::TCP::TLSClient<HostType>::connect()
         + "Could not retrieve SSL wrapper; error trace:\n" + getSSLErrors()};
     }
 
-  // Disable weak ciphers.
-  // TODO: Only allow TLS v1.2 in TLSListener/TLSClient
-  const char* const PREFERRED_CIPHERS
-    = "HIGH:!aNULL:!kRSA:!PSK:!SRP:!MD5:!RC4";
-  result = SSL_set_cipher_list(ssl, PREFERRED_CIPHERS);
-  if (1 != result)
-    {
-      throw std::runtime_error{std::string{__FILE__":" str(__LINE__) ":"}
-        + "Could not set preferred ciphers; error trace:\n" + getSSLErrors()};
-    }
-
+  prepare(ssl, hostString);
   result = BIO_do_connect(stream);
   if (1 != result)
     {
       result = SSL_get_verify_result(ssl);
       throw TLSException{std::string{__FILE__":" str(__LINE__) ":"}
         + "Could not connect to host; error trace:\n" + getSSLErrors()
-          + "\n" + X509_verify_cert_error_string(result), m_hostAddress};
+          + "\n" + X509_verify_cert_error_string(result), hostAddress};
     }
 
   result = BIO_do_handshake(stream);
@@ -178,9 +206,36 @@ void Networking::TCP::TLSClient<HostType>::connect()
     {
       throw TLSException{std::string{__FILE__":" str(__LINE__) ":"}
         + "Could not create TLS connection; error trace:\n" + getSSLErrors(),
-          m_hostAddress};
+          hostAddress};
     }
 
+  verify(ssl, hostAddress);
+  return sslBIO.release();
+}
+
+template<class HostType>
+void Networking::TCP::TLSClient<HostType>
+::prepare(SSL* ssl, const std::string& hostString)
+{
+  // Offers the session last negotiated with this host, if any.
+  m_connectionPool->prepare(ssl, hostString);
+
+  // Disable weak ciphers.
+  // TODO: Only allow TLS v1.2 in TLSListener/TLSClient
+  const char* const PREFERRED_CIPHERS
+    = "HIGH:!aNULL:!kRSA:!PSK:!SRP:!MD5:!RC4";
+  if (1 != SSL_set_cipher_list(ssl, PREFERRED_CIPHERS))
+    {
+      throw std::runtime_error{std::string{__FILE__":" str(__LINE__) ":"}
+        + "Could not set preferred ciphers; error trace:\n" + getSSLErrors()};
+    }
+}
+
+// Once the handshake has succeeded.
+template<class HostType>
+void Networking::TCP::TLSClient<HostType>
+::verify(SSL* ssl, const HostType& hostAddress)
+{
   // Verify that an x509 certificate WAS provided
   X509* cert = SSL_get_peer_certificate(ssl);
   if (nullptr == cert)
@@ -188,38 +243,97 @@ void Networking::TCP::TLSClient<HostType>::connect()
       throw TLSException{std::string{__FILE__":" str(__LINE__) ":"}
         + "Host did not provide an x509 certificate; error trace:\n"
           + getSSLErrors(),
-          m_hostAddress};
+          hostAddress};
     }
   X509_free(cert);
 
-  result = SSL_get_verify_result(ssl);
+  const long result = SSL_get_verify_result(ssl);
   if (X509_V_OK != result)
     {
       throw TLSException{std::string{__FILE__":" str(__LINE__) ":"}
         + "Error occurred during chain verification; error trace:\n"
           + getSSLErrors(),
-          m_hostAddress};
+          hostAddress};
+    }
+
+  if (KTLS_DISABLED != m_kernelTLSMode)
+    {
+      const std::string reason = checkKernelTLS(ssl);
+      if (!reason.empty() && KTLS_REQUIRED == m_kernelTLSMode)
+        {
+          throw TLSException{reason, hostAddress};
+        }
+      else if (!reason.empty())
+        {
+          m_logStream(hostAddress.string() + ": " + reason);
+        }
     }
 
-  // We have successfully connect to the client.
-  m_logStream("Successfully connected to " + m_hostAddress.string());
-  m_userHandler(stream);
+  m_connectionPool->connected(ssl);
 }
 
+#ifdef NETWORKING_COROUTINES
+template<class HostType>
+Networking::Task<Networking::TCP::AsyncStream>
+Networking::TCP::TLSClient<HostType>::connect(EventLoop& loop)
+{
+  return connect(loop, m_hostAddress);
+}
+
+template<class HostType>
+Networking::Task<Networking::TCP::AsyncStream>
+Networking::TCP::TLSClient<HostType>::connect(EventLoop& loop,
+                                              HostType hostAddress)
+{
+  const std::chrono::milliseconds timeout
+    = typename TCPClient<HostType>::ConnectOptions{}.attemptTimeout;
+  AsyncStream stream = co_await Networking::TCP::connect
+    (loop, TCPClient<HostType>::getAddresses(hostAddress), timeout);
+
+  std::unique_ptr<SSL, void(*)(SSL*)> ssl{SSL_new(m_sslContext.get()),
+      SSL_free};
+  if (!ssl)
+    {
+      throw std::runtime_error{std::string{__FILE__":" str(__LINE__) ":"}
+        + "Could not create SSL; error trace:\n" + getSSLErrors()};
+    }
+  prepare(ssl.get(), getHostString(hostAddress));
+  SSL_set_fd(ssl.get(), stream.getDescriptor());
+  SSL_set_connect_state(ssl.get());
+  stream.setSSL(std::move(ssl));
+
+  const TLSHandshake handshake = co_await stream.handshake
+    (std::chrono::steady_clock::now() + timeout);
+  if (TLSHandshake::COMPLETE != handshake.getStatus())
+    {
+      throw TLSException{std::string{__FILE__":" str(__LINE__) ":"}
+        + "Could not create TLS connection; error trace:\n"
+          + handshake.getErrors(), hostAddress};
+    }
+  verify(stream.getSSL(), hostAddress);
+  m_logStream("Successfully connected to " + hostAddress.string());
+  co_return std::move(stream);
+}
+#endif
+
 template<>
-std::string Networking::TCP::TLSClient<Networking::NetworkHost>
-::getHostString() const
+inline std::string Networking::TCP::TLSClient<Networking::NetworkHost>
+::getHostString(const NetworkHost& hostAddress)
 {
-  return m_hostAddress.getHostname() + ":"
-    + std::to_string(m_hostAddress.getPortHostOrder());
+  // The name falls back to the address, which may be IPv6.
+  const std::string hostname = hostAddress.getHostname();
+  return (std::string::npos == hostname.find(':') ? hostname
+          : "[" + hostname + "]")
+    + ":" + std::to_string(hostAddress.getPortHostOrder());
 }
 
 template<>
-std::string Networking::TCP::TLSClient<Networking::NetworkAddress>
-::getHostString() const
+inline std::string Networking::TCP::TLSClient<Networking::NetworkAddress>
+::getHostString(const NetworkAddress& hostAddress)
 {
-  return m_hostAddress.getIPDotNotation() + ":"
-    + std::to_string(m_hostAddress.getPortHostOrder());
+  const std::string ip = hostAddress.getIPDotNotation();
+  return (AF_INET6 == hostAddress.getFamily() ? "[" + ip + "]" : ip)
+    + ":" + std::to_string(hostAddress.getPortHostOrder());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -227,12 +341,14 @@ std::string Networking::TCP::TLSClient<Networking::NetworkAddress>
 ////
 
 template<>
-Networking::TCP::TLSClient<Networking::NetworkAddress>::Builder::Builder()
+inline Networking::TCP::TLSClient<Networking::NetworkAddress>::Builder
+::Builder()
   : m_hostAddress{INADDR_LOOPBACK, 443}
 {}
 
 template<>
-Networking::TCP::TLSClient<Networking::NetworkHost>::Builder::Builder()
+inline Networking::TCP::TLSClient<Networking::NetworkHost>::Builder
+::Builder()
   : m_hostAddress{"localhost", 443}
 {}
 
@@ -266,12 +382,43 @@ Networking::TCP::TLSClient<HostType>::Builder
 ::setLogStream(std::function<void(const std::string&)> logStream)
 { m_logStream = logStream; return *this; }
 
+template<class HostType>
+typename Networking::TCP::TLSClient<HostType>::Builder
+Networking::TCP::TLSClient<HostType>::Builder
+::setMaxIdleConnections(std::size_t maxIdlePerHost)
+{ m_poolConfiguration.maxIdlePerHost = maxIdlePerHost; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TLSClient<HostType>::Builder
+Networking::TCP::TLSClient<HostType>::Builder
+::setMaxIdleTime(std::chrono::seconds maxIdleTime)
+{ m_poolConfiguration.maxIdleTime = maxIdleTime; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TLSClient<HostType>::Builder
+Networking::TCP::TLSClient<HostType>::Builder
+::setMaxConnectionLifetime(std::chrono::seconds maxLifetime)
+{ m_poolConfiguration.maxLifetime = maxLifetime; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TLSClient<HostType>::Builder
+Networking::TCP::TLSClient<HostType>::Builder
+::setSessionReuse(bool sessionReuse)
+{ m_poolConfiguration.sessionReuse = sessionReuse; return *this; }
+
+template<class HostType>
+typename Networking::TCP::TLSClient<HostType>::Builder
+Networking::TCP::TLSClient<HostType>::Builder
+::setKernelTLS(KernelTLSMode kernelTLSMode)
+{ m_kernelTLSMode = kernelTLSMode; return *this; }
+
 template<class HostType>
 Networking::TCP::TLSClient<HostType>
 Networking::TCP::TLSClient<HostType>::Builder::build() const
 {
   return TLSClient<HostType>{m_hostAddress, m_userHandler,
-      m_useTwoWayAuthentication, m_customCACertificatePath, m_logStream};
+      m_useTwoWayAuthentication, m_customCACertificatePath, m_logStream,
+      m_poolConfiguration, m_kernelTLSMode};
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,143 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSConnectionPool.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Client-side pool of authenticated TLS connections, kept
+//                  idle per host so that they can be handed out again, and
+//                  of the last session negotiated with each host, so that
+//                  a new connection can resume it with an abbreviated
+//                  handshake.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_TLSCONNECTIONPOOL__
+#define __ET_TLSCONNECTIONPOOL__
+
+#include <namespaces/Networking.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// Need forward declaration for compilation
+typedef struct bio_st BIO;
+typedef struct ssl_ctx_st SSL_CTX;
+typedef struct ssl_st SSL;
+typedef struct ssl_session_st SSL_SESSION;
+
+class Networking::TCP::TLSConnectionPool
+{
+public:
+  struct Statistics
+  {
+    std::uint64_t fullHandshakes;
+    std::uint64_t resumedHandshakes;
+    std::uint64_t reused;      // Checkouts served by an idle connection
+    std::uint64_t expired;     // Connections dropped for the time limits
+    std::uint64_t unhealthy;   // Connections found closed by the peer
+    std::size_t idle;          // Connections currently idle
+  };
+
+  // Creates a pool for connections made from context, keeping up to
+  // maxIdlePerHost of them idle per host. A connection is dropped once it
+  // has been idle for maxIdleTime, or open for maxLifetime. Unlike the
+  // server's session cache, the pool is owned by the caller: each idle
+  // connection holds a reference to the context, so the pool must be
+  // destroyed before the context can be.
+  static std::unique_ptr<TLSConnectionPool>
+  attach(SSL_CTX* context, std::size_t maxIdlePerHost,
+         std::chrono::seconds maxIdleTime, std::chrono::seconds maxLifetime,
+         bool sessionReuse);
+
+  TLSConnectionPool(const TLSConnectionPool&) = delete;
+  TLSConnectionPool& operator=(const TLSConnectionPool&) = delete;
+  ~TLSConnectionPool();
+
+  // Returns an idle connection to host that is within the time limits and
+  // still open, or nullptr. The caller owns the connection until it is
+  // checked back in.
+  BIO* checkout(const std::string& host);
+  // Must be called on every new connection before its handshake: offers it
+  // the session last negotiated with host, and marks it as belonging to
+  // host, so that it may be checked in later.
+  void prepare(SSL* ssl, const std::string& host);
+  // Called once the handshake of a prepared connection has succeeded.
+  void connected(SSL* ssl);
+  // Takes ownership of a connection the caller has finished with. It is
+  // kept for reuse if it is still open and there is room, or freed.
+  void checkin(BIO* bio);
+  // Frees every idle connection and forgets every session.
+  void clear();
+
+  // May be called from any thread.
+  Statistics getStatistics() const;
+
+private:
+  struct Idle
+  {
+    BIO* bio;
+    std::chrono::steady_clock::time_point since;
+  };
+
+  struct Host
+  {
+    // Least recently checked in first.
+    std::deque<Idle> idle;
+    SSL_SESSION* session = nullptr;
+  };
+
+  // Attached to each prepared connection.
+  struct Tag
+  {
+    Host* host;
+    std::chrono::steady_clock::time_point created;
+  };
+
+  TLSConnectionPool(SSL_CTX* context, std::size_t maxIdlePerHost,
+                    std::chrono::seconds maxIdleTime,
+                    std::chrono::seconds maxLifetime, bool sessionReuse);
+
+  bool isHealthy(SSL* ssl) const;
+  bool isExpired(SSL* ssl,
+                 std::chrono::steady_clock::time_point now) const;
+
+  static int contextIndex();
+  static int connectionIndex();
+  static TLSConnectionPool* fromContext(SSL_CTX* context);
+  static Tag* getTag(SSL* ssl);
+
+  // OpenSSL callback
+  static int newSession(SSL* ssl, SSL_SESSION* session);
+
+  // Its ex_data points at the pool until the pool is destroyed, as
+  // connections may outlive the pool (and their session callback run).
+  SSL_CTX* const m_context;
+  const std::size_t m_maxIdlePerHost;
+  const std::chrono::seconds m_maxIdleTime;
+  const std::chrono::seconds m_maxLifetime;
+  const bool m_sessionReuse;
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, Host> m_hosts;
+  std::size_t m_idle;
+
+  std::atomic<std::uint64_t> m_fullHandshakes;
+  std::atomic<std::uint64_t> m_resumedHandshakes;
+  std::atomic<std::uint64_t> m_reused;
+  std::atomic<std::uint64_t> m_expired;
+  std::atomic<std::uint64_t> m_unhealthy;
+};
+
+#endif // __ET_TLSCONNECTIONPOOL__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -15,7 +15,7 @@
 //
 // CREATED:         04/05/2020
 //
-// LAST EDITED:     04/17/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_TLSEXCEPTION__
@@ -41,6 +41,12 @@ private:
   HostType m_client;
 };
 
+namespace Networking::TCP
+{
+  // Drains the calling thread's OpenSSL error queue into a string.
+  std::string getSSLErrors();
+};
+
 #include <Networking/TCP/TLSException.tcc>
 
 #endif // __ET_TLSEXCEPTION__
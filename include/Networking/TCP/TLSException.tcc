@@ -7,11 +7,14 @@
 //
 // CREATED:         04/05/2020
 //
-// LAST EDITED:     04/18/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #include <Networking/TCP/TLSException.h>
 
+#include <openssl/bio.h>
+#include <openssl/err.h>
+
 template<class HostType>
 Networking::TCP::TLSException<HostType>
 ::TLSException(std::string what, HostType client)
@@ -32,4 +35,25 @@ const HostType& Networking::TCP::TLSException<HostType>
   return m_client;
 }
 
+inline std::string Networking::TCP::getSSLErrors()
+{
+  BIO* bio = BIO_new(BIO_s_mem());
+  if (nullptr == bio)
+    {
+      ERR_clear_error();
+      return "(could not allocate a BIO for the error trace)\n";
+    }
+  ERR_print_errors(bio);
+  char* buf = nullptr;
+  // The buffer is not NUL-terminated.
+  const long length = BIO_get_mem_data(bio, &buf);
+  std::string errors{};
+  if (0 < length)
+    {
+      errors.assign(buf, length);
+    }
+  BIO_free(bio);
+  return errors;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSHandshake.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Drives a TLS handshake on a non-blocking socket, one step
+//                  at a time, so that it can be multiplexed on an EventLoop
+//                  with any number of others, or on its own, by polling the
+//                  socket. In either case, the handshake is abandoned if it
+//                  has not completed by its deadline.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_TLSHANDSHAKE__
+#define __ET_TLSHANDSHAKE__
+
+#include <namespaces/Networking.h>
+
+#include <chrono>
+#include <string>
+
+// Need forward declaration for compilation
+typedef struct ssl_st SSL;
+
+class Networking::TCP::TLSHandshake
+{
+public:
+  enum Status
+    {
+      WANT_READ,
+      WANT_WRITE,
+      COMPLETE,
+      FAILED,
+      TIMED_OUT
+    };
+
+  // ssl must already be attached to a non-blocking socket, and set to
+  // accept (or connect). It is not owned by the handshake.
+  TLSHandshake(SSL* ssl, std::chrono::steady_clock::time_point deadline);
+
+  // Advances the handshake as far as it can go without blocking. Once it
+  // has completed, failed or timed out, does nothing.
+  Status step();
+  // Steps, polling the socket in between, until the handshake is over.
+  Status run();
+  // Gives up on the handshake, if it is not over yet.
+  void expire();
+
+  Status getStatus() const;
+  bool isOver() const;
+  // The EventLoop::Event the handshake is waiting for.
+  unsigned int getEvents() const;
+  std::chrono::steady_clock::time_point getDeadline() const;
+  // Why the handshake failed: the OpenSSL error trace, or system error.
+  const std::string& getErrors() const;
+
+private:
+  SSL* m_ssl;
+  std::chrono::steady_clock::time_point m_deadline;
+  Status m_status;
+  std::string m_errors;
+};
+
+#endif // __ET_TLSHANDSHAKE__
+
+///////////////////////////////////////////////////////////////////////////////
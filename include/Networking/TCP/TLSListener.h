@@ -7,22 +7,53 @@
 //
 // CREATED:         04/04/2020
 //
-// LAST EDITED:     05/01/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_TLSLISTENER__
 #define __ET_TLSLISTENER__
 
 #include <namespaces/Networking.h>
+#include <Networking/EventLoop.h>
+#include <Networking/TCP/AsyncStream.h>
+#include <Networking/TCP/ConnectionTimeouts.h>
+#include <Networking/TCP/KernelTLS.h>
 #include <Networking/TCP/TCPListener.h>
-
+#include <Networking/TCP/TLSHandshake.h>
+#include <Networking/TCP/TLSSessionCache.h>
+#include <Networking/TCP/TLSTicketKeys.h>
+#include <Networking/TimerWheel.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
 
 // Need forward declaration for compilation
 typedef struct ssl_ctx_st SSL_CTX;
 typedef struct ssl_st SSL;
 
-template<class HostType>
+// Handler is called as void(SSL*, const PeerAddress&), or as
+// void(SSL*, const HostType&) if it cannot take the former, once the
+// handshake with the client has completed, and the connection is shut down
+// when it returns. Under an EventLoop (e.g. by the NonBlockingServer), the
+// handshake does not block: the loop carries on with other connections
+// while it is in progress, and the handler is called on the loop's thread
+// when it completes. With C++20, the handler may instead be a coroutine,
+// called as Task<>(AsyncStream, ...), for which the listener must be run by
+// an EventLoop: the handshake is awaited like any other I/O.
+//
+// Thread safety: the SSL_CTX is configured in the constructor and is not
+// modified afterwards, so requests may be handled on any number of threads
+// at once (e.g. by the DelegatorMT). Each connection has an SSL of its own,
+// which belongs to the handling of its request; the only state shared
+// between connections is the SSL_CTX, the session cache and ticket keys
+// (which have locks of their own), and the statistics (which are atomic).
+// The user handler and log stream are shared too, so they must be safe to
+// call concurrently if the requests are.
+template<class HostType, class Handler>
 class Networking::TCP::TLSListener : public Networking::Interfaces::IListener
 {
 public:
@@ -32,65 +63,161 @@ public:
       THROW
     };
 
+  // How returning clients may skip the full handshake.
+  struct SessionConfiguration
+  {
+    // Sessions kept by the server, spread across cacheShards locks. A size
+    // of 0 disables the cache.
+    std::size_t cacheSize;
+    unsigned int cacheShards;
+    // How long a session (or ticket) may be resumed for.
+    std::chrono::seconds timeout;
+    // Stateless tickets, whose keys are replaced every ticketKeyRotation.
+    bool tickets;
+    std::chrono::seconds ticketKeyRotation;
+  };
+
+  struct SessionStatistics
+  {
+    std::uint64_t fullHandshakes;
+    std::uint64_t resumedHandshakes;
+    TLSSessionCache::Statistics cache;  // All zero if the cache is disabled
+    TLSTicketKeys::Statistics tickets;  // All zero if tickets are disabled
+  };
+
   // TODO: Implement two-way authentication
   TLSListener(HostType acceptedClients, unsigned int theBacklogSize,
-              bool reuseAddress, bool blocking, bool maskSigPipe,
+              bool reuseAddress, bool reusePort, bool v6Only, bool blocking,
+              bool maskSigPipe,
               bool useTwoWayAuthentication, HandshakeFailureAction action,
               std::string certficateFile, std::string privateKeyFile,
-              std::function<void(SSL*,const HostType&)> userHandler,
-              std::function<void(const std::string&)> logStream);
+              Handler userHandler,
+              std::function<void(const std::string&)> logStream,
+              SessionConfiguration sessionConfiguration,
+              KernelTLSMode kernelTLSMode,
+              std::chrono::milliseconds handshakeTimeout,
+              ConnectionTimeouts timeouts);
 
   virtual std::unique_ptr<Interfaces::IRequest> listen() final override;
+  virtual std::size_t
+  listenBatch(std::vector<std::unique_ptr<Interfaces::IRequest>>& batch,
+              std::size_t maxBatchSize) final override;
+  virtual std::unique_ptr<Interfaces::IRequest> adopt(int socket)
+    final override;
+  virtual int getDescriptor() const final override;
+  virtual void shutdown() final override;
+
+  struct KernelTLSStatistics
+  {
+    std::uint64_t offloaded;     // Both directions handled by the kernel
+    std::uint64_t notOffloaded;  // At least one left in userspace
+  };
+
+  // May be called from any thread.
+  SessionStatistics getSessionStatistics() const;
+  KernelTLSStatistics getKernelTLSStatistics() const;
 
   class Builder;
 
 private:
   struct TLSHandler;
 
-  SSL_CTX* createContext() const;
+  SSL_CTX* createContext();
 
   const std::string m_certificateFile;
   const std::string m_privateKeyFile;
+  const SessionConfiguration m_sessionConfiguration;
+  const KernelTLSMode m_kernelTLSMode;
+  // Owned by the context.
+  TLSSessionCache* m_sessionCache;
+  TLSTicketKeys* m_ticketKeys;
   std::shared_ptr<SSL_CTX> m_sslContext;
   std::unique_ptr<struct TLSHandler> m_tlsHandler;
-  TCPListener<HostType> m_listener;
+  // Calls the handshake handler directly, rather than through a second
+  // std::function.
+  TCPListener<HostType, std::reference_wrapper<TLSHandler>> m_listener;
   const bool m_useTwoWayAuthentication;
-  std::function<void(SSL*,const HostType&)> m_userHandler;
   std::function<void(const std::string&)> m_logStream;
 };
 
-template<class HostType>
-struct Networking::TCP::TLSListener<HostType>::TLSHandler
+template<class HostType, class Handler>
+struct Networking::TCP::TLSListener<HostType, Handler>::TLSHandler
 {
-  TLSHandler(std::shared_ptr<SSL_CTX> sslContext,
-             std::function<void(SSL*,const HostType&)> userHandler,
+  TLSHandler(std::shared_ptr<SSL_CTX> sslContext, Handler userHandler,
              HandshakeFailureAction handshakeFailureAction,
+             KernelTLSMode kernelTLSMode,
+             std::chrono::milliseconds handshakeTimeout,
+             std::chrono::milliseconds readWriteTimeout,
              std::function<void(const std::string&)> logStream);
-  void operator()(unsigned int, const HostType&);
+  void operator()(unsigned int, const PeerAddress&);
+
+  std::atomic<std::uint64_t> m_fullHandshakes;
+  std::atomic<std::uint64_t> m_resumedHandshakes;
+  std::atomic<std::uint64_t> m_kernelTLSOffloaded;
+  std::atomic<std::uint64_t> m_kernelTLSNotOffloaded;
 
 private:
-  std::shared_ptr<SSL> m_ssl;
-  std::shared_ptr<SSL_CTX> m_sslContext;
-  std::function<void(SSL*,const HostType&)> m_userHandler;
-  HandshakeFailureAction m_handshakeFailureAction;
+  using SSLPointer = std::unique_ptr<SSL, void(*)(SSL*)>;
+  struct PendingHandshake;
+
+  void serve(SSLPointer ssl, unsigned int socket,
+             const PeerAddress& clientAddress);
+#ifdef NETWORKING_COROUTINES
+  Task<> serve(EventLoop& loop, SSLPointer ssl, int socket,
+               PeerAddress clientAddress);
+#endif
+  void continueHandshake(EventLoop& loop, PendingHandshake& pending);
+  // Called once the handshake is over, whether or not it succeeded.
+  void complete(SSL* ssl, const TLSHandshake& handshake,
+                const PeerAddress& clientAddress);
+  // Counts the handshake, and whether the connection may be handed to the
+  // user handler. Throws if not, with the THROW failure action.
+  bool admit(SSL* ssl, const TLSHandshake& handshake,
+             const PeerAddress& clientAddress);
+
+  // Read-only once constructed; see the contract above.
+  const std::shared_ptr<SSL_CTX> m_sslContext;
+  Handler m_userHandler;
+  const HandshakeFailureAction m_handshakeFailureAction;
+  const KernelTLSMode m_kernelTLSMode;
+  const std::chrono::milliseconds m_handshakeTimeout;
+  const std::chrono::milliseconds m_readWriteTimeout;
   std::function<void(const std::string&)> m_logStream;
 };
 
-template<class HostType>
-class Networking::TCP::TLSListener<HostType>::Builder
+template<class HostType, class Handler>
+class Networking::TCP::TLSListener<HostType, Handler>::Builder
 {
 public:
   Builder();
   Builder setListeningAddress(HostType);
   Builder setBacklogSize(unsigned int);
   Builder setReuseAddress(bool);
+  Builder setReusePort(bool);
+  Builder setV6Only(bool);
   Builder setBlocking(bool);
   Builder setMaskSigPipe(bool);
   Builder setTwoWayAuthentication(bool);
   Builder setHandshakeFailureAction(HandshakeFailureAction);
   Builder setCertificateFile(std::string);
   Builder setPrivateKeyFile(std::string);
-  using UserHandler = std::function<void(SSL*,const HostType&)>;
+  Builder setSessionCacheSize(std::size_t);
+  Builder setSessionCacheShards(unsigned int);
+  Builder setSessionTimeout(std::chrono::seconds);
+  Builder setSessionTickets(bool);
+  Builder setTicketKeyRotation(std::chrono::seconds);
+  // Once the handshake completes, hand record encryption to the kernel, so
+  // that the user handler may use the socket directly. Disabled by default.
+  Builder setKernelTLS(KernelTLSMode);
+  // Clients that have not completed the handshake within this time are
+  // disconnected. 10 seconds by default.
+  Builder setHandshakeTimeout(std::chrono::milliseconds);
+  // How long a connection may stall before it is closed (see
+  // ConnectionTimeouts.h), from the handshake on. Not enforced by default.
+  Builder setTimeouts(ConnectionTimeouts);
+  // Required, unless Handler can be constructed from a function pointer
+  // (in which case it defaults to doing nothing).
+  using UserHandler = Handler;
   Builder setUserHandler(UserHandler userHandler);
   Builder setLogStream(std::function<void(const std::string&)> logStream);
 
@@ -100,13 +227,20 @@ private:
   HostType listeningAddress;
   unsigned int backlogSize = 8;
   bool reuseAddress = true;
+  bool reusePort = false;
+  bool v6Only = false;
   bool blocking = true;
   bool maskSigPipe = true;
   bool twoWayAuthentication = false;
   HandshakeFailureAction failureAction = HandshakeFailureAction::NOTHING;
   std::string certificateFile = ""; // NO DEFAULT
   std::string privateKeyFile = ""; // NO DEFAULT
-  UserHandler userHandler = [](SSL*,const HostType&){ return; };
+  SessionConfiguration sessionConfiguration =
+    {20480, 16, std::chrono::seconds{300}, true, std::chrono::hours{1}};
+  KernelTLSMode kernelTLSMode = KTLS_DISABLED;
+  std::chrono::milliseconds handshakeTimeout = std::chrono::seconds{10};
+  ConnectionTimeouts timeouts = {};
+  std::optional<UserHandler> userHandler;
   std::function<void(const std::string&)> logStream =
     [](const std::string& message)
   {
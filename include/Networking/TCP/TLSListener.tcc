@@ -7,61 +7,127 @@
 //
 // CREATED:         04/04/2020
 //
-// LAST EDITED:     05/01/2020
+// LAST EDITED:     10/18/2026
 ////
 
+#include <Networking/FileDescriptor.h>
 #include <Networking/Interfaces/IRequest.h>
 #include <Networking/NetworkHost.h>
+#include <Networking/PeerAddress.h>
 #include <Networking/TCP/TLSException.h>
 #include <Networking/TCP/TLSListener.h>
 
 #include <openssl/ssl.h>
 #include <openssl/err.h>
 
-std::string getSSLErrors()
-{
-  BIO* bio = BIO_new(BIO_s_mem());
-  ERR_print_errors(bio);
-  char* buf = nullptr;
-  BIO_get_mem_data(bio, &buf);
-  return std::string{buf};
-}
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
 
-template<class HostType>
-Networking::TCP::TLSListener<HostType>
+template<class HostType, class Handler>
+Networking::TCP::TLSListener<HostType, Handler>
 ::TLSListener(HostType acceptedClients, unsigned int theBacklogSize,
-              bool reuseAddress, bool blocking, bool maskSigPipe,
+              bool reuseAddress, bool reusePort, bool v6Only, bool blocking,
+              bool maskSigPipe,
               bool useTwoWayAuthentication, HandshakeFailureAction action,
               std::string certificateFile, std::string privateKeyFile,
-              std::function<void(SSL*,const HostType&)> userHandler,
-              std::function<void(const std::string&)> logStream)
+              Handler userHandler,
+              std::function<void(const std::string&)> logStream,
+              SessionConfiguration sessionConfiguration,
+              KernelTLSMode kernelTLSMode,
+              std::chrono::milliseconds handshakeTimeout,
+              ConnectionTimeouts timeouts)
   : m_certificateFile{certificateFile}, m_privateKeyFile{privateKeyFile},
+    m_sessionConfiguration{sessionConfiguration},
+    m_kernelTLSMode{kernelTLSMode}, m_sessionCache{nullptr},
+    m_ticketKeys{nullptr},
     m_sslContext{createContext(), [](SSL_CTX* context)
         {
           SSL_CTX_free(context);
         }},
     m_tlsHandler{std::make_unique<struct TLSHandler>
-        (m_sslContext, userHandler, action, logStream)},
-    m_listener{acceptedClients, theBacklogSize, reuseAddress, blocking,
-        maskSigPipe, std::ref(*m_tlsHandler), logStream},
+        (m_sslContext, std::move(userHandler), action, kernelTLSMode,
+         handshakeTimeout, timeouts.readWrite, logStream)},
+    m_listener{acceptedClients, theBacklogSize, reuseAddress, reusePort,
+        v6Only, blocking, maskSigPipe, std::ref(*m_tlsHandler), logStream,
+        timeouts},
     m_useTwoWayAuthentication{useTwoWayAuthentication},
-    m_userHandler{userHandler}, m_logStream{logStream}
+    m_logStream{logStream}
 {}
 
-template<class HostType>
+template<class HostType, class Handler>
 std::unique_ptr<Networking::Interfaces::IRequest>
-Networking::TCP::TLSListener<HostType>::listen()
+Networking::TCP::TLSListener<HostType, Handler>::listen()
 {
   return m_listener.listen();
 }
 
-template<class HostType>
-SSL_CTX* Networking::TCP::TLSListener<HostType>::createContext() const
+template<class HostType, class Handler>
+std::size_t
+Networking::TCP::TLSListener<HostType, Handler>
+::listenBatch(std::vector<std::unique_ptr<Interfaces::IRequest>>& batch,
+              std::size_t maxBatchSize)
+{
+  return m_listener.listenBatch(batch, maxBatchSize);
+}
+
+template<class HostType, class Handler>
+std::unique_ptr<Networking::Interfaces::IRequest>
+Networking::TCP::TLSListener<HostType, Handler>::adopt(int socket)
+{
+  return m_listener.adopt(socket);
+}
+
+template<class HostType, class Handler>
+int Networking::TCP::TLSListener<HostType, Handler>::getDescriptor() const
 {
-  SSL_CTX* context = nullptr;
+  return m_listener.getDescriptor();
+}
+
+template<class HostType, class Handler>
+void Networking::TCP::TLSListener<HostType, Handler>::shutdown()
+{
+  m_listener.shutdown();
+}
+
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::SessionStatistics
+Networking::TCP::TLSListener<HostType, Handler>::getSessionStatistics() const
+{
+  SessionStatistics statistics{m_tlsHandler->m_fullHandshakes.load(),
+      m_tlsHandler->m_resumedHandshakes.load(), {}, {}};
+  if (nullptr != m_sessionCache)
+    {
+      statistics.cache = m_sessionCache->getStatistics();
+    }
+  if (nullptr != m_ticketKeys)
+    {
+      statistics.tickets = m_ticketKeys->getStatistics();
+    }
+  return statistics;
+}
+
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::KernelTLSStatistics
+Networking::TCP::TLSListener<HostType, Handler>::getKernelTLSStatistics()
+  const
+{
+  return KernelTLSStatistics{m_tlsHandler->m_kernelTLSOffloaded.load(),
+      m_tlsHandler->m_kernelTLSNotOffloaded.load()};
+}
+
+template<class HostType, class Handler>
+SSL_CTX* Networking::TCP::TLSListener<HostType, Handler>::createContext()
+{
+  // Freed if configuration fails part way.
+  std::unique_ptr<SSL_CTX, void(*)(SSL_CTX*)> context{nullptr, SSL_CTX_free};
 
   const SSL_METHOD* method = TLS_server_method();
-  context = SSL_CTX_new(method);
+  context.reset(SSL_CTX_new(method));
   if (!context)
     {
       throw std::runtime_error{"Unable to create SSL context: "
@@ -69,15 +135,17 @@ SSL_CTX* Networking::TCP::TLSListener<HostType>::createContext() const
     }
 
   // TODO: Throw a std::logic_error if the cert paths are not set.
-  SSL_CTX_set_ecdh_auto(context, 1);
-  if (0 >= SSL_CTX_use_certificate_file(context, m_certificateFile.c_str(),
+  SSL_CTX_set_ecdh_auto(context.get(), 1);
+  if (0 >= SSL_CTX_use_certificate_file(context.get(),
+                                        m_certificateFile.c_str(),
                                         SSL_FILETYPE_PEM))
     {
       throw std::runtime_error{"Unable to create SSL context: "
           + getSSLErrors()};
     }
 
-  if (0 >= SSL_CTX_use_PrivateKey_file(context, m_privateKeyFile.c_str(),
+  if (0 >= SSL_CTX_use_PrivateKey_file(context.get(),
+                                       m_privateKeyFile.c_str(),
                                        SSL_FILETYPE_PEM))
     {
       throw std::runtime_error{"Unable to create SSL context: "
@@ -85,150 +153,478 @@ SSL_CTX* Networking::TCP::TLSListener<HostType>::createContext() const
     }
 
   // TODO: Call SSL_CTX_check_private_key()
-  return context;
+
+  SSL_CTX_set_timeout(context.get(), m_sessionConfiguration.timeout.count());
+  if (0 < m_sessionConfiguration.cacheSize)
+    {
+      m_sessionCache = &TLSSessionCache::attach
+        (context.get(), m_sessionConfiguration.cacheSize,
+         m_sessionConfiguration.cacheShards);
+    }
+  else
+    {
+      SSL_CTX_set_session_cache_mode(context.get(), SSL_SESS_CACHE_OFF);
+    }
+
+  if (m_sessionConfiguration.tickets)
+    {
+      m_ticketKeys = &TLSTicketKeys::attach
+        (context.get(), m_sessionConfiguration.ticketKeyRotation);
+    }
+  else
+    {
+      // TLS 1.3 then issues tickets that refer to the session cache.
+      SSL_CTX_set_options(context.get(), SSL_OP_NO_TICKET);
+    }
+
+  configureKernelTLS(context.get(), m_kernelTLSMode);
+  return context.release();
 }
 
-template<class HostType>
-Networking::TCP::TLSListener<HostType>::TLSHandler
-::TLSHandler(std::shared_ptr<SSL_CTX> sslContext,
-             std::function<void(SSL*,const HostType&)> userHandler,
+template<class HostType, class Handler>
+Networking::TCP::TLSListener<HostType, Handler>::TLSHandler
+::TLSHandler(std::shared_ptr<SSL_CTX> sslContext, Handler userHandler,
              HandshakeFailureAction handshakeFailureAction,
+             KernelTLSMode kernelTLSMode,
+             std::chrono::milliseconds handshakeTimeout,
+             std::chrono::milliseconds readWriteTimeout,
              std::function<void(const std::string&)> logStream)
-  : m_ssl{nullptr}, m_sslContext{sslContext}, m_userHandler{userHandler},
-    m_handshakeFailureAction{handshakeFailureAction}, m_logStream{logStream}
+  : m_fullHandshakes{0}, m_resumedHandshakes{0}, m_kernelTLSOffloaded{0},
+    m_kernelTLSNotOffloaded{0}, m_sslContext{sslContext},
+    m_userHandler{std::move(userHandler)},
+    m_handshakeFailureAction{handshakeFailureAction},
+    m_kernelTLSMode{kernelTLSMode}, m_handshakeTimeout{handshakeTimeout},
+    m_readWriteTimeout{readWriteTimeout}, m_logStream{logStream}
 {}
 
-template<class HostType>
-void Networking::TCP::TLSListener<HostType>::TLSHandler
-::operator()(unsigned int socket, const HostType& clientAddress)
+// A handshake in progress on an EventLoop, which lives with the callback of
+// the socket, and the timer on the loop that enforces its deadline.
+template<class HostType, class Handler>
+struct Networking::TCP::TLSListener<HostType, Handler>::TLSHandler
+::PendingHandshake
+{
+  PendingHandshake(TLSHandler& handler, EventLoop& loop, SSLPointer ssl,
+                   TLSHandshake handshake, PeerAddress clientAddress,
+                   int socket);
+
+  SSLPointer ssl;
+  TLSHandshake handshake;
+  PeerAddress clientAddress;
+  int socket;
+  TimerWheel::Timer timer;
+};
+
+template<class HostType, class Handler>
+Networking::TCP::TLSListener<HostType, Handler>::TLSHandler::PendingHandshake
+::PendingHandshake(TLSHandler& handler, EventLoop& loop,
+                   SSLPointer theSSL, TLSHandshake theHandshake,
+                   PeerAddress theClientAddress, int theSocket)
+  : ssl{std::move(theSSL)}, handshake{theHandshake},
+    clientAddress{theClientAddress}, socket{theSocket},
+    timer{[this, &handler, &loop]()
+      {
+        handshake.expire();
+        handler.continueHandshake(loop, *this);
+      }}
+{}
+
+template<class HostType, class Handler>
+void Networking::TCP::TLSListener<HostType, Handler>::TLSHandler
+::operator()(unsigned int socket, const PeerAddress& clientAddress)
+{
+  // This may be running on any of the Delegator's threads, concurrently
+  // with the handling of other requests. SSL_new() only reads the SSL_CTX
+  // (and takes a reference to it atomically), which OpenSSL permits from
+  // any number of threads, so no lock is needed as long as the context is
+  // never reconfigured once the listener is constructed.
+  //
+  // The SSL is the state of this connection alone. It lives here, or with
+  // the registration of the socket while the handshake is pending on an
+  // EventLoop, and so with the request. We must pass the raw pointer to the
+  // user, because the OpenSSL library functions require one. It must not
+  // outlive the connection: the socket is closed once the request has been
+  // handled, and the descriptor may then be reused for the next connection.
+  SSLPointer ssl{SSL_new(m_sslContext.get()), SSL_free};
+  if (!ssl)
+    {
+      throw std::runtime_error{"Unable to create SSL: " + getSSLErrors()};
+    }
+
+  SSL_set_fd(ssl.get(), socket);
+  SSL_set_accept_state(ssl.get());
+
+#ifdef NETWORKING_COROUTINES
+  if constexpr (isAsyncHandler<Handler, HostType>)
+    {
+      EventLoop* loop = EventLoop::current();
+      if (nullptr == loop)
+        {
+          throw std::logic_error{"TLSListener: coroutine handlers must be"
+              " run by an EventLoop (e.g. by the NonBlockingServer)"};
+        }
+      spawn(serve(*loop, std::move(ssl), socket, clientAddress),
+            m_logStream);
+    }
+  else
+#endif
+    {
+      serve(std::move(ssl), socket, clientAddress);
+    }
+}
+
+template<class HostType, class Handler>
+void Networking::TCP::TLSListener<HostType, Handler>::TLSHandler
+::serve(SSLPointer ssl, unsigned int socket,
+        const PeerAddress& clientAddress)
 {
-  // Use the shared_ptr here because it allows for automatic destruction in
-  // case the flow of normal logic is interrupted (e.g. by exception).
-  // Unfortunately, however, we must pass the raw pointer to the user,
-  // because the OpenSSL library functions require a raw pointer.
-  m_ssl = std::shared_ptr<SSL>(SSL_new(m_sslContext.get()), [](SSL* ssl){
+  TLSHandshake handshake{ssl.get(),
+      std::chrono::steady_clock::now() + m_handshakeTimeout};
+
+  const int flags = ::fcntl(socket, F_GETFL);
+  if (-1 == flags)
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+
+  EventLoop* loop = EventLoop::current();
+  if (nullptr == loop || 0 == (flags & O_NONBLOCK))
+    {
+      // Drive the handshake here, but still only until the deadline.
+      if (0 == (flags & O_NONBLOCK)
+          && -1 == ::fcntl(socket, F_SETFL, flags | O_NONBLOCK))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+      handshake.run();
+      if (0 == (flags & O_NONBLOCK)
+          && -1 == ::fcntl(socket, F_SETFL, flags))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+      complete(ssl.get(), handshake, clientAddress);
+      return;
+    }
+
+  // Most resumed handshakes need go no further.
+  handshake.step();
+  if (handshake.isOver())
+    {
+      complete(ssl.get(), handshake, clientAddress);
+      return;
+    }
+
+  auto pending = std::make_shared<PendingHandshake>
+    (*this, *loop, std::move(ssl), handshake, clientAddress,
+     static_cast<int>(socket));
+  // The server adopts the request once this returns, as the socket is
+  // registered, so the connection stays open until it is removed.
+  loop->add(pending->socket, EventLoop::READABLE | EventLoop::WRITABLE,
+            [this, loop, pending](unsigned int)
+            {
+              pending->handshake.step();
+              continueHandshake(*loop, *pending);
+            });
+  loop->getTimers().schedule(pending->timer, handshake.getDeadline());
+}
+
+template<class HostType, class Handler>
+void Networking::TCP::TLSListener<HostType, Handler>::TLSHandler
+::continueHandshake(EventLoop& loop, PendingHandshake& pending)
+{
+  if (!pending.handshake.isOver())
+    {
+      return;
+    }
+
+  // The callback, and with it the pending handshake and the request, is
+  // destroyed after this round, so the socket is open until then.
+  loop.getTimers().cancel(pending.timer);
+  loop.remove(pending.socket);
+  complete(pending.ssl.get(), pending.handshake, pending.clientAddress);
+}
+
+template<class HostType, class Handler>
+void Networking::TCP::TLSListener<HostType, Handler>::TLSHandler
+::complete(SSL* ssl, const TLSHandshake& handshake,
+           const PeerAddress& clientAddress)
+{
+  if (!admit(ssl, handshake, clientAddress))
+    {
+      return;
+    }
+
+  try
+    {
+      if constexpr (std::is_invocable_v<Handler&, SSL*, const PeerAddress&>)
+        {
+          m_userHandler(ssl, clientAddress);
+        }
+      else
+        {
+          m_userHandler(ssl, HostType{clientAddress.getNetworkAddress()});
+        }
+    }
+  catch (...)
+    {
       SSL_shutdown(ssl);
-      SSL_free(ssl);
-    });
-  SSL* sslRaw = m_ssl.get();
-
-  // TODO: Race conditions?
-  //   The TLSHandler operator() is called after the Delegator has dispatched
-  //   the handler function received by the TCPListener constructor, meaning
-  //   that there's a possibility that we could be running in a thread
-  //   separate from the TLSListener's main thread. This means that there's a
-  //   possibility for multiple threads to vie for concurrent access of the
-  //   SSL_CTX owned by the TLSListener instance. Look into whether this needs
-  //   to be protected using a mutex.
-  SSL_set_fd(sslRaw, socket);
-  if (0 >= SSL_accept(sslRaw))
+      throw;
+    }
+  SSL_shutdown(ssl);
+}
+
+#ifdef NETWORKING_COROUTINES
+template<class HostType, class Handler>
+Networking::Task<> Networking::TCP::TLSListener<HostType, Handler>
+::TLSHandler::serve(EventLoop& loop, SSLPointer ssl, int socket,
+                    PeerAddress clientAddress)
+{
+  // The stream registers the socket, so once this first suspends, the
+  // server adopts the request, and the connection stays open until the
+  // stream is destroyed.
+  AsyncStream stream{loop, socket, ssl.get()};
+  const TLSHandshake handshake = co_await stream.handshake
+    (std::chrono::steady_clock::now() + m_handshakeTimeout);
+  if (!admit(ssl.get(), handshake, clientAddress))
+    {
+      co_return;
+    }
+  stream.setTimeout(m_readWriteTimeout);
+
+  if constexpr (std::is_invocable_v<Handler&, AsyncStream,
+                                    const PeerAddress&>)
+    {
+      co_await m_userHandler(std::move(stream), clientAddress);
+    }
+  else
+    {
+      co_await m_userHandler(std::move(stream),
+                             HostType{clientAddress.getNetworkAddress()});
+    }
+  SSL_shutdown(ssl.get());
+}
+#endif
+
+template<class HostType, class Handler>
+bool Networking::TCP::TLSListener<HostType, Handler>::TLSHandler
+::admit(SSL* ssl, const TLSHandshake& handshake,
+        const PeerAddress& clientAddress)
+{
+  if (TLSHandshake::COMPLETE != handshake.getStatus())
     {
       if (m_handshakeFailureAction == HandshakeFailureAction::NOTHING)
         {
-          return;
+          return false;
         }
       else
         {
           const std::string sslErrors = "Client "
             + clientAddress.string()
-            + " failed TLS handshake; error trace:\n" + getSSLErrors()
+            + " failed TLS handshake; error trace:\n"
+            + handshake.getErrors()
             + "Severing connection.";
-          throw TLSException(sslErrors, clientAddress);
+          throw TLSException(sslErrors,
+                             HostType{clientAddress.getNetworkAddress()});
         }
     }
 
-  m_userHandler(sslRaw, clientAddress);
+  if (SSL_session_reused(ssl))
+    {
+      ++m_resumedHandshakes;
+    }
+  else
+    {
+      ++m_fullHandshakes;
+    }
+
+  if (KTLS_DISABLED != m_kernelTLSMode)
+    {
+      const std::string reason = checkKernelTLS(ssl);
+      if (reason.empty())
+        {
+          ++m_kernelTLSOffloaded;
+        }
+      else
+        {
+          ++m_kernelTLSNotOffloaded;
+          const std::string message = "Client " + clientAddress.string()
+            + ": " + reason;
+          if (KTLS_PREFERRED == m_kernelTLSMode
+              || m_handshakeFailureAction == HandshakeFailureAction::NOTHING)
+            {
+              m_logStream(message);
+            }
+          if (KTLS_REQUIRED == m_kernelTLSMode)
+            {
+              if (m_handshakeFailureAction == HandshakeFailureAction::NOTHING)
+                {
+                  return false;
+                }
+              throw TLSException(message + "; severing connection.",
+                                 HostType{clientAddress.getNetworkAddress()});
+            }
+        }
+    }
+  return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // TLSListener::Builder
 ////
 
-template<>
-Networking::TCP::TLSListener<Networking::NetworkHost>::Builder
+template<class HostType, class Handler>
+Networking::TCP::TLSListener<HostType, Handler>::Builder
 ::Builder()
   : listeningAddress{"127.0.0.1", 443}
-{}
-
-template<>
-Networking::TCP::TLSListener<Networking::NetworkAddress>::Builder
-::Builder()
-  : listeningAddress{INADDR_LOOPBACK, 443}
-{}
+{
+  using NoHandler = void(*)(SSL*,const HostType&);
+  if constexpr (std::is_constructible_v<UserHandler, NoHandler>)
+    {
+      userHandler.emplace(NoHandler{[](SSL*,const HostType&){}});
+    }
+}
 
-template<class HostType>
-typename Networking::TCP::TLSListener<HostType>::Builder
-Networking::TCP::TLSListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
 ::setListeningAddress(HostType theListeningAddress)
 { listeningAddress = theListeningAddress; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TLSListener<HostType>::Builder
-Networking::TCP::TLSListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
 ::setBacklogSize(unsigned int theBacklogSize)
 { backlogSize = theBacklogSize; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TLSListener<HostType>::Builder
-Networking::TCP::TLSListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
 ::setReuseAddress(bool isReuseAddress)
 { reuseAddress = isReuseAddress; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TLSListener<HostType>::Builder
-Networking::TCP::TLSListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
+::setReusePort(bool isReusePort)
+{ reusePort = isReusePort; return *this; }
+
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
+::setV6Only(bool isV6Only)
+{ v6Only = isV6Only; return *this; }
+
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
 ::setBlocking(bool isBlocking)
 { blocking = isBlocking; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TLSListener<HostType>::Builder
-Networking::TCP::TLSListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
 ::setMaskSigPipe(bool isMaskingSigPipe)
 { maskSigPipe = isMaskingSigPipe; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TLSListener<HostType>::Builder
-Networking::TCP::TLSListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
 ::setTwoWayAuthentication(bool theTwoWayAuthentication)
 { twoWayAuthentication = theTwoWayAuthentication; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TLSListener<HostType>::Builder
-Networking::TCP::TLSListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
 ::setHandshakeFailureAction(HandshakeFailureAction theFailureAction)
 { failureAction = theFailureAction; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TLSListener<HostType>::Builder
-Networking::TCP::TLSListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
 ::setCertificateFile(std::string theCertificateFile)
 { certificateFile = theCertificateFile; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TLSListener<HostType>::Builder
-Networking::TCP::TLSListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
 ::setPrivateKeyFile(std::string thePrivateKeyFile)
 { privateKeyFile = thePrivateKeyFile; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TLSListener<HostType>::Builder
-Networking::TCP::TLSListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
+::setSessionCacheSize(std::size_t theCacheSize)
+{ sessionConfiguration.cacheSize = theCacheSize; return *this; }
+
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
+::setSessionCacheShards(unsigned int theCacheShards)
+{ sessionConfiguration.cacheShards = theCacheShards; return *this; }
+
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
+::setSessionTimeout(std::chrono::seconds theTimeout)
+{ sessionConfiguration.timeout = theTimeout; return *this; }
+
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
+::setSessionTickets(bool isUsingTickets)
+{ sessionConfiguration.tickets = isUsingTickets; return *this; }
+
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
+::setKernelTLS(KernelTLSMode theKernelTLSMode)
+{ kernelTLSMode = theKernelTLSMode; return *this; }
+
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
+::setHandshakeTimeout(std::chrono::milliseconds theHandshakeTimeout)
+{ handshakeTimeout = theHandshakeTimeout; return *this; }
+
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
+::setTimeouts(ConnectionTimeouts theTimeouts)
+{ timeouts = theTimeouts; return *this; }
+
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
+::setTicketKeyRotation(std::chrono::seconds theRotationInterval)
+{
+  sessionConfiguration.ticketKeyRotation = theRotationInterval;
+  return *this;
+}
+
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
 ::setUserHandler(UserHandler theUserHandler)
-{ userHandler = theUserHandler; return *this; }
+{ userHandler.emplace(std::move(theUserHandler)); return *this; }
 
-template<class HostType>
-typename Networking::TCP::TLSListener<HostType>::Builder
-Networking::TCP::TLSListener<HostType>::Builder
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>::Builder
+Networking::TCP::TLSListener<HostType, Handler>::Builder
 ::setLogStream(std::function<void(const std::string&)> theLogStream)
 { logStream = theLogStream; return *this; }
 
-template<class HostType>
-typename Networking::TCP::TLSListener<HostType>
-Networking::TCP::TLSListener<HostType>::Builder::build() const
+template<class HostType, class Handler>
+typename Networking::TCP::TLSListener<HostType, Handler>
+Networking::TCP::TLSListener<HostType, Handler>::Builder::build() const
 {
-  return TLSListener<HostType>{listeningAddress, backlogSize, reuseAddress,
-      blocking, maskSigPipe, twoWayAuthentication, failureAction,
-      certificateFile, privateKeyFile, userHandler, logStream};
+  if (!userHandler)
+    {
+      throw std::logic_error{"TLSListener::Builder: a user handler is"
+          " required for this handler type"};
+    }
+  return TLSListener{listeningAddress, backlogSize, reuseAddress, reusePort,
+      v6Only, blocking, maskSigPipe, twoWayAuthentication, failureAction,
+      certificateFile, privateKeyFile, *userHandler, logStream,
+      sessionConfiguration, kernelTLSMode, handshakeTimeout, timeouts};
 }
 
 ///////////////////////////////////////////////////////////////////////////////
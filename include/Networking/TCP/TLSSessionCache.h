@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSSessionCache.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Server-side TLS session cache, replacing the one built into
+//                  OpenSSL. Sessions are spread across shards, each with its
+//                  own lock and LRU list, so that handshakes on different
+//                  threads rarely contend.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_TLSSESSIONCACHE__
+#define __ET_TLSSESSIONCACHE__
+
+#include <namespaces/Networking.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Need forward declaration for compilation
+typedef struct ssl_ctx_st SSL_CTX;
+typedef struct ssl_session_st SSL_SESSION;
+
+class Networking::TCP::TLSSessionCache
+{
+public:
+  struct Statistics
+  {
+    std::uint64_t hits;        // Lookups that resumed a session
+    std::uint64_t misses;      // Lookups for unknown or expired sessions
+    std::uint64_t evictions;   // Sessions dropped to stay within capacity
+    std::size_t size;          // Sessions currently cached
+  };
+
+  // Creates a cache holding up to capacity sessions, each for as long as the
+  // context's session timeout, and installs it in context. The cache belongs
+  // to the context, and is destroyed along with it.
+  static TLSSessionCache& attach(SSL_CTX* context, std::size_t capacity,
+                                 unsigned int numShards);
+
+  TLSSessionCache(const TLSSessionCache&) = delete;
+  TLSSessionCache& operator=(const TLSSessionCache&) = delete;
+  ~TLSSessionCache();
+
+  // May be called from any thread.
+  Statistics getStatistics() const;
+
+private:
+  struct Entry
+  {
+    std::string id;
+    SSL_SESSION* session;
+    std::chrono::steady_clock::time_point expiry;
+  };
+
+  struct Shard
+  {
+    std::mutex mutex;
+    // Most recently used first.
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+  };
+
+  TLSSessionCache(std::size_t capacity, unsigned int numShards);
+
+  Shard& getShard(const std::string& id);
+  bool insert(SSL_SESSION* session);
+  SSL_SESSION* find(const std::string& id);
+  void erase(SSL_SESSION* session);
+
+  static int contextIndex();
+  static TLSSessionCache* fromContext(SSL_CTX* context);
+
+  // OpenSSL callbacks
+  static int newSession(SSL* ssl, SSL_SESSION* session);
+  static SSL_SESSION* getSession(SSL* ssl, const unsigned char* id,
+                                 int length, int* copy);
+  static void removeSession(SSL_CTX* context, SSL_SESSION* session);
+
+  const std::size_t m_shardCapacity;
+  std::vector<std::unique_ptr<Shard>> m_shards;
+  std::atomic<std::uint64_t> m_hits;
+  std::atomic<std::uint64_t> m_misses;
+  std::atomic<std::uint64_t> m_evictions;
+};
+
+#endif // __ET_TLSSESSIONCACHE__
+
+///////////////////////////////////////////////////////////////////////////////
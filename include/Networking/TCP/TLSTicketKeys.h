@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSTicketKeys.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Keys for stateless TLS session tickets. A new key is
+//                  generated every rotation interval. Tickets issued under the
+//                  previous key are still accepted, and renewed, so that a
+//                  ticket lives for at most two intervals.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_TLSTICKETKEYS__
+#define __ET_TLSTICKETKEYS__
+
+#include <namespaces/Networking.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#include <openssl/opensslv.h>
+
+// Need forward declaration for compilation
+typedef struct ssl_ctx_st SSL_CTX;
+typedef struct evp_cipher_ctx_st EVP_CIPHER_CTX;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+typedef struct evp_mac_ctx_st EVP_MAC_CTX;
+#else
+typedef struct hmac_ctx_st HMAC_CTX;
+#endif
+
+class Networking::TCP::TLSTicketKeys
+{
+public:
+  struct Statistics
+  {
+    std::uint64_t issued;      // Tickets encrypted for clients
+    std::uint64_t accepted;    // Tickets decrypted with the current key
+    std::uint64_t renewed;     // Tickets decrypted with the previous key
+    std::uint64_t rejected;    // Tickets under unknown (e.g. expired) keys
+    std::uint64_t rotations;   // Keys generated since attach()
+  };
+
+  // Creates the keys and installs them in context, which owns them, and
+  // destroys them along with itself.
+  static TLSTicketKeys& attach(SSL_CTX* context,
+                               std::chrono::seconds rotationInterval);
+
+  TLSTicketKeys(const TLSTicketKeys&) = delete;
+  TLSTicketKeys& operator=(const TLSTicketKeys&) = delete;
+  ~TLSTicketKeys();
+
+  // Generates a new key now. May be called from any thread.
+  void rotate();
+
+  // May be called from any thread.
+  Statistics getStatistics() const;
+
+private:
+  struct Key
+  {
+    unsigned char name[16];
+    unsigned char aesKey[32];
+    unsigned char hmacKey[32];
+  };
+
+  explicit TLSTicketKeys(std::chrono::seconds rotationInterval);
+
+  // Copy out the key for new tickets, or the key named name (returning 1
+  // for the current key, 2 for the previous one, or 0 if there is no such
+  // key). Both rotate the keys first if they are due.
+  Key getCurrentKey();
+  int findKey(const unsigned char* name, Key& key);
+
+  // Called with m_mutex held.
+  void rotateIfDueLocked();
+  void rotateLocked(std::chrono::steady_clock::time_point now);
+  static void generate(Key& key);
+
+  static int contextIndex();
+
+  // Called by OpenSSL to encrypt (encrypt = 1) or decrypt a ticket.
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  static int handleTicket(SSL* ssl, unsigned char* keyName,
+                          unsigned char* iv, EVP_CIPHER_CTX* cipherContext,
+                          EVP_MAC_CTX* macContext, int encrypt);
+#else
+  static int handleTicket(SSL* ssl, unsigned char* keyName,
+                          unsigned char* iv, EVP_CIPHER_CTX* cipherContext,
+                          HMAC_CTX* macContext, int encrypt);
+#endif
+
+  const std::chrono::seconds m_rotationInterval;
+  mutable std::mutex m_mutex;
+  Key m_current;
+  Key m_previous;
+  bool m_hasPrevious;
+  std::chrono::steady_clock::time_point m_nextRotation;
+  std::atomic<std::uint64_t> m_issued;
+  std::atomic<std::uint64_t> m_accepted;
+  std::atomic<std::uint64_t> m_renewed;
+  std::atomic<std::uint64_t> m_rejected;
+  std::atomic<std::uint64_t> m_rotations;
+};
+
+#endif // __ET_TLSTICKETKEYS__
+
+///////////////////////////////////////////////////////////////////////////////
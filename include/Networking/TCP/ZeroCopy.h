@@ -0,0 +1,60 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            ZeroCopy.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Bulk transmission for handlers, which moves data between
+//                  descriptors inside the kernel instead of copying it
+//                  through a userspace buffer.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_ZEROCOPY__
+#define __ET_ZEROCOPY__
+
+#include <namespaces/Networking.h>
+
+#include <cstddef>
+
+#include <sys/types.h>
+
+// Need forward declaration for compilation
+typedef struct ssl_st SSL;
+
+// None of these leave data half-sent: if the socket written to is
+// non-blocking, they wait for it to become writable. Each returns the
+// number of bytes sent, which is less than count only if the source ran
+// out first. They throw std::system_error if a call fails.
+namespace Networking
+{
+  namespace TCP
+  {
+    // Sends count bytes of file, starting at offset, with sendfile(2).
+    std::size_t sendFile(int socket, int file, off_t offset,
+                         std::size_t count);
+
+    // Moves up to count bytes from one descriptor to the other with
+    // splice(2), through a pipe kept for the calling thread. Either may be
+    // a socket. If from is non-blocking, returns early once it has nothing
+    // more to read.
+    std::size_t splice(int from, int to, std::size_t count);
+
+    // Sends count bytes of file, starting at offset, on a TLS connection.
+    // If kernel TLS encrypts the connection's writes, with SSL_sendfile(3),
+    // and the file never leaves the kernel. Otherwise, the file is read
+    // into a buffer one record at a time, and written with SSL_write(3).
+    // Throws std::runtime_error if the connection fails.
+    std::size_t sendFile(SSL* ssl, int file, off_t offset,
+                         std::size_t count);
+
+    // Whether writes on the connection are encrypted by the kernel.
+    bool isKernelTLSSend(SSL* ssl);
+  };
+};
+
+#endif // __ET_ZEROCOPY__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            Task.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     The return type of coroutine handlers and clients. A
+//                  Task does not start until it is awaited, and then runs
+//                  until it first suspends (e.g. on a read that would
+//                  block); the EventLoop resumes it when the socket is
+//                  ready. Only available if NETWORKING_COROUTINES is
+//                  defined (see namespaces/Networking.h).
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_TASK__
+#define __ET_TASK__
+
+#include <namespaces/Networking.h>
+
+#ifdef NETWORKING_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <string>
+
+namespace Networking
+{
+  // What a Task's promise keeps for its awaiter: the value it returned (if
+  // it returns one), or the exception that escaped it.
+  template<class T>
+  class TaskResult
+  {
+  public:
+    void return_value(T value);
+    T getResult();
+
+  protected:
+    std::optional<T> m_value;
+    std::exception_ptr m_exception;
+  };
+
+  template<>
+  class TaskResult<void>
+  {
+  public:
+    void return_void();
+    void getResult();
+
+  protected:
+    std::exception_ptr m_exception;
+  };
+
+  // Starts the task, and lets it run to completion on its own: its frame is
+  // freed when it finishes, and an exception that escapes it is logged.
+  void spawn(Task<> task,
+             // By default, simply send error messages to cerr.
+             std::function<void(const std::string&)> logStream
+             =[](const std::string& message)
+               {
+                 std::cerr << message << '\n';
+               });
+};
+
+// Awaiting a Task runs it, and evaluates to what it returns (or rethrows
+// what it throws). When it finishes, its awaiter is resumed directly, so a
+// chain of awaited tasks does not grow the stack.
+template<class T>
+class Networking::Task
+{
+public:
+  class promise_type;
+  using Handle = std::coroutine_handle<promise_type>;
+
+  Task(Task&& other) noexcept;
+  Task& operator=(Task&&) = delete;
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+  ~Task();
+
+  bool await_ready() const noexcept;
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter)
+    noexcept;
+  T await_resume();
+
+private:
+  friend void spawn(Task<> task,
+                    std::function<void(const std::string&)> logStream);
+
+  explicit Task(Handle handle);
+
+  Handle m_handle;
+};
+
+template<class T>
+class Networking::Task<T>::promise_type : public TaskResult<T>
+{
+public:
+  class FinalAwaiter;
+
+  Task get_return_object();
+  std::suspend_always initial_suspend() noexcept;
+  FinalAwaiter final_suspend() noexcept;
+  void unhandled_exception() noexcept;
+
+private:
+  friend class Task;
+  friend void spawn(Task<> task,
+                    std::function<void(const std::string&)> logStream);
+
+  // Resumed when the task finishes, unless it was spawned.
+  std::coroutine_handle<> m_awaiter;
+  bool m_detached = false;
+  std::function<void(const std::string&)> m_logStream;
+};
+
+#include <Networking/Task.tcc>
+
+#endif // NETWORKING_COROUTINES
+
+#endif // __ET_TASK__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,177 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            Task.tcc
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the coroutine Task.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/Task.h>
+
+#include <exception>
+#include <utility>
+
+template<class T>
+void Networking::TaskResult<T>::return_value(T value)
+{
+  m_value.emplace(std::move(value));
+}
+
+template<class T>
+T Networking::TaskResult<T>::getResult()
+{
+  if (m_exception)
+    {
+      std::rethrow_exception(m_exception);
+    }
+  return std::move(*m_value);
+}
+
+inline void Networking::TaskResult<void>::return_void()
+{}
+
+inline void Networking::TaskResult<void>::getResult()
+{
+  if (m_exception)
+    {
+      std::rethrow_exception(m_exception);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Task
+////
+
+template<class T>
+Networking::Task<T>::Task(Handle handle)
+  : m_handle{handle}
+{}
+
+template<class T>
+Networking::Task<T>::Task(Task&& other) noexcept
+  : m_handle{std::exchange(other.m_handle, nullptr)}
+{}
+
+template<class T>
+Networking::Task<T>::~Task()
+{
+  if (m_handle)
+    {
+      m_handle.destroy();
+    }
+}
+
+template<class T>
+bool Networking::Task<T>::await_ready() const noexcept
+{
+  return false;
+}
+
+template<class T>
+std::coroutine_handle<>
+Networking::Task<T>::await_suspend(std::coroutine_handle<> awaiter) noexcept
+{
+  m_handle.promise().m_awaiter = awaiter;
+  return m_handle;
+}
+
+template<class T>
+T Networking::Task<T>::await_resume()
+{
+  return m_handle.promise().getResult();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Task::promise_type
+////
+
+template<class T>
+class Networking::Task<T>::promise_type::FinalAwaiter
+{
+public:
+  bool await_ready() const noexcept { return false; }
+  std::coroutine_handle<> await_suspend(Handle handle) noexcept;
+  void await_resume() const noexcept {}
+};
+
+template<class T>
+Networking::Task<T> Networking::Task<T>::promise_type::get_return_object()
+{
+  return Task{Handle::from_promise(*this)};
+}
+
+template<class T>
+std::suspend_always
+Networking::Task<T>::promise_type::initial_suspend() noexcept
+{
+  return {};
+}
+
+template<class T>
+typename Networking::Task<T>::promise_type::FinalAwaiter
+Networking::Task<T>::promise_type::final_suspend() noexcept
+{
+  return {};
+}
+
+template<class T>
+void Networking::Task<T>::promise_type::unhandled_exception() noexcept
+{
+  this->m_exception = std::current_exception();
+}
+
+template<class T>
+std::coroutine_handle<> Networking::Task<T>::promise_type::FinalAwaiter
+::await_suspend(Handle handle) noexcept
+{
+  promise_type& promise = handle.promise();
+  if (!promise.m_detached)
+    {
+      return promise.m_awaiter;
+    }
+
+  // Nothing awaits a spawned task, so this is the last chance to report
+  // what went wrong in it.
+  if (promise.m_exception)
+    {
+      try
+        {
+          try
+            {
+              std::rethrow_exception(promise.m_exception);
+            }
+          catch (const std::exception& e)
+            {
+              promise.m_logStream(std::string{"Task threw: "} + e.what());
+            }
+          catch (...)
+            {
+              promise.m_logStream("Task threw an unknown exception");
+            }
+        }
+      catch (...)
+        {} // The log stream must not take the loop down with it.
+    }
+  handle.destroy();
+  return std::noop_coroutine();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// spawn
+////
+
+inline void Networking::spawn(Task<> task,
+                              std::function<void(const std::string&)>
+                              logStream)
+{
+  Task<>::Handle handle = std::exchange(task.m_handle, nullptr);
+  handle.promise().m_detached = true;
+  handle.promise().m_logStream = std::move(logStream);
+  handle.resume();
+}
+
+///////////////////////////////////////////////////////////////////////////////
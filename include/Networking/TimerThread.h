@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TimerThread.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     A TimerWheel advanced by a thread of its own, for the
+//                  deadlines of connections handled by blocking calls (e.g.
+//                  by the BlockingServer), which have no EventLoop to keep
+//                  their timers.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_TIMERTHREAD__
+#define __ET_TIMERTHREAD__
+
+#include <namespaces/Networking.h>
+
+#include <Networking/TimerWheel.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// May be used from any thread. The timers are called on the thread of the
+// TimerThread, and may schedule themselves again. A timer must be cancelled
+// with cancel() before it is destroyed (unless that is done by its own
+// callback): the Timer's destructor does not take the TimerThread's lock.
+class Networking::TimerThread
+{
+public:
+  TimerThread(std::chrono::milliseconds resolution
+              = std::chrono::milliseconds{10},
+              // By default, simply send error messages to cerr.
+              std::function<void(const std::string&)> logStream
+              =[](const std::string& message)
+                {
+                  std::cerr << message << '\n';
+                });
+  TimerThread(const TimerThread&) = delete;
+  TimerThread& operator=(const TimerThread&) = delete;
+  // Timers still scheduled are cancelled, without being called.
+  ~TimerThread();
+
+  void schedule(TimerWheel::Timer& timer,
+                TimerWheel::Clock::time_point deadline);
+  // Once this returns, the timer is not running, and will not be called.
+  void cancel(TimerWheel::Timer& timer);
+
+private:
+  void run();
+
+  // Recursive, so that a callback (called with it held) may schedule.
+  std::recursive_mutex m_mutex;
+  std::condition_variable_any m_wakeup;
+  TimerWheel m_wheel;
+  bool m_stopping;
+  std::thread m_thread;
+};
+
+#endif // __ET_TIMERTHREAD__
+
+///////////////////////////////////////////////////////////////////////////////
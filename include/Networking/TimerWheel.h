@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TimerWheel.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Hierarchical timing wheel, for the deadlines of any number
+//                  of connections. Scheduling and cancelling a timer take
+//                  constant time, whatever the number of timers, and cost
+//                  no allocation: the timers are linked into the wheel's
+//                  slots in place. Time is counted in ticks of a fixed
+//                  resolution, and timers never fire before their deadline,
+//                  but may fire up to one tick after it.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_TIMERWHEEL__
+#define __ET_TIMERWHEEL__
+
+#include <namespaces/Networking.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+
+// Not thread-safe: it belongs to the thread that advances it (see the
+// EventLoop, and the TimerThread for servers that block).
+class Networking::TimerWheel
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  class Timer;
+
+  TimerWheel(std::chrono::milliseconds resolution
+             = std::chrono::milliseconds{1},
+             // By default, simply send error messages to cerr.
+             std::function<void(const std::string&)> logStream
+             =[](const std::string& message)
+               {
+                 std::cerr << message << '\n';
+               });
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+  // Timers still scheduled are cancelled, without being called.
+  ~TimerWheel();
+
+  // Replaces the deadline of a timer that is already scheduled.
+  void schedule(Timer& timer, Clock::time_point deadline);
+  void cancel(Timer& timer);
+
+  // Calls each timer whose deadline has passed by now, once, having
+  // unscheduled it first, so that its callback may schedule it again. A
+  // callback that throws is logged. Returns the number of timers called.
+  std::size_t advance(Clock::time_point now);
+
+  // When advance() next has something to do, or Clock::time_point::max()
+  // if no timer is scheduled. This may be before the earliest deadline (a
+  // timer far off is moved closer to the hand once on its way), never after.
+  Clock::time_point getNextExpiry() const;
+
+  // Number of timers scheduled.
+  std::size_t size() const;
+
+private:
+  // Four levels of 64 slots each: a slot of the first level is a tick, one
+  // of each level above spans all 64 of the level below. Timers further
+  // off than the last level reaches are parked in its furthest slot.
+  static constexpr unsigned int LEVELS = 4;
+  static constexpr unsigned int SLOT_BITS = 6;
+  static constexpr unsigned int SLOTS = 1 << SLOT_BITS;
+
+  struct Link
+  {
+    Link* previous;
+    Link* next;
+  };
+
+  std::uint64_t getTick(Clock::time_point deadline) const;
+  std::uint64_t getNextTick() const;
+  void insert(Timer& timer);
+  void unlink(Timer& timer);
+  // Moves the list of a slot onto the (empty) list at the head.
+  void take(unsigned int slot, Link& head);
+
+  const std::chrono::nanoseconds m_resolution;
+  const Clock::time_point m_epoch;
+  std::function<void(const std::string&)> m_logStream;
+  // The first tick not yet processed by advance().
+  std::uint64_t m_now;
+  std::size_t m_size;
+  // Circular lists, each headed by its own link, and a bit for each slot
+  // whose list is not empty.
+  std::array<Link, LEVELS * SLOTS> m_slots;
+  std::array<std::uint64_t, LEVELS> m_occupied;
+};
+
+// A timer may be scheduled on one wheel at a time, and is cancelled when it
+// is destroyed. Its callback must not destroy it.
+class Networking::TimerWheel::Timer : private Networking::TimerWheel::Link
+{
+public:
+  explicit Timer(std::function<void()> callback);
+  Timer(const Timer&) = delete;
+  Timer& operator=(const Timer&) = delete;
+  ~Timer();
+
+  bool isScheduled() const;
+
+private:
+  friend class TimerWheel;
+
+  // Not in a slot, but in the list of timers about to be called.
+  static constexpr std::uint16_t DUE = 0xffff;
+
+  std::function<void()> m_callback;
+  TimerWheel* m_wheel;
+  std::uint64_t m_tick;
+  std::uint16_t m_slot;
+};
+
+#endif // __ET_TIMERWHEEL__
+
+///////////////////////////////////////////////////////////////////////////////
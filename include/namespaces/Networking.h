@@ -7,12 +7,26 @@
 //
 // CREATED:         03/27/2020
 //
-// LAST EDITED:     04/17/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #ifndef __ET_NETWORKING__
 #define __ET_NETWORKING__
 
+#include <functional>
+
+// Coroutine handlers and clients (see Networking/TCP/AsyncStream.h), when
+// the compiler supports C++20 coroutines. The library itself is built as
+// C++17, so the coroutine support is all in headers.
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define NETWORKING_COROUTINES
+#endif
+#endif
+
+// Need forward declaration for the default TLS handler type
+typedef struct ssl_st SSL;
+
 namespace Networking
 {
   namespace Interfaces
@@ -26,32 +40,86 @@ namespace Networking
   // options for servers
   class BlockingServer;
   class NonBlockingServer;
+  class MultiReactorServer;
+
+  // epoll reactor used by the non-blocking servers
+  class EventLoop;
+
+  // deadlines: kept by each EventLoop, or by a thread for blocking servers
+  class TimerWheel;
+  class TimerThread;
 
   // options for delegators
   class DelegatorSTSP;  // Single-thread, Single-process
   class DelegatorMP;    // Multi-process
   class DelegatorMT;    // Multi-thread
+  class DelegatorWS;    // Multi-thread, work-stealing
 
   // utility class encapsulating useful logic for dealing with inet addresses.
   class NetworkHost;
   class NetworkAddress;
   class UnixHost;
+  // what the listeners report as the address of a connecting client
+  class PeerAddress;
+
+  // asynchronous, caching DNS lookups for NetworkHost
+  class Resolver;
+
+  // resource management for accepted connections
+  class FileDescriptor;
+  class RequestPool;
+  class RingBuffer;
+
+#ifdef NETWORKING_COROUTINES
+  // lazily started coroutine, awaited by the coroutine that awaits it
+  template<class T = void>
+  class Task;
+#endif
 
   namespace TCP
   {
-    template<class HostType = NetworkHost>
+    // Handler is the type of the user handler. The std::function default
+    // keeps the listeners' layout independent of the handler; any other
+    // callable type lets the compiler inline the dispatch.
+    template<class HostType = NetworkHost,
+             class Handler = std::function<void(unsigned int,const HostType&)>>
     class TCPListener;
-    template<class HostType = NetworkHost>
+    template<class HostType = NetworkHost,
+             class Handler = std::function<void(unsigned int,const HostType&)>>
     class TCPRequest;
     template<class HostType = NetworkHost>
     class TCPClient;
-
     template<class HostType = NetworkHost>
+    class TCPConnectionPool;
+
+    // how long the listeners let a connection stall
+    struct ConnectionTimeouts;
+
+    // buffered reads and writes on a connection, for handlers
+    class Stream;
+    // messages, split out of a Stream
+    class FrameCodec;
+#ifdef NETWORKING_COROUTINES
+    // awaitable reads and writes on a connection, for coroutine handlers
+    class AsyncStream;
+#endif
+
+    template<class HostType = NetworkHost,
+             class Handler = std::function<void(SSL*,const HostType&)>>
     class TLSListener;
     template<class HostType = NetworkHost>
     class TLSClient;
     template<class HostType = NetworkHost>
     class TLSException;
+    // non-blocking handshake, for the TLSListener on an EventLoop
+    class TLSHandshake;
+
+    // session resumption for the TLSListener
+    class TLSSessionCache;
+    class TLSTicketKeys;
+
+    // connection reuse for the TLSClient
+    class TLSConnectionPool;
   };
 };
 
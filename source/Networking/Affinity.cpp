@@ -0,0 +1,52 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            Affinity.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the CPU affinity utilities.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/Affinity.h>
+
+#include <stdexcept>
+#include <system_error>
+
+#include <sched.h>
+
+void Networking::pinToCpu(unsigned int index)
+{
+#ifdef __linux__
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (0 != ::sched_getaffinity(0, sizeof(allowed), &allowed))
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+
+  int target = index % CPU_COUNT(&allowed);
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+      if (CPU_ISSET(cpu, &allowed) && 0 == target--)
+        {
+          // On Linux, pid 0 refers to the calling thread, not the process.
+          cpu_set_t pinned;
+          CPU_ZERO(&pinned);
+          CPU_SET(cpu, &pinned);
+          if (0 != ::sched_setaffinity(0, sizeof(pinned), &pinned))
+            {
+              throw std::system_error{errno, std::generic_category()};
+            }
+          return;
+        }
+    }
+#else
+  (void)index;
+  throw std::logic_error{"CPU pinning is not supported on this platform"};
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -7,7 +7,7 @@
 //
 // CREATED:         04/02/2020
 //
-// LAST EDITED:     04/02/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #include <Networking/BlockingServer.h>
@@ -16,18 +16,49 @@
 #include <Networking/Interfaces/IListener.h>
 #include <Networking/Interfaces/IRequest.h>
 
+#include <system_error>
+
 Networking::BlockingServer
 ::BlockingServer(std::unique_ptr<Interfaces::IDelegator> delegator,
                  std::unique_ptr<Interfaces::IListener> listener)
-  : m_delegator{std::move(delegator)}, m_listener{std::move(listener)}
+  : m_listener{std::move(listener)}, m_delegator{std::move(delegator)},
+    m_stopping{false}
 {}
 
 void Networking::BlockingServer::start()
 {
-  while(1)
+  if (!m_delegator->prepare(m_listener))
+    {
+      return;
+    }
+
+  while (!m_stopping.load())
     {
-      m_delegator->dispatch(m_listener->listen());
+      std::unique_ptr<Interfaces::IRequest> request;
+      try
+        {
+          request = m_listener->listen();
+        }
+      catch (const std::system_error&)
+        {
+          // accept() fails once the socket has been shut down.
+          if (m_stopping.load())
+            {
+              break;
+            }
+          throw;
+        }
+      if (request)
+        {
+          m_delegator->dispatch(std::move(request));
+        }
     }
 }
 
+void Networking::BlockingServer::stop()
+{
+  m_stopping.store(true);
+  m_listener->shutdown();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,269 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            DelegatorMP.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of a pre-forking, Multi-process Delegator
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/DelegatorMP.h>
+
+#include <Networking/Affinity.h>
+#include <Networking/Interfaces/IListener.h>
+#include <Networking/Interfaces/IRequest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <system_error>
+#include <thread>
+
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+
+// Workers that die sooner than this after being spawned are respawned only
+// after the same delay, so that a worker which crashes on startup does not
+// put the supervisor into a tight fork loop.
+static const std::chrono::seconds MINIMUM_WORKER_LIFETIME{1};
+
+// Without pidfds, how often the supervisor checks on its workers.
+static const std::chrono::milliseconds WORKER_POLL_INTERVAL{100};
+
+Networking::DelegatorMP
+::DelegatorMP(unsigned int numWorkers, bool pinWorkers,
+              ListenerFactory listenerFactory,
+              std::function<void(const std::string&)> logStream)
+  : m_numWorkers{numWorkers}, m_pinWorkers{pinWorkers},
+    m_listenerFactory{listenerFactory}, m_logStream{logStream}
+{
+  if (0 == m_numWorkers)
+    {
+      m_numWorkers = std::thread::hardware_concurrency();
+      m_numWorkers = 0 == m_numWorkers ? 1 : m_numWorkers;
+    }
+}
+
+bool
+Networking::DelegatorMP
+::prepare(std::unique_ptr<Interfaces::IListener>& listener)
+{
+  using Clock = std::chrono::steady_clock;
+
+  // With SO_REUSEPORT, the kernel would keep routing connections to the
+  // supervisor's socket, where nobody accepts them.
+  if (m_listenerFactory)
+    {
+      listener.reset();
+    }
+
+  m_workers.assign(m_numWorkers, 0);
+  m_exits.clear();
+  m_exits.resize(m_numWorkers);
+  std::vector<Clock::time_point> spawnTimes(m_numWorkers, Clock::now());
+  for (unsigned int i = 0; i < m_numWorkers; ++i)
+    {
+      const pid_t pid = spawn(i, listener);
+      if (0 == pid)
+        {
+          return true;
+        }
+      m_workers[i] = pid;
+    }
+
+  std::size_t running = m_workers.size();
+  while (0 < running)
+    {
+      int status = 0;
+      const unsigned int index = reap(status);
+      const pid_t pid = m_workers[index];
+      m_workers[index] = 0;
+      m_exits[index].reset();
+
+      if (WIFEXITED(status) && EXIT_SUCCESS == WEXITSTATUS(status))
+        {
+          --running;
+          continue;
+        }
+
+      m_logStream("DelegatorMP: worker " + std::to_string(index) + " (pid "
+                  + std::to_string(pid) + ") "
+                  + (WIFSIGNALED(status)
+                     ? "was killed by signal "
+                     + std::to_string(WTERMSIG(status))
+                     : "exited with status "
+                     + std::to_string(WEXITSTATUS(status)))
+                  + "; respawning.");
+
+      if (Clock::now() - spawnTimes[index] < MINIMUM_WORKER_LIFETIME)
+        {
+          std::this_thread::sleep_for(MINIMUM_WORKER_LIFETIME);
+        }
+
+      spawnTimes[index] = Clock::now();
+      // In the new worker, m_workers has been cleared.
+      const pid_t respawned = spawn(index, listener);
+      if (0 == respawned)
+        {
+          return true;
+        }
+      m_workers[index] = respawned;
+    }
+
+  return false;
+}
+
+void
+Networking::DelegatorMP
+::dispatch(std::unique_ptr<Interfaces::IRequest> request)
+{
+  if (!request)
+    {
+      return;
+    }
+
+  // Let one bad request cost a log message, rather than the whole worker.
+  try
+    {
+      request->handle();
+    }
+  catch (const std::exception& e)
+    {
+      m_logStream(std::string{"DelegatorMP: request handler threw: "}
+                  + e.what());
+    }
+  catch (...)
+    {
+      m_logStream("DelegatorMP: request handler threw an unknown exception");
+    }
+}
+
+pid_t
+Networking::DelegatorMP
+::spawn(unsigned int index, std::unique_ptr<Interfaces::IListener>& listener)
+{
+  errno = 0;
+  pid_t pid = ::fork();
+  if (-1 == pid)
+    {
+      throw std::system_error{errno, std::generic_category(),
+          "DelegatorMP: could not fork worker " + std::to_string(index)};
+    }
+  else if (0 != pid)
+    {
+      // Failing that (before Linux 5.3, or without the headers to ask for
+      // it), reap() polls.
+#ifdef SYS_pidfd_open
+      m_exits[index].reset(static_cast<int>
+                           (::syscall(SYS_pidfd_open, pid, 0)));
+#endif
+      return pid;
+    }
+
+  // In the worker from here on. An exception must not escape into the
+  // caller's stack, which belongs to the supervisor's copy of the program.
+  try
+    {
+#ifdef __linux__
+      // Don't outlive the supervisor.
+      ::prctl(PR_SET_PDEATHSIG, SIGTERM);
+#endif
+
+      m_workers.clear();
+      m_exits.clear();
+      if (m_pinWorkers)
+        {
+          try
+            {
+              pinToCpu(index);
+            }
+          catch (const std::exception& e)
+            {
+              // Not worth losing the worker over.
+              m_logStream("DelegatorMP: could not pin worker "
+                          + std::to_string(index) + ": " + e.what());
+            }
+        }
+
+      if (m_listenerFactory)
+        {
+          listener = m_listenerFactory();
+        }
+    }
+  catch (const std::exception& e)
+    {
+      m_logStream("DelegatorMP: worker " + std::to_string(index)
+                  + " failed to start: " + e.what());
+      ::_exit(EXIT_FAILURE);
+    }
+
+  return 0;
+}
+
+unsigned int Networking::DelegatorMP::reap(int& status)
+{
+  // Not waitpid(-1, ...), which would take the exit status of any child,
+  // e.g. one the application forked for itself.
+  for (;;)
+    {
+      for (unsigned int i = 0; i < m_workers.size(); ++i)
+        {
+          if (0 == m_workers[i])
+            {
+              continue;
+            }
+
+          errno = 0;
+          const pid_t pid = ::waitpid(m_workers[i], &status, WNOHANG);
+          if (m_workers[i] == pid)
+            {
+              return i;
+            }
+          else if (-1 == pid && EINTR != errno)
+            {
+              throw std::system_error{errno, std::generic_category()};
+            }
+        }
+
+      // A pidfd stays readable for as long as its worker is unreaped, so
+      // that an exit since the checks above is not missed.
+      std::vector<struct pollfd> exits;
+      bool polling = false;
+      for (unsigned int i = 0; i < m_workers.size(); ++i)
+        {
+          if (0 == m_workers[i])
+            {
+              continue;
+            }
+          else if (-1 == m_exits[i].get())
+            {
+              polling = true;
+            }
+          else
+            {
+              exits.push_back({m_exits[i].get(), POLLIN, 0});
+            }
+        }
+
+      errno = 0;
+      if (-1 == ::poll(exits.data(), exits.size(),
+                       polling ? WORKER_POLL_INTERVAL.count() : -1)
+          && EINTR != errno)
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            DelegatorMT.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of a Multi-thread Delegator
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/DelegatorMT.h>
+
+#include <Networking/Interfaces/IRequest.h>
+
+#include <exception>
+#include <stdexcept>
+
+Networking::DelegatorMT
+::DelegatorMT(unsigned int poolSize, unsigned int queueSize,
+              QueueFullPolicy policy,
+              std::function<void(const std::string&)> logStream)
+  : m_policy{policy}, m_logStream{logStream}, m_queue{}, m_head{0},
+    m_count{0}, m_stopping{false}
+{
+  if (0 == queueSize)
+    {
+      throw std::invalid_argument{"DelegatorMT: queueSize must be non-zero"};
+    }
+  m_queue.resize(queueSize);
+
+  if (0 == poolSize)
+    {
+      poolSize = std::thread::hardware_concurrency();
+      poolSize = 0 == poolSize ? 1 : poolSize;
+    }
+
+  m_workers.reserve(poolSize);
+  for (unsigned int i = 0; i < poolSize; ++i)
+    {
+      m_workers.emplace_back(&DelegatorMT::work, this);
+    }
+}
+
+Networking::DelegatorMT::~DelegatorMT()
+{
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_stopping = true;
+  }
+  m_notEmpty.notify_all();
+  m_notFull.notify_all();
+
+  for (auto& worker : m_workers)
+    {
+      worker.join();
+    }
+}
+
+void
+Networking::DelegatorMT
+::dispatch(std::unique_ptr<Interfaces::IRequest> request)
+{
+  if (!request)
+    {
+      return;
+    }
+
+  std::unique_lock<std::mutex> lock{m_mutex};
+  if (m_queue.size() == m_count)
+    {
+      switch (m_policy)
+        {
+        case QueueFullPolicy::BLOCK:
+          m_notFull.wait(lock, [this]() {
+              return m_stopping || m_queue.size() != m_count;
+            });
+          if (m_stopping)
+            {
+              return;
+            }
+          break;
+        case QueueFullPolicy::REJECT:
+          // The request owns the socket, so letting it go out of scope
+          // severs the connection.
+          lock.unlock();
+          m_logStream("DelegatorMT: queue is full, rejecting request.");
+          return;
+        case QueueFullPolicy::RUN_INLINE:
+          lock.unlock();
+          handle(std::move(request));
+          return;
+        }
+    }
+
+  m_queue[(m_head + m_count) % m_queue.size()] = std::move(request);
+  ++m_count;
+  lock.unlock();
+  m_notEmpty.notify_one();
+}
+
+void Networking::DelegatorMT::work()
+{
+  while (1)
+    {
+      std::unique_ptr<Interfaces::IRequest> request;
+      {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_notEmpty.wait(lock, [this]() { return m_stopping || 0 != m_count; });
+        if (0 == m_count)
+          {
+            // m_stopping is set and the queue has been drained.
+            return;
+          }
+
+        request = std::move(m_queue[m_head]);
+        m_head = (m_head + 1) % m_queue.size();
+        --m_count;
+      }
+      m_notFull.notify_one();
+
+      handle(std::move(request));
+    }
+}
+
+void
+Networking::DelegatorMT
+::handle(std::unique_ptr<Interfaces::IRequest> request) const
+{
+  // An exception escaping a worker would terminate the process, so report it
+  // and move on to the next request instead.
+  try
+    {
+      request->handle();
+    }
+  catch (const std::exception& e)
+    {
+      m_logStream(std::string{"DelegatorMT: request handler threw: "}
+                  + e.what());
+    }
+  catch (...)
+    {
+      m_logStream("DelegatorMT: request handler threw an unknown exception");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,293 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            DelegatorWS.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of a work-stealing, Multi-thread Delegator
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/DelegatorWS.h>
+
+#include <Networking/Interfaces/IRequest.h>
+
+#include <exception>
+#include <thread>
+
+///////////////////////////////////////////////////////////////////////////////
+// DelegatorWS::RequestQueue
+////
+
+// A bounded Chase-Lev deque with a single producer (the dispatching thread)
+// pushing at the bottom. Every consumer, including the worker that owns the
+// queue, takes from the top, so requests are handled in FIFO order and
+// taking a request costs one CAS. Since the owner never pops from the bottom,
+// the producer needs no CAS at all.
+class Networking::DelegatorWS::RequestQueue
+{
+public:
+  RequestQueue(std::size_t capacity)
+    : m_mask{capacity - 1}, m_buffer{new std::atomic<Interfaces::IRequest*>
+                                       [capacity]},
+      m_top{0}, m_bottom{0}
+  {}
+
+  bool push(Interfaces::IRequest* request)
+  {
+    const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+    const std::int64_t top = m_top.load(std::memory_order_acquire);
+    if (bottom - top > static_cast<std::int64_t>(m_mask))
+      {
+        return false;
+      }
+
+    m_buffer[bottom & m_mask].store(request, std::memory_order_relaxed);
+    m_bottom.store(bottom + 1, std::memory_order_release);
+    return true;
+  }
+
+  Interfaces::IRequest* take()
+  {
+    std::int64_t top = m_top.load(std::memory_order_acquire);
+    const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+    if (top >= bottom)
+      {
+        return nullptr;
+      }
+
+    Interfaces::IRequest* request
+      = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+    if (!m_top.compare_exchange_strong(top, top + 1,
+                                       std::memory_order_seq_cst,
+                                       std::memory_order_relaxed))
+      {
+        // Lost the race with another consumer.
+        return nullptr;
+      }
+    return request;
+  }
+
+  std::size_t size() const
+  {
+    const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+    const std::int64_t top = m_top.load(std::memory_order_acquire);
+    return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+  }
+
+private:
+  const std::size_t m_mask;
+  std::unique_ptr<std::atomic<Interfaces::IRequest*>[]> m_buffer;
+  alignas(64) std::atomic<std::int64_t> m_top;
+  alignas(64) std::atomic<std::int64_t> m_bottom;
+};
+
+struct alignas(64) Networking::DelegatorWS::Worker
+{
+  Worker(std::size_t capacity)
+    : queue{capacity}, handled{0}, steals{0}
+  {}
+
+  RequestQueue queue;
+  std::atomic<std::uint64_t> handled;
+  std::atomic<std::uint64_t> steals;
+  std::thread thread;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// DelegatorWS
+////
+
+Networking::DelegatorWS
+::DelegatorWS(unsigned int poolSize, unsigned int queueSize,
+              std::function<void(const std::string&)> logStream)
+  : m_logStream{logStream}, m_nextWorker{0}, m_sleepers{0},
+    m_stopping{false}
+{
+  if (0 == poolSize)
+    {
+      poolSize = std::thread::hardware_concurrency();
+      poolSize = 0 == poolSize ? 1 : poolSize;
+    }
+
+  std::size_t capacity = 1;
+  while (capacity < queueSize)
+    {
+      capacity <<= 1;
+    }
+
+  m_workers.reserve(poolSize);
+  for (unsigned int i = 0; i < poolSize; ++i)
+    {
+      m_workers.push_back(std::make_unique<Worker>(capacity));
+    }
+
+  // Start the threads only once every queue exists, since workers steal
+  // from each other.
+  for (std::size_t i = 0; i < m_workers.size(); ++i)
+    {
+      m_workers[i]->thread = std::thread{&DelegatorWS::work, this, i};
+    }
+}
+
+Networking::DelegatorWS::~DelegatorWS()
+{
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_stopping = true;
+  }
+  m_wakeup.notify_all();
+
+  for (auto& worker : m_workers)
+    {
+      worker->thread.join();
+    }
+}
+
+void
+Networking::DelegatorWS
+::dispatch(std::unique_ptr<Interfaces::IRequest> request)
+{
+  if (!request)
+    {
+      return;
+    }
+
+  {
+    std::lock_guard<std::mutex> lock{m_dispatchMutex};
+    const std::size_t count = m_workers.size();
+    for (std::size_t i = 0; i < count; ++i)
+      {
+        const std::size_t index = (m_nextWorker + i) % count;
+        if (m_workers[index]->queue.push(request.get()))
+          {
+            request.release();
+            m_nextWorker = index + 1;
+            break;
+          }
+      }
+  }
+
+  if (request)
+    {
+      // Every queue is full; apply backpressure by handling the request on
+      // the dispatching thread.
+      handle(std::move(request));
+      return;
+    }
+
+  // Pairs with the fence in work(): either this load sees the sleeper, or
+  // the sleeper sees the request we just pushed.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (0 != m_sleepers.load())
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      m_wakeup.notify_one();
+    }
+}
+
+std::vector<Networking::DelegatorWS::WorkerStatistics>
+Networking::DelegatorWS::getStatistics() const
+{
+  std::vector<WorkerStatistics> statistics;
+  statistics.reserve(m_workers.size());
+  for (auto const& worker : m_workers)
+    {
+      statistics.push_back(WorkerStatistics{
+          worker->queue.size(),
+          worker->handled.load(std::memory_order_relaxed),
+          worker->steals.load(std::memory_order_relaxed)});
+    }
+  return statistics;
+}
+
+void Networking::DelegatorWS::work(std::size_t index)
+{
+  Worker& self = *m_workers[index];
+  while (1)
+    {
+      Interfaces::IRequest* request = self.queue.take();
+      if (nullptr == request)
+        {
+          request = steal(index);
+        }
+
+      if (nullptr != request)
+        {
+          self.handled.fetch_add(1, std::memory_order_relaxed);
+          handle(std::unique_ptr<Interfaces::IRequest>{request});
+          continue;
+        }
+
+      // Nothing to do anywhere. Register as a sleeper before re-checking the
+      // queues, so that a concurrent dispatch() either sees us or we see its
+      // request.
+      std::unique_lock<std::mutex> lock{m_mutex};
+      m_sleepers.fetch_add(1);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (!hasWork())
+        {
+          if (m_stopping)
+            {
+              m_sleepers.fetch_sub(1);
+              return;
+            }
+          m_wakeup.wait(lock);
+        }
+      m_sleepers.fetch_sub(1);
+    }
+}
+
+Networking::Interfaces::IRequest*
+Networking::DelegatorWS::steal(std::size_t thief)
+{
+  const std::size_t count = m_workers.size();
+  for (std::size_t i = 1; i < count; ++i)
+    {
+      Interfaces::IRequest* request
+        = m_workers[(thief + i) % count]->queue.take();
+      if (nullptr != request)
+        {
+          m_workers[thief]->steals.fetch_add(1, std::memory_order_relaxed);
+          return request;
+        }
+    }
+  return nullptr;
+}
+
+bool Networking::DelegatorWS::hasWork() const
+{
+  for (auto const& worker : m_workers)
+    {
+      if (0 != worker->queue.size())
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+void
+Networking::DelegatorWS
+::handle(std::unique_ptr<Interfaces::IRequest> request) const
+{
+  // An exception escaping a worker would terminate the process, so report it
+  // and move on to the next request instead.
+  try
+    {
+      request->handle();
+    }
+  catch (const std::exception& e)
+    {
+      m_logStream(std::string{"DelegatorWS: request handler threw: "}
+                  + e.what());
+    }
+  catch (...)
+    {
+      m_logStream("DelegatorWS: request handler threw an unknown exception");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,573 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            EpollBackend.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     EventLoop backend on edge-triggered epoll. Descriptors
+//                  registered with receive() or accept() are read or accepted
+//                  from until the call would block. Data queued with send()
+//                  is written at the end of the round, and EPOLLOUT is only
+//                  armed for descriptors whose data did not fit in the socket
+//                  buffer.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/EventLoopBackend.h>
+
+#include <limits>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace
+{
+  using Networking::EventLoop;
+
+  // epoll_event.data for the wakeup descriptor. Tokens can never produce
+  // this value, since they hold a descriptor in the lower half.
+  const std::uint64_t WAKEUP_DATA = std::numeric_limits<std::uint64_t>::max();
+
+  // Set in epoll_event.data for descriptors that are lingering: removed from
+  // the loop, but kept open until the data queued for them has been written.
+  const std::uint64_t LINGER_FLAG = std::uint64_t{1} << 63;
+
+  const std::size_t RECEIVE_BUFFER_SIZE = 64 * 1024;
+
+  std::uint32_t toEpollEvents(unsigned int events)
+  {
+    std::uint32_t epollEvents = EPOLLET | EPOLLRDHUP;
+    if (events & EventLoop::READABLE)
+      {
+        epollEvents |= EPOLLIN;
+      }
+    if (events & EventLoop::WRITABLE)
+      {
+        epollEvents |= EPOLLOUT;
+      }
+    return epollEvents;
+  }
+
+  unsigned int fromEpollEvents(std::uint32_t epollEvents)
+  {
+    unsigned int events = 0;
+    if (epollEvents & EPOLLIN)
+      {
+        events |= EventLoop::READABLE;
+      }
+    if (epollEvents & EPOLLOUT)
+      {
+        events |= EventLoop::WRITABLE;
+      }
+    if (epollEvents & (EPOLLRDHUP | EPOLLHUP))
+      {
+        events |= EventLoop::HANGUP;
+      }
+    if (epollEvents & EPOLLERR)
+      {
+        events |= EventLoop::ERROR;
+      }
+    return events;
+  }
+
+  class EpollBackend : public EventLoop::Backend
+  {
+  public:
+    EpollBackend(unsigned int maxEventsPerWait,
+                 std::function<void(const std::string&)> logStream);
+    virtual ~EpollBackend();
+
+    virtual EventLoop::Engine getEngine() const override
+    { return EventLoop::EPOLL; }
+
+    virtual void add(int fd, std::uint64_t token, unsigned int events)
+      override;
+    virtual void modify(int fd, std::uint64_t token, unsigned int events)
+      override;
+    virtual void receive(int fd, std::uint64_t token) override;
+    virtual void accept(int fd, std::uint64_t token) override;
+    virtual void send(int fd, std::uint64_t token, const char* data,
+                      std::size_t length) override;
+    virtual void remove(int fd, std::uint64_t token) override;
+    virtual unsigned int wait(EventLoop& loop, int timeoutMilliseconds)
+      override;
+    virtual void wakeup() override;
+
+  private:
+    enum class Mode { READINESS, RECEIVE, ACCEPT, LINGER };
+
+    struct Watch
+    {
+      std::uint64_t data = 0;   // epoll_event.data; 0 if not in use
+      Mode mode = Mode::READINESS;
+      unsigned int events = 0;
+      bool writable = false;    // EPOLLOUT is armed
+      bool dirty = false;       // In m_dirty
+      std::string outbox;
+      std::size_t offset = 0;
+    };
+
+    Watch* find(int fd, std::uint64_t data);
+    void watch(int fd, std::uint64_t data, Mode mode, unsigned int events);
+    void arm(int fd, Watch& watch, bool writable);
+    std::uint32_t epollEvents(const Watch& watch) const;
+    bool flush(int fd, Watch& watch);
+    void flushDirty();
+    void readAll(EventLoop& loop, int fd, std::uint64_t token);
+    void acceptAll(EventLoop& loop, int fd, std::uint64_t token);
+    void linger(int fd, Watch& watch);
+
+    int m_epoll;
+    int m_wakeup;
+    const unsigned int m_maxEventsPerWait;
+    std::unique_ptr<struct epoll_event[]> m_events;
+    std::vector<Watch> m_watches; // by fd
+    std::vector<int> m_dirty;
+    std::unique_ptr<char[]> m_receiveBuffer;
+    std::function<void(const std::string&)> m_logStream;
+  };
+}
+
+EpollBackend
+::EpollBackend(unsigned int maxEventsPerWait,
+               std::function<void(const std::string&)> logStream)
+  : m_epoll{::epoll_create1(EPOLL_CLOEXEC)},
+    m_wakeup{::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)},
+    m_maxEventsPerWait{maxEventsPerWait},
+    m_events{new struct epoll_event[m_maxEventsPerWait]},
+    m_logStream{logStream}
+{
+  if (-1 == m_epoll || -1 == m_wakeup)
+    {
+      const int error = errno;
+      if (-1 != m_epoll) ::close(m_epoll);
+      if (-1 != m_wakeup) ::close(m_wakeup);
+      throw std::system_error{error, std::generic_category()};
+    }
+
+  struct epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.u64 = WAKEUP_DATA;
+  if (-1 == ::epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_wakeup, &event))
+    {
+      const int error = errno;
+      ::close(m_epoll);
+      ::close(m_wakeup);
+      throw std::system_error{error, std::generic_category()};
+    }
+}
+
+EpollBackend::~EpollBackend()
+{
+  for (std::size_t fd = 0; fd < m_watches.size(); ++fd)
+    {
+      if (Mode::LINGER == m_watches[fd].mode && 0 != m_watches[fd].data)
+        {
+          ::close(fd);
+        }
+    }
+  ::close(m_wakeup);
+  ::close(m_epoll);
+}
+
+void EpollBackend::add(int fd, std::uint64_t token, unsigned int events)
+{
+  watch(fd, token, Mode::READINESS, events);
+}
+
+void EpollBackend::modify(int fd, std::uint64_t token, unsigned int events)
+{
+  Watch* watch = find(fd, token);
+  if (nullptr == watch)
+    {
+      return;
+    }
+
+  watch->events = events;
+  struct epoll_event event = {};
+  event.events = epollEvents(*watch);
+  event.data.u64 = token;
+  if (-1 == ::epoll_ctl(m_epoll, EPOLL_CTL_MOD, fd, &event))
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+}
+
+void EpollBackend::receive(int fd, std::uint64_t token)
+{
+  if (!m_receiveBuffer)
+    {
+      m_receiveBuffer.reset(new char[RECEIVE_BUFFER_SIZE]);
+    }
+  watch(fd, token, Mode::RECEIVE, EventLoop::READABLE);
+}
+
+void EpollBackend::accept(int fd, std::uint64_t token)
+{
+  watch(fd, token, Mode::ACCEPT, EventLoop::READABLE);
+}
+
+void
+EpollBackend::send(int fd, std::uint64_t token, const char* data,
+                   std::size_t length)
+{
+  Watch* watch = find(fd, token);
+  if (nullptr == watch)
+    {
+      return;
+    }
+
+  watch->outbox.append(data, length);
+  if (!watch->dirty && !watch->writable)
+    {
+      watch->dirty = true;
+      m_dirty.push_back(fd);
+    }
+}
+
+void EpollBackend::remove(int fd, std::uint64_t token)
+{
+  Watch* watch = find(fd, token);
+  if (nullptr == watch)
+    {
+      return;
+    }
+
+  if (watch->offset < watch->outbox.size() && !flush(fd, *watch))
+    {
+      linger(fd, *watch);
+    }
+
+  // The descriptor is still open (the registration may own it), so this
+  // cannot fail for any reason we could do something about.
+  ::epoll_ctl(m_epoll, EPOLL_CTL_DEL, fd, nullptr);
+  m_watches[fd] = Watch{};
+}
+
+unsigned int EpollBackend::wait(EventLoop& loop, int timeoutMilliseconds)
+{
+  flushDirty();
+
+  errno = 0;
+  const int count = ::epoll_wait(m_epoll, m_events.get(), m_maxEventsPerWait,
+                                 timeoutMilliseconds);
+  if (-1 == count)
+    {
+      if (EINTR == errno)
+        {
+          return 0;
+        }
+      throw std::system_error{errno, std::generic_category()};
+    }
+
+  unsigned int delivered = 0;
+  for (int i = 0; i < count; ++i)
+    {
+      const std::uint64_t data = m_events[i].data.u64;
+      const std::uint32_t events = m_events[i].events;
+      if (WAKEUP_DATA == data)
+        {
+          std::uint64_t counter = 0;
+          (void)!::read(m_wakeup, &counter, sizeof(counter));
+          continue;
+        }
+
+      const int fd = static_cast<int>(data & 0xffffffff);
+      Watch* watch = find(fd, data);
+      if (nullptr == watch)
+        {
+          // Removed (and possibly replaced) earlier in this round.
+          continue;
+        }
+
+      if ((events & (EPOLLOUT | EPOLLERR | EPOLLHUP))
+          && watch->offset < watch->outbox.size())
+        {
+          flush(fd, *watch);
+        }
+      if (Mode::LINGER == watch->mode)
+        {
+          if (watch->outbox.empty() || (events & (EPOLLERR | EPOLLHUP)))
+            {
+              ::epoll_ctl(m_epoll, EPOLL_CTL_DEL, fd, nullptr);
+              ::close(fd);
+              m_watches[fd] = Watch{};
+            }
+          continue;
+        }
+
+      ++delivered;
+      switch (watch->mode)
+        {
+        case Mode::READINESS:
+          {
+            // Hide the EPOLLOUT armed for the outbox from a callback that
+            // did not ask for it.
+            unsigned int mask = watch->events | EventLoop::HANGUP
+              | EventLoop::ERROR;
+            unsigned int ready = fromEpollEvents(events) & mask;
+            if (0 != ready)
+              {
+                Backend::ready(loop, data, ready);
+              }
+          }
+          break;
+        case Mode::RECEIVE:
+          if (events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+            {
+              readAll(loop, fd, data);
+            }
+          break;
+        case Mode::ACCEPT:
+          acceptAll(loop, fd, data);
+          break;
+        case Mode::LINGER:
+          break;
+        }
+    }
+
+  flushDirty();
+  return delivered;
+}
+
+void EpollBackend::wakeup()
+{
+  const std::uint64_t one = 1;
+  // Can only fail if the counter would overflow, in which case the loop is
+  // going to wake up anyway.
+  (void)!::write(m_wakeup, &one, sizeof(one));
+}
+
+EpollBackend::Watch* EpollBackend::find(int fd, std::uint64_t data)
+{
+  if (0 > fd || m_watches.size() <= static_cast<std::size_t>(fd)
+      || m_watches[fd].data != data)
+    {
+      return nullptr;
+    }
+  return &m_watches[fd];
+}
+
+void
+EpollBackend::watch(int fd, std::uint64_t data, Mode mode, unsigned int events)
+{
+  if (m_watches.size() <= static_cast<std::size_t>(fd))
+    {
+      m_watches.resize(fd + 1);
+    }
+
+  Watch watch;
+  watch.data = data;
+  watch.mode = mode;
+  watch.events = events;
+
+  struct epoll_event event = {};
+  event.events = epollEvents(watch);
+  event.data.u64 = data;
+  if (-1 == ::epoll_ctl(m_epoll, EPOLL_CTL_ADD, fd, &event))
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+  m_watches[fd] = std::move(watch);
+}
+
+void EpollBackend::arm(int fd, Watch& watch, bool writable)
+{
+  if (watch.writable == writable)
+    {
+      return;
+    }
+
+  watch.writable = writable;
+  struct epoll_event event = {};
+  event.events = epollEvents(watch);
+  event.data.u64 = watch.data;
+  if (-1 == ::epoll_ctl(m_epoll, EPOLL_CTL_MOD, fd, &event))
+    {
+      m_logStream("EventLoop: could not wait for fd " + std::to_string(fd)
+                  + " to become writable: "
+                  + std::system_error{errno, std::generic_category()}.what());
+    }
+}
+
+std::uint32_t EpollBackend::epollEvents(const Watch& watch) const
+{
+  std::uint32_t events = toEpollEvents(watch.events);
+  if (Mode::LINGER == watch.mode)
+    {
+      events = EPOLLET | EPOLLOUT;
+    }
+  if (watch.writable)
+    {
+      events |= EPOLLOUT;
+    }
+  return events;
+}
+
+// Returns true if the outbox has been emptied, either because it was
+// written or because the connection has failed. Otherwise, EPOLLOUT is armed.
+bool EpollBackend::flush(int fd, Watch& watch)
+{
+  while (watch.offset < watch.outbox.size())
+    {
+      const ssize_t written
+        = ::send(fd, watch.outbox.data() + watch.offset,
+                 watch.outbox.size() - watch.offset,
+                 MSG_NOSIGNAL | MSG_DONTWAIT);
+      if (0 <= written)
+        {
+          watch.offset += written;
+        }
+      else if (EINTR == errno)
+        {
+          continue;
+        }
+      else if (EAGAIN == errno || EWOULDBLOCK == errno)
+        {
+          arm(fd, watch, true);
+          return false;
+        }
+      else
+        {
+          // The error is reported to the registration by the next read.
+          break;
+        }
+    }
+
+  watch.outbox.clear();
+  watch.offset = 0;
+  if (Mode::LINGER != watch.mode)
+    {
+      arm(fd, watch, false);
+    }
+  return true;
+}
+
+void EpollBackend::flushDirty()
+{
+  // Not a range-based loop: flush() does not add to m_dirty, but be safe.
+  for (std::size_t i = 0; i < m_dirty.size(); ++i)
+    {
+      const int fd = m_dirty[i];
+      Watch& watch = m_watches[fd];
+      watch.dirty = false;
+      if (0 != watch.data && !watch.writable)
+        {
+          flush(fd, watch);
+        }
+    }
+  m_dirty.clear();
+}
+
+void EpollBackend::readAll(EventLoop& loop, int fd, std::uint64_t token)
+{
+  // Notification is edge-triggered, so drain the socket. The callback may
+  // remove the descriptor (or resize m_watches), so look it up every time.
+  while (nullptr != find(fd, token))
+    {
+      const ssize_t length = ::recv(fd, m_receiveBuffer.get(),
+                                    RECEIVE_BUFFER_SIZE, 0);
+      if (0 < length)
+        {
+          Backend::received(loop, token, m_receiveBuffer.get(), length);
+        }
+      else if (0 == length)
+        {
+          Backend::received(loop, token, nullptr, 0);
+          return;
+        }
+      else if (EINTR == errno)
+        {
+          continue;
+        }
+      else if (EAGAIN == errno || EWOULDBLOCK == errno)
+        {
+          return;
+        }
+      else
+        {
+          Backend::received(loop, token, nullptr, -errno);
+          return;
+        }
+    }
+}
+
+void EpollBackend::acceptAll(EventLoop& loop, int fd, std::uint64_t token)
+{
+  while (nullptr != find(fd, token))
+    {
+      const int socket = ::accept4(fd, nullptr, nullptr,
+                                   SOCK_NONBLOCK | SOCK_CLOEXEC);
+      if (0 <= socket)
+        {
+          Backend::accepted(loop, token, socket);
+        }
+      else if (EINTR == errno || ECONNABORTED == errno)
+        {
+          continue;
+        }
+      else if (EAGAIN == errno || EWOULDBLOCK == errno)
+        {
+          return;
+        }
+      else
+        {
+          // e.g. EMFILE. Leave the rest of the backlog for the next edge.
+          Backend::accepted(loop, token, -errno);
+          return;
+        }
+    }
+}
+
+// Keeps a duplicate of fd registered until the rest of the outbox has been
+// written, since the owner of fd closes it as soon as the round is over.
+void EpollBackend::linger(int fd, Watch& watch)
+{
+  std::string remainder = watch.outbox.substr(watch.offset);
+  const int duplicate = ::fcntl(fd, F_DUPFD_CLOEXEC, 0);
+  if (-1 == duplicate)
+    {
+      m_logStream("EventLoop: dropping data queued for fd "
+                  + std::to_string(fd) + ": "
+                  + std::system_error{errno, std::generic_category()}.what());
+      return;
+    }
+
+  // Invalidates watch.
+  if (m_watches.size() <= static_cast<std::size_t>(duplicate))
+    {
+      m_watches.resize(duplicate + 1);
+    }
+  Watch& lingering = m_watches[duplicate];
+  lingering.data = LINGER_FLAG | static_cast<std::uint32_t>(duplicate);
+  lingering.mode = Mode::LINGER;
+  lingering.writable = true;
+  lingering.outbox = std::move(remainder);
+
+  struct epoll_event event = {};
+  event.events = epollEvents(lingering);
+  event.data.u64 = lingering.data;
+  if (-1 == ::epoll_ctl(m_epoll, EPOLL_CTL_ADD, duplicate, &event))
+    {
+      ::close(duplicate);
+      m_watches[duplicate] = Watch{};
+    }
+}
+
+std::unique_ptr<Networking::EventLoop::Backend>
+Networking::EventLoop::Backend
+::createEpoll(unsigned int maxEventsPerWait,
+              std::function<void(const std::string&)> logStream)
+{
+  return std::make_unique<EpollBackend>(maxEventsPerWait, logStream);
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,492 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            EventLoop.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the reactor. The kernel interface lives
+//                  in the backends; this file keeps the registrations and
+//                  dispatches notifications to them.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/EventLoop.h>
+
+#include <Networking/EventLoopBackend.h>
+#include <Networking/Interfaces/IRequest.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <exception>
+#include <stdexcept>
+#include <system_error>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Tokens hold the descriptor in the lower half and the generation of the
+// registration above it. Only 24 bits of generation are kept, so that the
+// backends may use the top byte for their own purposes.
+static const std::uint32_t GENERATION_MASK = 0xffffff;
+
+static thread_local Networking::EventLoop* currentLoop = nullptr;
+
+// The deadline of a registration given an idle timeout. Rather than being
+// rescheduled on every event, the timer checks when it fires whether there
+// has been an event since, and if so, sets itself again from that one.
+struct Networking::EventLoop::Idle
+{
+  using Clock = TimerWheel::Clock;
+
+  Idle(std::function<void()> callback);
+  Clock::time_point getDeadline() const;
+  void touch(bool read);
+
+  TimerWheel::Timer timer;
+  std::chrono::milliseconds idleTimeout;
+  std::chrono::milliseconds firstReadTimeout;
+  Clock::time_point added;
+  Clock::time_point lastEvent;
+  bool readable;
+};
+
+struct Networking::EventLoop::Registration
+{
+  Callback callback;
+  ReceiveCallback receiveCallback;
+  AcceptCallback acceptCallback;
+  std::unique_ptr<Interfaces::IRequest> owner;
+  std::unique_ptr<Idle> idle;
+  std::uint64_t token;
+};
+
+Networking::EventLoop::Idle::Idle(std::function<void()> callback)
+  : timer{std::move(callback)}, idleTimeout{0}, firstReadTimeout{0},
+    readable{false}
+{}
+
+Networking::EventLoop::Idle::Clock::time_point
+Networking::EventLoop::Idle::getDeadline() const
+{
+  if (!readable && 0 < firstReadTimeout.count())
+    {
+      return added + firstReadTimeout;
+    }
+  return 0 < idleTimeout.count() ? lastEvent + idleTimeout
+    : Clock::time_point::max();
+}
+
+void Networking::EventLoop::Idle::touch(bool read)
+{
+  lastEvent = Clock::now();
+  readable = readable || read;
+}
+
+Networking::EventLoop
+::EventLoop(Engine engine, unsigned int maxEventsPerWait,
+            std::function<void(const std::string&)> logStream)
+  : m_logStream{logStream}, m_timers{std::chrono::milliseconds{1}, logStream},
+    m_size{0}, m_generation{0}, m_stopping{false}
+{
+  maxEventsPerWait = 0 == maxEventsPerWait ? 1 : maxEventsPerWait;
+  if (Engine::IO_URING == engine)
+    {
+      m_backend = Backend::createUring(maxEventsPerWait, logStream);
+      if (!m_backend)
+        {
+          m_logStream("EventLoop: io_uring is not available, falling back to"
+                      " epoll");
+        }
+    }
+
+  if (!m_backend)
+    {
+      m_backend = Backend::createEpoll(maxEventsPerWait, logStream);
+    }
+}
+
+Networking::EventLoop::~EventLoop()
+{
+  // Release the connections before the backend they are registered with.
+  m_registrations.clear();
+  m_removed.clear();
+}
+
+Networking::EventLoop::Engine Networking::EventLoop::getEngine() const
+{
+  return m_backend->getEngine();
+}
+
+void Networking::EventLoop::add(int fd, unsigned int events, Callback callback)
+{
+  Registration& registration = insert(fd);
+  registration.callback = std::move(callback);
+  try
+    {
+      m_backend->add(fd, registration.token, events);
+    }
+  catch (...)
+    {
+      m_registrations[fd].reset();
+      --m_size;
+      throw;
+    }
+}
+
+void Networking::EventLoop::modify(int fd, unsigned int events)
+{
+  Registration* registration = find(fd);
+  if (nullptr == registration || !registration->callback)
+    {
+      throw std::logic_error{"EventLoop: fd " + std::to_string(fd)
+          + " is not registered with add()"};
+    }
+  m_backend->modify(fd, registration->token, events);
+}
+
+void Networking::EventLoop::receive(int fd, ReceiveCallback callback)
+{
+  Registration& registration = insert(fd);
+  registration.receiveCallback = std::move(callback);
+  try
+    {
+      m_backend->receive(fd, registration.token);
+    }
+  catch (...)
+    {
+      m_registrations[fd].reset();
+      --m_size;
+      throw;
+    }
+}
+
+void Networking::EventLoop::accept(int fd, AcceptCallback callback)
+{
+  Registration& registration = insert(fd);
+  registration.acceptCallback = std::move(callback);
+  try
+    {
+      m_backend->accept(fd, registration.token);
+    }
+  catch (...)
+    {
+      m_registrations[fd].reset();
+      --m_size;
+      throw;
+    }
+}
+
+void Networking::EventLoop::send(int fd, const void* data, std::size_t length)
+{
+  Registration* registration = find(fd);
+  if (nullptr == registration)
+    {
+      throw std::logic_error{"EventLoop: fd " + std::to_string(fd)
+          + " is not registered"};
+    }
+  if (0 < length)
+    {
+      m_backend->send(fd, registration->token,
+                      static_cast<const char*>(data), length);
+    }
+}
+
+void Networking::EventLoop::remove(int fd)
+{
+  Registration* registration = find(fd);
+  if (nullptr == registration)
+    {
+      return;
+    }
+
+  m_backend->remove(fd, registration->token);
+  // The descriptor may be closed, and reused, before the round is over.
+  registration->idle.reset();
+  m_removed.push_back(std::move(m_registrations[fd]));
+  --m_size;
+}
+
+bool Networking::EventLoop::contains(int fd) const
+{
+  return nullptr != find(fd);
+}
+
+void
+Networking::EventLoop
+::adopt(int fd, std::unique_ptr<Interfaces::IRequest> request)
+{
+  Registration* registration = find(fd);
+  if (nullptr == registration)
+    {
+      throw std::logic_error{"EventLoop: fd " + std::to_string(fd)
+          + " is not registered"};
+    }
+  registration->owner = std::move(request);
+}
+
+void
+Networking::EventLoop::setIdleTimeout(int fd,
+                                      std::chrono::milliseconds idleTimeout,
+                                      std::chrono::milliseconds
+                                      firstReadTimeout)
+{
+  Registration* registration = find(fd);
+  if (nullptr == registration)
+    {
+      throw std::logic_error{"EventLoop: fd " + std::to_string(fd)
+          + " is not registered"};
+    }
+  if (0 >= idleTimeout.count() && 0 >= firstReadTimeout.count())
+    {
+      registration->idle.reset();
+      return;
+    }
+
+  if (!registration->idle)
+    {
+      registration->idle = std::make_unique<Idle>([this, registration]()
+        {
+          expire(*registration);
+        });
+      registration->idle->added = Idle::Clock::now();
+      registration->idle->lastEvent = registration->idle->added;
+    }
+  Idle& idle = *registration->idle;
+  idle.idleTimeout = std::max(idleTimeout, std::chrono::milliseconds{0});
+  idle.firstReadTimeout = std::max(firstReadTimeout,
+                                   std::chrono::milliseconds{0});
+  m_timers.schedule(idle.timer, idle.getDeadline());
+}
+
+void Networking::EventLoop::noteActivity(int fd, unsigned int events)
+{
+  Registration* registration = find(fd);
+  if (nullptr != registration && registration->idle)
+    {
+      registration->idle->touch(0 != (events & READABLE));
+    }
+}
+
+Networking::TimerWheel& Networking::EventLoop::getTimers()
+{
+  return m_timers;
+}
+
+std::size_t Networking::EventLoop::size() const
+{
+  return m_size;
+}
+
+void Networking::EventLoop::run()
+{
+  while (!m_stopping.load())
+    {
+      runOnce(-1);
+    }
+  m_stopping.store(false);
+}
+
+unsigned int Networking::EventLoop::runOnce(int timeoutMilliseconds)
+{
+  EventLoop* previous = currentLoop;
+  currentLoop = this;
+
+  // Wake up in time for the next timer.
+  const TimerWheel::Clock::time_point next = m_timers.getNextExpiry();
+  if (TimerWheel::Clock::time_point::max() != next)
+    {
+      const auto untilNext = std::chrono::ceil<std::chrono::milliseconds>
+        (next - TimerWheel::Clock::now()).count();
+      const int timerTimeout = static_cast<int>
+        (std::clamp<decltype(untilNext)>(untilNext, 0, INT_MAX));
+      if (0 > timeoutMilliseconds || timerTimeout < timeoutMilliseconds)
+        {
+          timeoutMilliseconds = timerTimeout;
+        }
+    }
+
+  unsigned int count = 0;
+  try
+    {
+      count = m_backend->wait(*this, timeoutMilliseconds);
+      m_timers.advance(TimerWheel::Clock::now());
+    }
+  catch (...)
+    {
+      currentLoop = previous;
+      throw;
+    }
+
+  // Safe now that no callback is running.
+  m_removed.clear();
+  currentLoop = previous;
+  return count;
+}
+
+void Networking::EventLoop::stop()
+{
+  m_stopping.store(true);
+  m_backend->wakeup();
+}
+
+Networking::EventLoop* Networking::EventLoop::current()
+{
+  return currentLoop;
+}
+
+Networking::EventLoop::Registration* Networking::EventLoop::find(int fd) const
+{
+  if (0 > fd || m_registrations.size() <= static_cast<std::size_t>(fd))
+    {
+      return nullptr;
+    }
+  return m_registrations[fd].get();
+}
+
+Networking::EventLoop::Registration*
+Networking::EventLoop::find(std::uint64_t token) const
+{
+  Registration* registration = find(static_cast<int>(token & 0xffffffff));
+  if (nullptr == registration || registration->token != token)
+    {
+      // Removed (and possibly replaced) since the backend was notified.
+      return nullptr;
+    }
+  return registration;
+}
+
+Networking::EventLoop::Registration& Networking::EventLoop::insert(int fd)
+{
+  if (0 > fd)
+    {
+      throw std::invalid_argument{"EventLoop: cannot add a negative fd"};
+    }
+  if (nullptr != find(fd))
+    {
+      throw std::logic_error{"EventLoop: fd " + std::to_string(fd)
+          + " is already registered"};
+    }
+
+  m_generation = (m_generation + 1) & GENERATION_MASK;
+  m_generation = 0 == m_generation ? 1 : m_generation;
+
+  auto registration = std::make_unique<Registration>();
+  registration->token = (static_cast<std::uint64_t>(m_generation) << 32)
+    | static_cast<std::uint32_t>(fd);
+
+  if (m_registrations.size() <= static_cast<std::size_t>(fd))
+    {
+      m_registrations.resize(fd + 1);
+    }
+  m_registrations[fd] = std::move(registration);
+  ++m_size;
+  return *m_registrations[fd];
+}
+
+void Networking::EventLoop::ready(std::uint64_t token, unsigned int events)
+{
+  Registration* registration = find(token);
+  if (nullptr == registration || !registration->callback)
+    {
+      return;
+    }
+  else if (registration->idle)
+    {
+      registration->idle->touch(0 != (events & READABLE));
+    }
+
+  try
+    {
+      registration->callback(events);
+    }
+  catch (const std::exception& e)
+    {
+      failed(token, e);
+    }
+}
+
+void
+Networking::EventLoop
+::received(std::uint64_t token, const char* data, ssize_t length)
+{
+  Registration* registration = find(token);
+  if (nullptr == registration || !registration->receiveCallback)
+    {
+      return;
+    }
+  else if (registration->idle)
+    {
+      registration->idle->touch(true);
+    }
+
+  try
+    {
+      registration->receiveCallback(data, length);
+    }
+  catch (const std::exception& e)
+    {
+      failed(token, e);
+    }
+}
+
+void Networking::EventLoop::accepted(std::uint64_t token, int socket)
+{
+  Registration* registration = find(token);
+  if (nullptr == registration || !registration->acceptCallback)
+    {
+      // Nobody is left to take ownership of it.
+      if (0 <= socket)
+        {
+          ::close(socket);
+        }
+      return;
+    }
+
+  try
+    {
+      registration->acceptCallback(socket);
+    }
+  catch (const std::exception& e)
+    {
+      failed(token, e);
+    }
+}
+
+void
+Networking::EventLoop
+::failed(std::uint64_t token, const std::exception& e)
+{
+  const int fd = static_cast<int>(token & 0xffffffff);
+  m_logStream("EventLoop: callback for fd " + std::to_string(fd)
+              + " threw: " + e.what());
+  if (nullptr != find(token))
+    {
+      remove(fd);
+    }
+}
+
+void Networking::EventLoop::expire(Registration& registration)
+{
+  Idle& idle = *registration.idle;
+  const Idle::Clock::time_point deadline = idle.getDeadline();
+  if (Idle::Clock::now() < deadline)
+    {
+      m_timers.schedule(idle.timer, deadline);
+      return;
+    }
+
+  // Closing the descriptor is left to its owner, which may still be using
+  // it. Once shut down, the socket is of no use to the owner but to close.
+  const int fd = static_cast<int>(registration.token & 0xffffffff);
+  if (-1 == ::shutdown(fd, SHUT_RDWR) && ENOTCONN != errno)
+    {
+      m_logStream("EventLoop: could not shut down idle fd "
+                  + std::to_string(fd) + ": "
+                  + std::system_category().message(errno));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
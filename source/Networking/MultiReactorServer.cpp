@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            MultiReactorServer.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the multi-reactor server.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/MultiReactorServer.h>
+
+#include <Networking/Affinity.h>
+#include <Networking/Interfaces/IListener.h>
+
+#include <exception>
+#include <thread>
+
+Networking::MultiReactorServer
+::MultiReactorServer(ListenerFactory listenerFactory, unsigned int numLoops,
+                     PinningPolicy pinningPolicy, EventLoop::Engine engine,
+                     std::function<void(const std::string&)> logStream)
+  : m_pinningPolicy{pinningPolicy}, m_logStream{logStream}
+{
+  if (0 == numLoops)
+    {
+      numLoops = std::thread::hardware_concurrency();
+      numLoops = 0 == numLoops ? 1 : numLoops;
+    }
+
+  m_loops.reserve(numLoops);
+  for (unsigned int i = 0; i < numLoops; ++i)
+    {
+      m_loops.push_back(std::make_unique<NonBlockingServer>
+                        (listenerFactory(), engine, logStream));
+    }
+}
+
+void Networking::MultiReactorServer::start()
+{
+  std::vector<std::thread> threads;
+  threads.reserve(m_loops.size() - 1);
+  for (std::size_t i = 1; i < m_loops.size(); ++i)
+    {
+      threads.emplace_back(&MultiReactorServer::run, this, i);
+    }
+
+  run(0);
+
+  for (auto& thread : threads)
+    {
+      thread.join();
+    }
+}
+
+void Networking::MultiReactorServer::stop()
+{
+  for (auto& loop : m_loops)
+    {
+      loop->stop();
+    }
+}
+
+std::vector<Networking::NonBlockingServer::Statistics>
+Networking::MultiReactorServer::getStatistics() const
+{
+  std::vector<NonBlockingServer::Statistics> statistics;
+  statistics.reserve(m_loops.size());
+  for (auto const& loop : m_loops)
+    {
+      statistics.push_back(loop->getStatistics());
+    }
+  return statistics;
+}
+
+void Networking::MultiReactorServer::run(std::size_t index)
+{
+  if (PinningPolicy::PIN_TO_CPU == m_pinningPolicy)
+    {
+      try
+        {
+          pinToCpu(index);
+        }
+      catch (const std::exception& e)
+        {
+          m_logStream("MultiReactorServer: could not pin loop "
+                      + std::to_string(index) + ": " + e.what());
+        }
+    }
+
+  // If one loop dies, take the rest down with it rather than serving from a
+  // reduced set of loops that the kernel still sends connections to.
+  try
+    {
+      m_loops[index]->start();
+    }
+  catch (const std::exception& e)
+    {
+      m_logStream("MultiReactorServer: loop " + std::to_string(index)
+                  + " failed: " + e.what());
+      stop();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -7,77 +7,188 @@
 //
 // CREATED:         04/17/2020
 //
-// LAST EDITED:     05/01/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #include <Networking/NetworkAddress.h>
 
 #include <arpa/inet.h>
+#include <net/if.h>
 
+#include <cstring>
+#include <stdexcept>
 #include <system_error>
 
 #define str(x) _str(x)
 #define _str(x) #x
 
+namespace
+{
+  const struct sockaddr_in& asIPv4(const struct sockaddr_storage& address)
+  { return reinterpret_cast<const struct sockaddr_in&>(address); }
+
+  const struct sockaddr_in6& asIPv6(const struct sockaddr_storage& address)
+  { return reinterpret_cast<const struct sockaddr_in6&>(address); }
+
+  struct sockaddr_in& asIPv4(struct sockaddr_storage& address)
+  { return reinterpret_cast<struct sockaddr_in&>(address); }
+
+  struct sockaddr_in6& asIPv6(struct sockaddr_storage& address)
+  { return reinterpret_cast<struct sockaddr_in6&>(address); }
+};
+
 Networking::NetworkAddress::NetworkAddress(struct sockaddr_in address)
-  : m_address{address}
-{}
+  : m_address{}
+{
+  asIPv4(m_address) = address;
+}
+
+Networking::NetworkAddress::NetworkAddress(struct sockaddr_in6 address)
+  : m_address{}
+{
+  asIPv6(m_address) = address;
+}
+
+Networking::NetworkAddress::NetworkAddress(const struct sockaddr* address,
+                                           socklen_t length)
+  : m_address{}
+{
+  if (!((AF_INET == address->sa_family
+         && sizeof(struct sockaddr_in) <= length)
+        || (AF_INET6 == address->sa_family
+            && sizeof(struct sockaddr_in6) <= length)))
+    {
+      throw std::invalid_argument{"NetworkAddress: not an IPv4 or IPv6"
+          " address"};
+    }
+  std::memcpy(&m_address, address, AF_INET == address->sa_family
+              ? sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6));
+}
 
 Networking::NetworkAddress::NetworkAddress(unsigned int ipHostOrder,
                                            unsigned short portHostOrder)
+  : m_address{}
 {
-  m_address = {};
-  m_address.sin_family = AF_INET;
-  m_address.sin_port = htons(portHostOrder);
-  m_address.sin_addr.s_addr = htonl(ipHostOrder);
+  struct sockaddr_in& address = asIPv4(m_address);
+  address.sin_family = AF_INET;
+  address.sin_port = htons(portHostOrder);
+  address.sin_addr.s_addr = htonl(ipHostOrder);
 }
 
 Networking::NetworkAddress
 ::NetworkAddress(const std::string& ipAddress,
                  unsigned short portHostOrder)
+  : m_address{}
 {
-  m_address = {};
-  m_address.sin_family = AF_INET;
-  m_address.sin_port = htons(portHostOrder);
+  struct sockaddr_in& address = asIPv4(m_address);
+  if (1 == inet_pton(AF_INET, ipAddress.c_str(), &address.sin_addr))
+    {
+      address.sin_family = AF_INET;
+      address.sin_port = htons(portHostOrder);
+      return;
+    }
+
+  std::string ip = ipAddress;
+  if (2 < ip.size() && '[' == ip.front() && ']' == ip.back())
+    {
+      ip = ip.substr(1, ip.size() - 2);
+    }
+
+  struct sockaddr_in6& address6 = asIPv6(m_address);
+  const std::string::size_type zoneIndex = ip.find('%');
+  if (std::string::npos != zoneIndex)
+    {
+      const std::string zone = ip.substr(zoneIndex + 1);
+      address6.sin6_scope_id = if_nametoindex(zone.c_str());
+      if (0 == address6.sin6_scope_id
+          && zone.find_first_not_of("0123456789") == std::string::npos
+          && !zone.empty())
+        {
+          address6.sin6_scope_id = std::stoul(zone);
+        }
+      ip = ip.substr(0, zoneIndex);
+    }
 
-  int result = inet_pton(AF_INET, ipAddress.c_str(), &(m_address.sin_addr));
-  if (1 != result)
+  if (1 != inet_pton(AF_INET6, ip.c_str(), &address6.sin6_addr)
+      || (std::string::npos != zoneIndex && 0 == address6.sin6_scope_id))
     {
       throw std::invalid_argument{"Value \"" + ipAddress
           + "\" is not a valid IP address."};
     }
+  address6.sin6_family = AF_INET6;
+  address6.sin6_port = htons(portHostOrder);
+}
+
+Networking::NetworkAddress
+::NetworkAddress(const NetworkAddress& address, unsigned short portHostOrder)
+  : m_address{address.m_address}
+{
+  if (AF_INET == getFamily())
+    {
+      asIPv4(m_address).sin_port = htons(portHostOrder);
+    }
+  else
+    {
+      asIPv6(m_address).sin6_port = htons(portHostOrder);
+    }
+}
+
+int Networking::NetworkAddress::getFamily() const
+{
+  return m_address.ss_family;
 }
 
 unsigned int Networking::NetworkAddress::getIPHostOrder() const
 {
-  return ntohl(m_address.sin_addr.s_addr);
+  if (AF_INET != getFamily())
+    {
+      throw std::logic_error{"NetworkAddress: " + getIPDotNotation()
+          + " is not an IPv4 address"};
+    }
+  return ntohl(asIPv4(m_address).sin_addr.s_addr);
 }
 
 std::string Networking::NetworkAddress::getIPDotNotation() const
 {
-  char nameBuffer[INET_ADDRSTRLEN];
+  char nameBuffer[INET6_ADDRSTRLEN];
   memset(nameBuffer, 0, sizeof(nameBuffer));
-  // TODO: Allow instantiation with IPv6 String.
-  if (nameBuffer != inet_ntop(PF_INET,
-                              &(m_address.sin_addr.s_addr),
-                              nameBuffer,
+  const void* ip = AF_INET == getFamily()
+    ? static_cast<const void*>(&asIPv4(m_address).sin_addr)
+    : static_cast<const void*>(&asIPv6(m_address).sin6_addr);
+  if (nameBuffer != inet_ntop(getFamily(), ip, nameBuffer,
                               sizeof(nameBuffer)))
     {
       throw std::system_error{errno, std::generic_category(),
           __FILE__":" str(__LINE__) ": Call to inet_ntop failed"};
     }
 
-  return std::string{const_cast<const char*>(nameBuffer)};
+  std::string result{const_cast<const char*>(nameBuffer)};
+  const unsigned int scope = AF_INET6 == getFamily()
+    ? asIPv6(m_address).sin6_scope_id : 0;
+  if (0 != scope)
+    {
+      char zone[IF_NAMESIZE];
+      result += "%" + (nullptr != if_indextoname(scope, zone)
+                       ? std::string{zone} : std::to_string(scope));
+    }
+  return result;
 }
 
 unsigned short Networking::NetworkAddress::getPortHostOrder() const
 {
-  return ntohs(m_address.sin_port);
+  return ntohs(AF_INET == getFamily() ? asIPv4(m_address).sin_port
+               : asIPv6(m_address).sin6_port);
+}
+
+const struct sockaddr* Networking::NetworkAddress::getSockAddr() const
+{
+  return reinterpret_cast<const struct sockaddr*>(&m_address);
 }
 
-const struct sockaddr_in& Networking::NetworkAddress::getSockAddr() const
+socklen_t Networking::NetworkAddress::getSockAddrLength() const
 {
-  return const_cast<const sockaddr_in&>(m_address);
+  return AF_INET == getFamily() ? sizeof(struct sockaddr_in)
+    : sizeof(struct sockaddr_in6);
 }
 
 std::string Networking::NetworkAddress::string() const
@@ -89,10 +200,24 @@ std::string Networking::NetworkAddress::string() const
 bool Networking::NetworkAddress
 ::operator==(const Networking::NetworkAddress& that) const
 {
-  return
-    m_address.sin_family == that.m_address.sin_family
-    && m_address.sin_port == that.m_address.sin_port
-    && m_address.sin_addr.s_addr == that.m_address.sin_addr.s_addr;
+  if (getFamily() != that.getFamily())
+    {
+      return false;
+    }
+  else if (AF_INET == getFamily())
+    {
+      const struct sockaddr_in& self = asIPv4(m_address);
+      const struct sockaddr_in& other = asIPv4(that.m_address);
+      return self.sin_port == other.sin_port
+        && self.sin_addr.s_addr == other.sin_addr.s_addr;
+    }
+
+  const struct sockaddr_in6& self = asIPv6(m_address);
+  const struct sockaddr_in6& other = asIPv6(that.m_address);
+  return self.sin6_port == other.sin6_port
+    && self.sin6_scope_id == other.sin6_scope_id
+    && 0 == std::memcmp(&self.sin6_addr, &other.sin6_addr,
+                        sizeof(self.sin6_addr));
 }
 
 bool Networking::NetworkAddress
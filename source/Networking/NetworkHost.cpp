@@ -7,34 +7,33 @@
 //
 // CREATED:         04/04/2020
 //
-// LAST EDITED:     04/18/2020
+// LAST EDITED:     10/18/2026
 ////
 
 #include <Networking/NetworkHost.h>
 
+#include <cstring>
+#include <limits>
 #include <system_error>
 
-#include <sys/types.h>
-#include <sys/socket.h>
-#include <netdb.h>
-
-#define str(x) _str(x)
-#define _str(x) #x
-
 Networking::NetworkHost::NetworkHost(NetworkAddress address)
-  : m_addresses{address}, m_hostname{nameLookup()}
+  : m_addresses{address}, m_hostname{}
 {}
 
 Networking::NetworkHost::NetworkHost(std::string hostString)
 {
-  std::string::size_type colonIndex = std::string::npos;
-  colonIndex = hostString.find(':');
-
-  if (std::string::npos == colonIndex)
+  // The port follows the last colon. An IPv6 address must be bracketed, so
+  // that its own colons are not mistaken for that one.
+  const std::string::size_type colonIndex = hostString.rfind(':');
+  const bool isBracketed = !hostString.empty() && '[' == hostString.front();
+  const bool isWellFormed = std::string::npos != colonIndex
+    && (isBracketed ? ']' == hostString[colonIndex - 1]
+        : colonIndex == hostString.find(':'));
+  if (!isWellFormed)
     {
       throw std::invalid_argument{"NetworkHost(const std::string& hostString):"
           " hostString must be in the form"
-          " \"<IPv4 | IPv6 | Hostname>:<port>\""};
+          " \"<IPv4 | [IPv6] | Hostname>:<port>\""};
     }
 
   int portNumberInt = std::stoi(hostString.substr(colonIndex + 1));
@@ -44,35 +43,60 @@ Networking::NetworkHost::NetworkHost(std::string hostString)
           + "\" is not in the range of valid port numbers."};
     }
 
+  *this = NetworkHost{isBracketed ? hostString.substr(1, colonIndex - 2)
+                      : hostString.substr(0, colonIndex),
+                      static_cast<unsigned short>(portNumberInt)};
+}
+
+Networking::NetworkHost
+::NetworkHost(std::string ipOrHostname, unsigned short portHostOrder)
+  : m_addresses{}
+{
   try
     {
-      m_addresses.push_back
-        (NetworkAddress(hostString.substr(0, colonIndex),
-                        static_cast<unsigned short>(portNumberInt)));
+      m_addresses.push_back(NetworkAddress(ipOrHostname, portHostOrder));
     }
   catch (const std::invalid_argument& e)
     {
-      getAddresses(hostString.substr(0, colonIndex),
-                   static_cast<unsigned short>(portNumberInt));
+      setAddresses(Resolver::getDefault().resolve(ipOrHostname).get(),
+                   portHostOrder);
+      m_hostname = ipOrHostname;
     }
-
-  m_hostname = nameLookup();
 }
 
 Networking::NetworkHost
-::NetworkHost(std::string ipOrHostname, unsigned short portHostOrder)
-  : m_addresses{}
+::NetworkHost(std::string hostname, unsigned short portHostOrder,
+              const Resolver::Addresses& addresses)
+  : m_addresses{}, m_hostname{hostname}
+{
+  setAddresses(addresses, portHostOrder);
+}
+
+std::future<Networking::NetworkHost>
+Networking::NetworkHost::lookup(std::string ipOrHostname,
+                                unsigned short portHostOrder,
+                                Resolver& resolver)
 {
   try
     {
-      m_addresses.push_back(NetworkAddress(ipOrHostname, portHostOrder));
+      NetworkAddress address{ipOrHostname, portHostOrder};
+      std::promise<NetworkHost> host;
+      host.set_value(NetworkHost{address});
+      return host.get_future();
     }
   catch (const std::invalid_argument& e)
     {
-      getAddresses(ipOrHostname, portHostOrder);
+      // Not an address, so it must be resolved.
     }
 
-  m_hostname = nameLookup();
+  std::shared_future<Resolver::Addresses> addresses
+    = resolver.resolve(ipOrHostname);
+  return std::async(std::launch::deferred,
+                    [ipOrHostname, portHostOrder, addresses]()
+                    {
+                      return NetworkHost{ipOrHostname, portHostOrder,
+                          addresses.get()};
+                    });
 }
 
 unsigned short Networking::NetworkHost::getPortHostOrder() const
@@ -111,70 +135,30 @@ Networking::NetworkHost::end() const
 
 std::string Networking::NetworkHost::getHostname() const
 {
-  return m_hostname;
-}
-
-std::string Networking::NetworkHost::nameLookup() const
-{
-  if (0 == m_addresses.size())
+  if (!m_hostname.empty())
     {
-      throw std::logic_error{__FILE__ ":" str(__LINE__) ": Cannot perform name"
-          " lookup for an empty IP address."};
+      return m_hostname;
     }
 
-  char hostBuffer[NI_MAXHOST + 1];
-  memset(hostBuffer, 0, sizeof(hostBuffer));
-  const struct sockaddr& address = reinterpret_cast<const struct sockaddr&>
-    ((*cbegin()).getSockAddr());
-  int result = getnameinfo(&address, sizeof(struct sockaddr_in), hostBuffer,
-                           NI_MAXHOST, NULL, 0, NI_NAMEREQD);
-  if (0 == result)
-    {
-      return std::string{hostBuffer};
-    }
-  else if (EAI_NONAME && 1 == m_addresses.size())
-    {
-      if ('\0' != hostBuffer[0])
-        {
-          return std::string{hostBuffer};
-        }
-      else
-        {
-          return (*cbegin()).getIPDotNotation();
-        }
-    }
-  else
-    {
-      throw std::system_error{result, std::generic_category(),
-          gai_strerror(result)};
-    }
+  const NetworkAddress& address = m_addresses.front();
+  std::string hostname = Resolver::getDefault().reverse(address).get();
+  return hostname.empty() ? address.getIPDotNotation() : hostname;
 }
 
 void Networking::NetworkHost
-::getAddresses(std::string hostname, unsigned short portHostOrder)
+::setAddresses(const Resolver::Addresses& addresses,
+               unsigned short portHostOrder)
 {
-  struct addrinfo hints = {}, *response = NULL;
-  hints.ai_family = AF_INET; // We don't currently support IPv6.
-
-  errno = 0;
-  int status = getaddrinfo(hostname.c_str(), NULL, &hints, &response);
-  if (0 != status)
+  if (addresses.empty())
     {
-      throw std::system_error{errno, std::generic_category(),
-          gai_strerror(status)};
+      throw std::system_error{EHOSTUNREACH, std::generic_category(),
+          "Name resolved to no addresses"};
     }
 
-  for (struct addrinfo* element = response; NULL != element;
-       element = element->ai_next)
+  for (const NetworkAddress& address : addresses)
     {
-      struct sockaddr_in& address
-        = reinterpret_cast<struct sockaddr_in&>(*(element->ai_addr));
-      address.sin_port = htons(portHostOrder);
-      m_addresses.push_back
-        (NetworkAddress{const_cast<const struct sockaddr_in&>(address)});
+      m_addresses.push_back(NetworkAddress{address, portHostOrder});
     }
-
-  freeaddrinfo(response);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -203,10 +187,10 @@ Networking::NetworkHost::NetworkHostConstIter
 
 bool Networking::NetworkHost::NetworkHostConstIter
 ::operator==(const NetworkHostConstIter& that) const
-{ return *m_iterator == *(that.m_iterator); }
+{ return m_iterator == that.m_iterator; }
 
 bool Networking::NetworkHost::NetworkHostConstIter
 ::operator!=(const NetworkHostConstIter& that) const
-{ return *m_iterator != *(that.m_iterator); }
+{ return m_iterator != that.m_iterator; }
 
 ///////////////////////////////////////////////////////////////////////////////
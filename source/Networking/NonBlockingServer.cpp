@@ -0,0 +1,202 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            NonBlockingServer.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the non-blocking server.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/NonBlockingServer.h>
+
+#include <Networking/Interfaces/IListener.h>
+#include <Networking/Interfaces/IRequest.h>
+
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+
+// Connections accepted per call to the listener. Bounds the number of
+// requests waiting in m_batch while the first ones are handled.
+static const std::size_t MAXIMUM_BATCH_SIZE = 64;
+
+// After an error accepting, e.g. for want of descriptors, how long to leave
+// the backlog before trying again.
+static const std::chrono::milliseconds ACCEPT_RETRY_DELAY{100};
+
+// The kernel can accept only on a socket, and a listener with several gives
+// an epoll instance instead (see IListener::getDescriptor()).
+static bool isSocket(int descriptor)
+{
+  int type = 0;
+  socklen_t length = sizeof(type);
+  return 0 == ::getsockopt(descriptor, SOL_SOCKET, SO_TYPE, &type, &length);
+}
+
+Networking::NonBlockingServer
+::NonBlockingServer(std::unique_ptr<Interfaces::IListener> listener,
+                    EventLoop::Engine engine,
+                    std::function<void(const std::string&)> logStream)
+  : m_listener{std::move(listener)}, m_logStream{logStream},
+    m_loop{engine, 256, logStream}, m_accepted{0}, m_failed{0},
+    m_acceptRetry{[this]()
+      {
+        accept();
+      }}
+{
+  m_batch.reserve(MAXIMUM_BATCH_SIZE);
+
+  // A blocking listener would stall every connection on the loop in accept.
+  const int flags = ::fcntl(m_listener->getDescriptor(), F_GETFL);
+  if (-1 == flags || !(flags & O_NONBLOCK))
+    {
+      throw std::invalid_argument{"NonBlockingServer: the listener must be"
+          " non-blocking"};
+    }
+}
+
+Networking::NonBlockingServer::~NonBlockingServer()
+{}
+
+void Networking::NonBlockingServer::start()
+{
+  const int listeningSocket = m_listener->getDescriptor();
+  if (EventLoop::IO_URING == m_loop.getEngine()
+      && isSocket(listeningSocket))
+    {
+      // Let the kernel accept the connections for us.
+      m_loop.accept(listeningSocket, [this](int socket) { adopt(socket); });
+    }
+  else
+    {
+      // A listener that already has connections pending is reported as
+      // ready as soon as it is added, so none are missed. They are accepted
+      // from within the loop, where handlers can reach EventLoop::current().
+      m_loop.add(listeningSocket, EventLoop::READABLE,
+                 [this](unsigned int) { accept(); });
+    }
+
+  m_loop.run();
+  m_loop.getTimers().cancel(m_acceptRetry);
+  m_loop.remove(listeningSocket);
+  m_loop.runOnce(0);
+}
+
+void Networking::NonBlockingServer::stop()
+{
+  m_loop.stop();
+}
+
+Networking::EventLoop& Networking::NonBlockingServer::getEventLoop()
+{
+  return m_loop;
+}
+
+Networking::NonBlockingServer::Statistics
+Networking::NonBlockingServer::getStatistics() const
+{
+  // Don't count the listening socket.
+  const std::size_t registered = m_loop.size();
+  return Statistics{m_accepted.load(), m_failed.load(),
+      0 == registered ? 0 : registered - 1};
+}
+
+void Networking::NonBlockingServer::accept()
+{
+  // Notification is edge-triggered, so drain the backlog, a batch at a time.
+  while (1)
+    {
+      bool failed = false;
+      try
+        {
+          m_listener->listenBatch(m_batch, MAXIMUM_BATCH_SIZE);
+        }
+      catch (const std::exception& e)
+        {
+          // e.g. EMFILE. What was accepted before the error is still handled
+          // below.
+          m_logStream(std::string{"NonBlockingServer: accept failed: "}
+                      + e.what());
+          failed = true;
+        }
+
+      const bool drained = m_batch.size() < MAXIMUM_BATCH_SIZE;
+      for (auto& request : m_batch)
+        {
+          handle(std::move(request));
+        }
+      m_batch.clear();
+      if (failed)
+        {
+          // The rest of the backlog gets no new edge, so come back for it.
+          m_loop.getTimers().schedule(m_acceptRetry,
+                                      TimerWheel::Clock::now()
+                                      + ACCEPT_RETRY_DELAY);
+          return;
+        }
+      else if (drained)
+        {
+          return;
+        }
+    }
+}
+
+void Networking::NonBlockingServer::adopt(int socket)
+{
+  if (0 > socket)
+    {
+      // e.g. EMFILE.
+      m_logStream(std::string{"NonBlockingServer: accept failed: "}
+                  + std::system_error{-socket, std::generic_category()}
+                  .what());
+      return;
+    }
+
+  std::unique_ptr<Interfaces::IRequest> request;
+  try
+    {
+      request = m_listener->adopt(socket);
+    }
+  catch (const std::exception& e)
+    {
+      m_logStream(std::string{"NonBlockingServer: accept failed: "}
+                  + e.what());
+      return;
+    }
+  handle(std::move(request));
+}
+
+void
+Networking::NonBlockingServer
+::handle(std::unique_ptr<Interfaces::IRequest> request)
+{
+  m_accepted.fetch_add(1, std::memory_order_relaxed);
+
+  const int socket = request->getDescriptor();
+  try
+    {
+      request->handle();
+    }
+  catch (const std::exception& e)
+    {
+      m_logStream(std::string{"NonBlockingServer: request handler threw: "}
+                  + e.what());
+      m_failed.fetch_add(1, std::memory_order_relaxed);
+      m_loop.remove(socket);
+      return;
+    }
+
+  if (0 <= socket && m_loop.contains(socket))
+    {
+      m_loop.adopt(socket, std::move(request));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
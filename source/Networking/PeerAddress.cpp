@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            PeerAddress.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the PeerAddress.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/PeerAddress.h>
+#include <Networking/Resolver.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include <algorithm>
+#include <cstring>
+#include <system_error>
+
+Networking::PeerAddress::PeerAddress() noexcept
+  : m_length{sizeof(m_address)}
+{
+  std::memset(&m_address, 0, sizeof(m_address));
+  m_address.ss_family = AF_UNSPEC;
+}
+
+Networking::PeerAddress::PeerAddress(const struct sockaddr* address,
+                                     socklen_t length) noexcept
+  : PeerAddress{}
+{
+  m_length = std::min<socklen_t>(length, sizeof(m_address));
+  std::memcpy(&m_address, address, m_length);
+}
+
+Networking::PeerAddress::PeerAddress(const NetworkAddress& address) noexcept
+  : PeerAddress{address.getSockAddr(), address.getSockAddrLength()}
+{}
+
+int Networking::PeerAddress::getFamily() const noexcept
+{
+  return m_address.ss_family;
+}
+
+const struct sockaddr* Networking::PeerAddress::getSockAddr() const noexcept
+{
+  return reinterpret_cast<const struct sockaddr*>(&m_address);
+}
+
+socklen_t Networking::PeerAddress::getLength() const noexcept
+{
+  return m_length;
+}
+
+struct sockaddr* Networking::PeerAddress::getSockAddr() noexcept
+{
+  return reinterpret_cast<struct sockaddr*>(&m_address);
+}
+
+socklen_t& Networking::PeerAddress::getLength() noexcept
+{
+  return m_length;
+}
+
+unsigned short Networking::PeerAddress::getPortHostOrder() const
+{
+  switch (m_address.ss_family)
+    {
+    case AF_INET:
+      return ntohs(reinterpret_cast<const struct sockaddr_in&>(m_address)
+                   .sin_port);
+    case AF_INET6:
+      return ntohs(reinterpret_cast<const struct sockaddr_in6&>(m_address)
+                   .sin6_port);
+    default:
+      return 0;
+    }
+}
+
+std::string Networking::PeerAddress::getIPString() const
+{
+  char nameBuffer[INET6_ADDRSTRLEN];
+  memset(nameBuffer, 0, sizeof(nameBuffer));
+  const void* address = nullptr;
+  switch (m_address.ss_family)
+    {
+    case AF_INET:
+      address = &reinterpret_cast<const struct sockaddr_in&>(m_address)
+        .sin_addr;
+      break;
+    case AF_INET6:
+      address = &reinterpret_cast<const struct sockaddr_in6&>(m_address)
+        .sin6_addr;
+      break;
+    default:
+      return "";
+    }
+
+  if (nullptr == inet_ntop(m_address.ss_family, address, nameBuffer,
+                           sizeof(nameBuffer)))
+    {
+      throw std::system_error{errno, std::generic_category(),
+          "PeerAddress: call to inet_ntop failed"};
+    }
+  return std::string{nameBuffer};
+}
+
+std::string Networking::PeerAddress::getHostname() const
+{
+  if (AF_INET != m_address.ss_family && AF_INET6 != m_address.ss_family)
+    {
+      return getIPString();
+    }
+
+  std::string hostname = Resolver::getDefault().reverse(getNetworkAddress())
+    .get();
+  return hostname.empty() ? getIPString() : hostname;
+}
+
+std::string Networking::PeerAddress::string() const
+{
+  return "(" + getIPString() + ", " + std::to_string(getPortHostOrder())
+    + ")";
+}
+
+Networking::NetworkAddress Networking::PeerAddress::getNetworkAddress() const
+{
+  return NetworkAddress{getSockAddr(), m_length};
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            RequestPool.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the RequestPool.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/RequestPool.h>
+
+#include <new>
+
+// Each block is prefixed by a header naming the pool it came from, padded so
+// that the caller's storage is suitably aligned for any type.
+union BlockHeader
+{
+  Networking::RequestPool* pool;
+  std::max_align_t alignment;
+};
+
+static const std::size_t HEADER_SIZE = sizeof(BlockHeader);
+
+std::shared_ptr<Networking::RequestPool>
+Networking::RequestPool::create(std::size_t blockSize, std::size_t maxFree)
+{
+  return std::shared_ptr<RequestPool>{new RequestPool{blockSize, maxFree},
+                                      [](RequestPool* pool)
+                                      { pool->release(); }};
+}
+
+Networking::RequestPool::RequestPool(std::size_t blockSize,
+                                     std::size_t maxFree)
+  : m_blockSize{blockSize}, m_maxFree{maxFree}, m_outstanding{0},
+    m_released{false}
+{
+  m_free.reserve(maxFree);
+}
+
+Networking::RequestPool::~RequestPool()
+{
+  for (void* block : m_free)
+    {
+      ::operator delete(block);
+    }
+}
+
+void* Networking::RequestPool::allocate(std::size_t size)
+{
+  if (size > m_blockSize)
+    {
+      throw std::bad_alloc{};
+    }
+
+  void* block = nullptr;
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (!m_free.empty())
+      {
+        block = m_free.back();
+        m_free.pop_back();
+      }
+    ++m_outstanding;
+  }
+
+  if (nullptr == block)
+    {
+      try
+        {
+          block = ::operator new(HEADER_SIZE + m_blockSize);
+        }
+      catch (...)
+        {
+          std::lock_guard<std::mutex> lock{m_mutex};
+          --m_outstanding;
+          throw;
+        }
+    }
+
+  static_cast<BlockHeader*>(block)->pool = this;
+  return static_cast<char*>(block) + HEADER_SIZE;
+}
+
+void Networking::RequestPool::deallocate(void* storage) noexcept
+{
+  if (nullptr == storage)
+    {
+      return;
+    }
+
+  void* block = static_cast<char*>(storage) - HEADER_SIZE;
+  RequestPool* pool = static_cast<BlockHeader*>(block)->pool;
+
+  bool destroy = false;
+  {
+    std::lock_guard<std::mutex> lock{pool->m_mutex};
+    --pool->m_outstanding;
+    if (!pool->m_released && pool->m_free.size() < pool->m_maxFree)
+      {
+        pool->m_free.push_back(block);
+        block = nullptr;
+      }
+    destroy = pool->m_released && 0 == pool->m_outstanding;
+  }
+
+  ::operator delete(block);
+  if (destroy)
+    {
+      delete pool;
+    }
+}
+
+std::size_t Networking::RequestPool::getBlockSize() const
+{
+  return m_blockSize;
+}
+
+void Networking::RequestPool::release() noexcept
+{
+  bool destroy = false;
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_released = true;
+    destroy = 0 == m_outstanding;
+  }
+
+  if (destroy)
+    {
+      delete this;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,388 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            Resolver.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the asynchronous DNS resolver.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/Resolver.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netdb.h>
+
+namespace
+{
+  // The resolvers that exist, for the fork handlers.
+  std::mutex registryMutex;
+  std::vector<Networking::Resolver*> registry;
+  std::once_flag forkHandlers;
+}
+
+Networking::Resolver::Resolver(unsigned int numWorkers,
+                               std::chrono::seconds ttl,
+                               std::chrono::seconds negativeTtl,
+                               std::size_t capacity, ForwardLookup forward,
+                               ReverseLookup reverse)
+  : m_numWorkers{0 == numWorkers ? 1 : numWorkers}, m_ttl{ttl},
+    m_negativeTtl{negativeTtl}, m_capacity{capacity}, m_forward{forward},
+    m_reverse{reverse}, m_stopping{false}, m_statistics{}, m_nextId{0}
+{
+  std::call_once(forkHandlers, []()
+    {
+      if (0 != ::pthread_atfork(prepareFork, parentFork, childFork))
+        {
+          throw std::runtime_error{"Resolver: could not register the fork"
+              " handlers"};
+        }
+    });
+
+  std::lock_guard<std::mutex> lock{registryMutex};
+  registry.push_back(this);
+}
+
+Networking::Resolver::~Resolver()
+{
+  {
+    std::lock_guard<std::mutex> lock{registryMutex};
+    registry.erase(std::find(registry.begin(), registry.end(), this));
+  }
+
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_stopping = true;
+  }
+  m_ready.notify_all();
+  // Only ever the threads of this process (see childFork()).
+  for (std::thread& worker : m_workers)
+    {
+      worker.join();
+    }
+}
+
+Networking::Resolver& Networking::Resolver::getDefault()
+{
+  static Resolver resolver{4, std::chrono::seconds{60},
+                           std::chrono::seconds{5}, 4096, getAddrInfo,
+                           getNameInfo};
+  return resolver;
+}
+
+std::shared_future<Networking::Resolver::Addresses>
+Networking::Resolver::resolve(const std::string& hostname)
+{
+  return find<Addresses>(m_forwardCache, hostname, [this, hostname]()
+                         { return m_forward(hostname); });
+}
+
+std::shared_future<std::string>
+Networking::Resolver::reverse(const NetworkAddress& address)
+{
+  return find<std::string>(m_reverseCache, address.getIPDotNotation(),
+                           [this, address]()
+                           { return m_reverse(address); });
+}
+
+void Networking::Resolver::clear()
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  m_forwardCache.clear();
+  m_reverseCache.clear();
+}
+
+Networking::Resolver::Statistics Networking::Resolver::getStatistics() const
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  Statistics statistics = m_statistics;
+  statistics.entries = m_forwardCache.size() + m_reverseCache.size();
+  return statistics;
+}
+
+Networking::Resolver::Addresses
+Networking::Resolver::getAddrInfo(const std::string& hostname)
+{
+  struct addrinfo hints = {}, *response = NULL;
+  // Addresses of either family, in the order of preference of RFC 6724.
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+
+  errno = 0;
+  int status = getaddrinfo(hostname.c_str(), NULL, &hints, &response);
+  if (0 != status)
+    {
+      throw std::system_error{EAI_SYSTEM == status ? errno : EHOSTUNREACH,
+          std::generic_category(), hostname + ": " + gai_strerror(status)};
+    }
+
+  Addresses addresses;
+  for (struct addrinfo* element = response; NULL != element;
+       element = element->ai_next)
+    {
+      if (AF_INET == element->ai_family || AF_INET6 == element->ai_family)
+        {
+          addresses.push_back(NetworkAddress{element->ai_addr,
+                                             element->ai_addrlen});
+        }
+    }
+
+  freeaddrinfo(response);
+  return addresses;
+}
+
+std::string Networking::Resolver::getNameInfo(const NetworkAddress& address)
+{
+  char hostBuffer[NI_MAXHOST + 1];
+  memset(hostBuffer, 0, sizeof(hostBuffer));
+  int result = getnameinfo(address.getSockAddr(),
+                           address.getSockAddrLength(), hostBuffer,
+                           NI_MAXHOST, NULL, 0, NI_NAMEREQD);
+  return 0 == result ? std::string{hostBuffer} : std::string{};
+}
+
+template<class T>
+std::shared_future<T>
+Networking::Resolver::find(Cache<T>& cache, const std::string& key,
+                           std::function<T()> lookup)
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  const auto now = std::chrono::steady_clock::now();
+  auto found = cache.find(key);
+  if (cache.end() != found)
+    {
+      Entry<T>& entry = found->second;
+      if (entry.pending)
+        {
+          ++m_statistics.coalesced;
+          return entry.result;
+        }
+      else if (now < entry.expiry)
+        {
+          ++m_statistics.hits;
+          if (entry.failed)
+            {
+              ++m_statistics.negativeHits;
+            }
+          return entry.result;
+        }
+      cache.erase(found);
+    }
+
+  // Before anything is queued, so that there is nothing to undo if no
+  // thread can be started.
+  if (m_workers.empty())
+    {
+      startWorkers();
+    }
+
+  makeRoom(cache, now);
+  auto promise = std::make_shared<std::promise<T>>();
+  std::shared_future<T> result = promise->get_future().share();
+  const std::uint64_t id = m_nextId++;
+  cache.emplace(key, Entry<T>{result, now, id, true, false});
+
+  m_queue.push_back([this, &cache, key, id, promise, lookup]()
+    {
+      bool failed = false;
+      try
+        {
+          promise->set_value(lookup());
+        }
+      catch (...)
+        {
+          failed = true;
+          promise->set_exception(std::current_exception());
+        }
+
+      std::lock_guard<std::mutex> lock{m_mutex};
+      auto entry = cache.find(key);
+      // The cache may have been cleared while we were looking.
+      if (cache.end() != entry && id == entry->second.id)
+        {
+          entry->second.pending = false;
+          entry->second.failed = failed;
+          entry->second.expiry = std::chrono::steady_clock::now()
+            + (failed ? m_negativeTtl : m_ttl);
+        }
+    });
+  ++m_statistics.lookups;
+  m_ready.notify_one();
+  return result;
+}
+
+// Called with the lock held, before adding an entry to cache.
+template<class T>
+void Networking::Resolver::makeRoom(Cache<T>& cache,
+                                    std::chrono::steady_clock::time_point now)
+{
+  if (cache.size() < m_capacity)
+    {
+      return;
+    }
+
+  for (auto entry = cache.begin(); cache.end() != entry;)
+    {
+      if (!entry->second.pending && now >= entry->second.expiry)
+        {
+          entry = cache.erase(entry);
+        }
+      else
+        {
+          ++entry;
+        }
+    }
+
+  // Nothing has expired, so make room at the expense of some live entry.
+  for (auto entry = cache.begin();
+       cache.end() != entry && cache.size() >= m_capacity;)
+    {
+      if (entry->second.pending)
+        {
+          ++entry;
+          continue;
+        }
+      entry = cache.erase(entry);
+      ++m_statistics.evictions;
+    }
+}
+
+void Networking::Resolver::work()
+{
+  for (;;)
+    {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_ready.wait(lock, [this]()
+                     { return m_stopping || !m_queue.empty(); });
+        if (m_stopping)
+          {
+            return;
+          }
+        task = std::move(m_queue.front());
+        m_queue.pop_front();
+      }
+      task();
+    }
+}
+
+void Networking::Resolver::startWorkers()
+{
+  while (m_workers.size() < m_numWorkers)
+    {
+      try
+        {
+          m_workers.emplace_back([this]() { work(); });
+        }
+      catch (...)
+        {
+          // Make do with those there are.
+          if (m_workers.empty())
+            {
+              throw;
+            }
+          return;
+        }
+    }
+}
+
+// No resolver's lock may be held by a thread that the child will not have.
+void Networking::Resolver::prepareFork()
+{
+  registryMutex.lock();
+  for (Resolver* resolver : registry)
+    {
+      resolver->m_mutex.lock();
+    }
+}
+
+void Networking::Resolver::parentFork()
+{
+  for (Resolver* resolver : registry)
+    {
+      resolver->m_mutex.unlock();
+    }
+  registryMutex.unlock();
+}
+
+void Networking::Resolver::childFork()
+{
+  for (Resolver* resolver : registry)
+    {
+      // The handles are of the parent's threads: they must be neither
+      // joined nor destroyed while joinable, and so are leaked.
+      new std::vector<std::thread>(std::move(resolver->m_workers));
+      resolver->m_workers.clear();
+      // Its waiters were the parent's workers.
+      new (&resolver->m_ready) std::condition_variable;
+
+      // Lookups not yet started break their promises. Those the parent's
+      // workers were answering would never be, so their entries are
+      // dropped, and the names looked up again.
+      resolver->m_queue.clear();
+      for (auto entry = resolver->m_forwardCache.begin();
+           resolver->m_forwardCache.end() != entry;)
+        {
+          entry = entry->second.pending
+            ? resolver->m_forwardCache.erase(entry) : std::next(entry);
+        }
+      for (auto entry = resolver->m_reverseCache.begin();
+           resolver->m_reverseCache.end() != entry;)
+        {
+          entry = entry->second.pending
+            ? resolver->m_reverseCache.erase(entry) : std::next(entry);
+        }
+      resolver->m_mutex.unlock();
+    }
+  registryMutex.unlock();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Resolver::Builder
+////
+
+Networking::Resolver::Builder
+Networking::Resolver::Builder::setNumWorkers(unsigned int value)
+{ numWorkers = value; return *this; }
+
+Networking::Resolver::Builder
+Networking::Resolver::Builder::setTtl(std::chrono::seconds value)
+{ ttl = value; return *this; }
+
+Networking::Resolver::Builder
+Networking::Resolver::Builder::setNegativeTtl(std::chrono::seconds value)
+{ negativeTtl = value; return *this; }
+
+Networking::Resolver::Builder
+Networking::Resolver::Builder::setCapacity(std::size_t value)
+{ capacity = value; return *this; }
+
+Networking::Resolver::Builder
+Networking::Resolver::Builder::setForwardLookup(ForwardLookup value)
+{ forward = value; return *this; }
+
+Networking::Resolver::Builder
+Networking::Resolver::Builder::setReverseLookup(ReverseLookup value)
+{ reverse = value; return *this; }
+
+std::unique_ptr<Networking::Resolver>
+Networking::Resolver::Builder::build() const
+{
+  return std::make_unique<Resolver>(numWorkers, ttl, negativeTtl, capacity,
+                                    forward, reverse);
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            RingBuffer.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the mirrored ring buffer.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/RingBuffer.h>
+#include <Networking/FileDescriptor.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+Networking::RingBuffer::RingBuffer(std::size_t capacity)
+  : m_memory{nullptr}, m_capacity{0}, m_head{0}, m_tail{0}
+{
+  const std::size_t pageSize = static_cast<std::size_t>
+    (::sysconf(_SC_PAGESIZE));
+  m_capacity = (std::max<std::size_t>(capacity, 1) + pageSize - 1)
+    / pageSize * pageSize;
+
+  // The pages are only reachable through the mappings, so the descriptor
+  // need not outlive the constructor.
+  FileDescriptor memory{::memfd_create("RingBuffer", MFD_CLOEXEC)};
+  if (!memory || -1 == ::ftruncate(memory.get(), m_capacity))
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+
+  // Reserve room for both copies, then map the pages into each half.
+  void* reserved = ::mmap(nullptr, 2 * m_capacity, PROT_NONE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (MAP_FAILED == reserved)
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+
+  char* base = static_cast<char*>(reserved);
+  for (char* half : {base, base + m_capacity})
+    {
+      if (MAP_FAILED == ::mmap(half, m_capacity, PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_FIXED, memory.get(), 0))
+        {
+          const int error = errno;
+          ::munmap(reserved, 2 * m_capacity);
+          throw std::system_error{error, std::generic_category()};
+        }
+    }
+  m_memory = base;
+}
+
+Networking::RingBuffer::RingBuffer(RingBuffer&& other) noexcept
+  : m_memory{std::exchange(other.m_memory, nullptr)},
+    m_capacity{std::exchange(other.m_capacity, 0)},
+    m_head{std::exchange(other.m_head, 0)},
+    m_tail{std::exchange(other.m_tail, 0)}
+{}
+
+Networking::RingBuffer::~RingBuffer()
+{
+  if (nullptr != m_memory)
+    {
+      ::munmap(m_memory, 2 * m_capacity);
+    }
+}
+
+std::size_t Networking::RingBuffer::getCapacity() const
+{
+  return m_capacity;
+}
+
+std::size_t Networking::RingBuffer::size() const
+{
+  return m_tail - m_head;
+}
+
+std::size_t Networking::RingBuffer::space() const
+{
+  return m_capacity - size();
+}
+
+std::string_view Networking::RingBuffer::data() const
+{
+  return std::string_view{m_memory + m_head % m_capacity, size()};
+}
+
+void Networking::RingBuffer::consume(std::size_t length)
+{
+  if (length > size())
+    {
+      throw std::out_of_range{"RingBuffer: cannot consume "
+          + std::to_string(length) + " bytes of " + std::to_string(size())};
+    }
+  m_head += length;
+}
+
+char* Networking::RingBuffer::getWritePointer()
+{
+  return m_memory + m_tail % m_capacity;
+}
+
+void Networking::RingBuffer::commit(std::size_t length)
+{
+  if (length > space())
+    {
+      throw std::out_of_range{"RingBuffer: cannot commit "
+          + std::to_string(length) + " bytes with room for "
+          + std::to_string(space())};
+    }
+  m_tail += length;
+}
+
+///////////////////////////////////////////////////////////////////////////////
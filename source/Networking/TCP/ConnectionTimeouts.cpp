@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            ConnectionTimeouts.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Enforcement of the connection timeouts for blocking
+//                  handlers.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TCP/ConnectionTimeouts.h>
+#include <Networking/TimerThread.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <system_error>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+Networking::TCP::ConnectionTimeouts::Guard
+::Guard(int socket, const ConnectionTimeouts& timeouts,
+        TimerThread* timerThread)
+  : m_socket{socket}, m_timeouts{timeouts}, m_timerThread{timerThread},
+    m_timer{[this]()
+      {
+        check();
+      }}
+{
+  if (0 < m_timeouts.readWrite.count())
+    {
+      struct timeval timeout = {};
+      timeout.tv_sec = m_timeouts.readWrite.count() / 1000;
+      timeout.tv_usec = m_timeouts.readWrite.count() % 1000 * 1000;
+      if (-1 == ::setsockopt(m_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout,
+                             sizeof(timeout))
+          || -1 == ::setsockopt(m_socket, SOL_SOCKET, SO_SNDTIMEO, &timeout,
+                                sizeof(timeout)))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+    }
+
+  if (0 < m_timeouts.idle.count() && nullptr != m_timerThread)
+    {
+      m_timerThread->schedule(m_timer, TimerWheel::Clock::now()
+                              + m_timeouts.idle);
+    }
+}
+
+Networking::TCP::ConnectionTimeouts::Guard::~Guard()
+{
+  // Before the socket is closed, and its descriptor reused.
+  if (nullptr != m_timerThread)
+    {
+      m_timerThread->cancel(m_timer);
+    }
+}
+
+bool Networking::TCP::ConnectionTimeouts::Guard::awaitFirstByte() const
+{
+  if (0 >= m_timeouts.firstByte.count())
+    {
+      return true;
+    }
+
+  const TimerWheel::Clock::time_point deadline
+    = TimerWheel::Clock::now() + m_timeouts.firstByte;
+  struct pollfd ready = {m_socket, POLLIN, 0};
+  for (;;)
+    {
+      const auto remaining = std::chrono::ceil<std::chrono::milliseconds>
+        (deadline - TimerWheel::Clock::now()).count();
+      const int result = ::poll(&ready, 1, static_cast<int>
+                                (std::clamp<decltype(remaining)>
+                                 (remaining, 0, INT_MAX)));
+      if (0 < result)
+        {
+          return true;
+        }
+      else if (0 == result)
+        {
+          return false;
+        }
+      else if (EINTR != errno)
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+    }
+}
+
+// Called on the timer thread, with the handler's thread still using the
+// socket, which is therefore only shut down, never closed, from here.
+void Networking::TCP::ConnectionTimeouts::Guard::check()
+{
+  struct tcp_info info = {};
+  socklen_t length = sizeof(info);
+  if (-1 == ::getsockopt(m_socket, IPPROTO_TCP, TCP_INFO, &info, &length))
+    {
+      return;
+    }
+
+  const std::chrono::milliseconds quiet
+    {std::min(info.tcpi_last_data_recv, info.tcpi_last_data_sent)};
+  if (quiet < m_timeouts.idle)
+    {
+      m_timerThread->schedule(m_timer, TimerWheel::Clock::now()
+                              + (m_timeouts.idle - quiet));
+      return;
+    }
+  ::shutdown(m_socket, SHUT_RDWR);
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,206 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            FrameCodec.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the message framing codec.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TCP/FrameCodec.h>
+#include <Networking/TCP/Stream.h>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <sys/uio.h>
+
+namespace
+{
+  // Room the buffer keeps beyond the longest frame, so that once complete
+  // frames have been taken, a read of a whole TLS record (or of a Stream's
+  // buffer) fits, and goes straight into the ring.
+  constexpr std::size_t READ_SIZE = 16384;
+};
+
+Networking::TCP::FrameCodec::FrameCodec(Framing framing,
+                                        unsigned int prefixSize,
+                                        std::string delimiter,
+                                        std::size_t maxFrameSize)
+  : m_framing{framing}, m_prefixSize{prefixSize},
+    m_delimiter{std::move(delimiter)}, m_maxFrameSize{maxFrameSize},
+    m_buffer{maxFrameSize + (LENGTH_PREFIXED == framing ? prefixSize
+                             : m_delimiter.size()) + READ_SIZE},
+    m_scanned{0}
+{
+  if (LENGTH_PREFIXED == m_framing)
+    {
+      if (1 != m_prefixSize && 2 != m_prefixSize && 4 != m_prefixSize
+          && 8 != m_prefixSize)
+        {
+          throw std::invalid_argument{"FrameCodec: the length prefix must"
+              " be of 1, 2, 4 or 8 bytes"};
+        }
+      else if (8 > m_prefixSize
+               && 0 != (static_cast<std::uint64_t>(m_maxFrameSize)
+                        >> (8 * m_prefixSize)))
+        {
+          throw std::invalid_argument{"FrameCodec: the maximum frame size"
+              " does not fit in the length prefix"};
+        }
+    }
+  else if (m_delimiter.empty())
+    {
+      throw std::invalid_argument{"FrameCodec: the delimiter is empty"};
+    }
+}
+
+std::size_t Networking::TCP::FrameCodec::fill(Stream& stream)
+{
+  if (0 == m_buffer.space())
+    {
+      throw std::logic_error{"FrameCodec: the buffer is full; frames must"
+          " be taken with next() before filling it"};
+    }
+
+  const std::size_t received = stream.read(m_buffer.getWritePointer(),
+                                           m_buffer.space());
+  m_buffer.commit(received);
+  return received;
+}
+
+void Networking::TCP::FrameCodec::append(std::string_view data)
+{
+  if (data.size() > m_buffer.space())
+    {
+      throw std::length_error{"FrameCodec: no room for "
+          + std::to_string(data.size()) + " bytes; frames must be taken"
+          " with next() before appending more"};
+    }
+  std::memcpy(m_buffer.getWritePointer(), data.data(), data.size());
+  m_buffer.commit(data.size());
+}
+
+std::optional<std::string_view> Networking::TCP::FrameCodec::next()
+{
+  const std::string_view data = m_buffer.data();
+  if (LENGTH_PREFIXED == m_framing)
+    {
+      if (data.size() < m_prefixSize)
+        {
+          return std::nullopt;
+        }
+
+      std::uint64_t length = 0;
+      for (unsigned int i = 0; i < m_prefixSize; ++i)
+        {
+          length = length << 8 | static_cast<unsigned char>(data[i]);
+        }
+      check(length);
+      if (data.size() - m_prefixSize < length)
+        {
+          return std::nullopt;
+        }
+
+      // The bytes stay where they are until the next fill().
+      m_buffer.consume(m_prefixSize + length);
+      return data.substr(m_prefixSize, length);
+    }
+
+  const std::size_t end = data.find(m_delimiter, m_scanned);
+  if (std::string_view::npos == end)
+    {
+      // The delimiter may have begun to arrive at the end of the data.
+      const std::size_t overlap = m_delimiter.size() - 1;
+      m_scanned = data.size() > overlap ? data.size() - overlap : 0;
+      check(m_scanned);
+      return std::nullopt;
+    }
+
+  check(end);
+  m_scanned = 0;
+  m_buffer.consume(end + m_delimiter.size());
+  return data.substr(0, end);
+}
+
+std::size_t Networking::TCP::FrameCodec::getBuffered() const
+{
+  return m_buffer.size();
+}
+
+void Networking::TCP::FrameCodec::write(Stream& stream,
+                                        std::string_view payload) const
+{
+  if (payload.size() > m_maxFrameSize)
+    {
+      throw std::invalid_argument{"FrameCodec: a frame of "
+          + std::to_string(payload.size()) + " bytes exceeds the maximum of "
+          + std::to_string(m_maxFrameSize)};
+    }
+
+  if (LENGTH_PREFIXED == m_framing)
+    {
+      char prefix[8];
+      for (unsigned int i = 0; i < m_prefixSize; ++i)
+        {
+          prefix[i] = static_cast<char>
+            (static_cast<std::uint64_t>(payload.size())
+             >> (8 * (m_prefixSize - 1 - i)));
+        }
+      const struct iovec vector[] = {
+        {prefix, m_prefixSize},
+        {const_cast<char*>(payload.data()), payload.size()}
+      };
+      stream.writev(vector, 2);
+      return;
+    }
+
+  if (std::string_view::npos != payload.find(m_delimiter))
+    {
+      throw std::invalid_argument{"FrameCodec: the payload contains the"
+          " delimiter"};
+    }
+  const struct iovec vector[] = {
+    {const_cast<char*>(payload.data()), payload.size()},
+    {const_cast<char*>(m_delimiter.data()), m_delimiter.size()}
+  };
+  stream.writev(vector, 2);
+}
+
+void Networking::TCP::FrameCodec::check(std::size_t frameSize) const
+{
+  if (frameSize > m_maxFrameSize)
+    {
+      throw std::runtime_error{"FrameCodec: the peer sent a frame of more"
+          " than " + std::to_string(m_maxFrameSize) + " bytes"};
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// FrameCodec::Builder
+////
+
+Networking::TCP::FrameCodec::Builder
+Networking::TCP::FrameCodec::Builder::setLengthPrefixed(unsigned int value)
+{ framing = LENGTH_PREFIXED; prefixSize = value; return *this; }
+
+Networking::TCP::FrameCodec::Builder
+Networking::TCP::FrameCodec::Builder::setDelimited(std::string value)
+{ framing = DELIMITED; delimiter = value; return *this; }
+
+Networking::TCP::FrameCodec::Builder
+Networking::TCP::FrameCodec::Builder::setMaxFrameSize(std::size_t value)
+{ maxFrameSize = value; return *this; }
+
+Networking::TCP::FrameCodec Networking::TCP::FrameCodec::Builder::build()
+  const
+{
+  return FrameCodec{framing, prefixSize, delimiter, maxFrameSize};
+}
+
+///////////////////////////////////////////////////////////////////////////////
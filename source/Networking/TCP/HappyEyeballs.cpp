@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            HappyEyeballs.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the staggered parallel connect.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TCP/HappyEyeballs.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+
+namespace
+{
+  struct Attempt
+  {
+    Networking::FileDescriptor socket;
+    const Networking::NetworkAddress* address;
+    std::chrono::steady_clock::time_point deadline;
+  };
+
+  class Failures
+  {
+  public:
+    void add(const Networking::NetworkAddress& address, int error)
+    {
+      m_lastError = error;
+      m_errorStack += "\n" + address.string() + " (errno="
+        + std::to_string(error) + ") " + std::string{strerror(error)};
+    }
+
+    [[noreturn]] void raise() const
+    {
+      throw std::system_error{m_lastError, std::generic_category(),
+          m_errorStack};
+    }
+
+  private:
+    int m_lastError = EHOSTUNREACH;
+    std::string m_errorStack = "Host Connect Failures:";
+  };
+
+  // Orders the addresses as RFC 8305 section 4 asks: alternating between
+  // the families, starting with that of the most preferred address, and
+  // otherwise keeping the order of preference.
+  std::vector<const Networking::NetworkAddress*>
+  interleave(const std::vector<Networking::NetworkAddress>& addresses)
+  {
+    std::vector<const Networking::NetworkAddress*> first, second, order;
+    for (const Networking::NetworkAddress& address : addresses)
+      {
+        (address.getFamily() == addresses.front().getFamily()
+         ? first : second).push_back(&address);
+      }
+
+    order.reserve(addresses.size());
+    for (std::size_t i = 0; i < std::max(first.size(), second.size()); ++i)
+      {
+        if (i < first.size())
+          {
+            order.push_back(first[i]);
+          }
+        if (i < second.size())
+          {
+            order.push_back(second[i]);
+          }
+      }
+    return order;
+  }
+
+  bool setBlocking(int fd, bool blocking)
+  {
+    const int flags = ::fcntl(fd, F_GETFL);
+    if (-1 == flags)
+      {
+        return false;
+      }
+    const int wanted = blocking ? flags & ~O_NONBLOCK : flags | O_NONBLOCK;
+    return wanted == flags || -1 != ::fcntl(fd, F_SETFL, wanted);
+  }
+};
+
+Networking::FileDescriptor
+Networking::TCP::connectFirst(const std::vector<NetworkAddress>& addresses,
+                              std::chrono::milliseconds attemptDelay,
+                              std::chrono::milliseconds attemptTimeout)
+{
+  using Clock = std::chrono::steady_clock;
+  Failures failures;
+  // Attempts still in flight are closed, and so cancelled, when this goes
+  // out of scope.
+  std::vector<Attempt> pending;
+  std::vector<struct pollfd> events;
+  const std::vector<const NetworkAddress*> order = interleave(addresses);
+  auto next = order.cbegin();
+  Clock::time_point nextStart = Clock::now();
+
+  for (;;)
+    {
+      Clock::time_point now = Clock::now();
+      if (order.cend() != next && now >= nextStart)
+        {
+          const NetworkAddress& address = **next++;
+          nextStart = now + attemptDelay;
+
+          errno = 0;
+          FileDescriptor socket{::socket(address.getFamily(), SOCK_STREAM,
+                                         0)};
+          if (!socket || !setBlocking(socket.get(), false))
+            {
+              failures.add(address, errno);
+              nextStart = now;
+              continue;
+            }
+
+          if (0 == ::connect(socket.get(), address.getSockAddr(),
+                             address.getSockAddrLength()))
+            {
+              if (setBlocking(socket.get(), true))
+                {
+                  return socket;
+                }
+              failures.add(address, errno);
+            }
+          else if (EINPROGRESS == errno)
+            {
+              pending.push_back(Attempt{std::move(socket), &address,
+                                        now + attemptTimeout});
+            }
+          else
+            {
+              failures.add(address, errno);
+              nextStart = now;
+            }
+          continue;
+        }
+
+      // Give up on the attempts that have run out of time.
+      auto expired = std::stable_partition
+        (pending.begin(), pending.end(), [now](const Attempt& attempt)
+         { return now < attempt.deadline; });
+      for (auto attempt = expired; attempt != pending.end(); ++attempt)
+        {
+          failures.add(*attempt->address, ETIMEDOUT);
+        }
+      if (pending.end() != expired)
+        {
+          pending.erase(expired, pending.end());
+          nextStart = now;
+        }
+
+      if (pending.empty())
+        {
+          if (order.cend() == next)
+            {
+              failures.raise();
+            }
+          continue;
+        }
+
+      // Sleep until an attempt completes, the nearest deadline passes, or
+      // it is time to start the next attempt.
+      Clock::time_point wake = pending.front().deadline;
+      for (const Attempt& attempt : pending)
+        {
+          wake = std::min(wake, attempt.deadline);
+        }
+      if (order.cend() != next)
+        {
+          wake = std::min(wake, nextStart);
+        }
+      const auto timeout = std::chrono::ceil<std::chrono::milliseconds>
+        (wake - now);
+
+      events.clear();
+      for (const Attempt& attempt : pending)
+        {
+          events.push_back(pollfd{attempt.socket.get(), POLLOUT, 0});
+        }
+      errno = 0;
+      const int ready = ::poll(events.data(), events.size(),
+                               std::max(0, static_cast<int>(timeout.count())));
+      if (-1 == ready && EINTR != errno)
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+      if (0 >= ready)
+        {
+          continue;
+        }
+
+      // Collect the results of the attempts that have completed; the first
+      // to have succeeded wins.
+      std::vector<Attempt> running;
+      for (std::size_t i = 0; i < pending.size(); ++i)
+        {
+          if (0 == events[i].revents)
+            {
+              running.push_back(std::move(pending[i]));
+              continue;
+            }
+
+          int error = 0;
+          socklen_t length = sizeof(error);
+          if (-1 == ::getsockopt(pending[i].socket.get(), SOL_SOCKET,
+                                 SO_ERROR, &error, &length))
+            {
+              error = errno;
+            }
+          if (0 == error && setBlocking(pending[i].socket.get(), true))
+            {
+              return std::move(pending[i].socket);
+            }
+
+          failures.add(*pending[i].address, 0 == error ? errno : error);
+          nextStart = Clock::now();
+        }
+      pending.swap(running);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,56 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            KernelTLS.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the kernel TLS helpers.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TCP/KernelTLS.h>
+
+#include <stdexcept>
+
+#include <openssl/bio.h>
+#include <openssl/ssl.h>
+
+void Networking::TCP::configureKernelTLS(SSL_CTX* context, KernelTLSMode mode)
+{
+  if (KTLS_DISABLED == mode)
+    {
+      return;
+    }
+
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+  SSL_CTX_set_options(context, SSL_OP_ENABLE_KTLS);
+#else
+  (void)context;
+  if (KTLS_REQUIRED == mode)
+    {
+      throw std::runtime_error{"Kernel TLS is required, but this build of"
+          " OpenSSL (" OPENSSL_VERSION_TEXT ") does not support it"};
+    }
+#endif
+}
+
+std::string Networking::TCP::checkKernelTLS(SSL* ssl)
+{
+  const bool isSendOffloaded = 0 != BIO_get_ktls_send(SSL_get_wbio(ssl));
+  const bool isReceiveOffloaded = 0 != BIO_get_ktls_recv(SSL_get_rbio(ssl));
+  if (isSendOffloaded && isReceiveOffloaded)
+    {
+      return "";
+    }
+
+  const std::string directions = !isSendOffloaded && !isReceiveOffloaded
+    ? "writes or reads" : (isSendOffloaded ? "reads" : "writes");
+  return "Kernel TLS does not handle " + directions + " for "
+    + SSL_get_version(ssl) + " with " + SSL_get_cipher_name(ssl)
+    + " (is the kernel's tls module loaded, and does it support this"
+    " cipher?)";
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,500 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            Stream.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the buffered connection stream.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TCP/Stream.h>
+#include <Networking/TCP/TLSException.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+
+namespace
+{
+  // The most that one TLS record holds.
+  constexpr std::size_t RECORD_SIZE = 16384;
+  // The most vectors passed to the kernel at once (one of which may be the
+  // stream's own buffer).
+  constexpr int MAX_VECTORS = 64;
+
+  // A blocking socket only fails with EAGAIN once its SO_RCVTIMEO or
+  // SO_SNDTIMEO (see ConnectionTimeouts) has passed.
+  void checkTimeout(int fd)
+  {
+    const int flags = ::fcntl(fd, F_GETFL);
+    if (-1 != flags && 0 == (flags & O_NONBLOCK))
+      {
+        throw std::system_error{ETIMEDOUT, std::generic_category()};
+      }
+  }
+
+  void waitFor(int fd, short events)
+  {
+    checkTimeout(fd);
+    struct pollfd ready = {fd, events, 0};
+    while (-1 == ::poll(&ready, 1, -1))
+      {
+        if (EINTR != errno)
+          {
+            throw std::system_error{errno, std::generic_category()};
+          }
+      }
+  }
+
+  // Copies what it can of data into the vector, starting at the position
+  // given by (index, offset), which it advances. Returns the number of
+  // bytes copied.
+  std::size_t scatter(const char* data, std::size_t length,
+                      const struct iovec* vector, int count, int& index,
+                      std::size_t& offset)
+  {
+    std::size_t copied = 0;
+    while (copied < length && index < count)
+      {
+        const std::size_t room = vector[index].iov_len - offset;
+        const std::size_t chunk = std::min(room, length - copied);
+        std::memcpy(static_cast<char*>(vector[index].iov_base) + offset,
+                    data + copied, chunk);
+        copied += chunk;
+        offset += chunk;
+        if (offset == vector[index].iov_len)
+          {
+            ++index;
+            offset = 0;
+          }
+      }
+    return copied;
+  }
+};
+
+void Networking::TCP::Stream::ReturnBlock::operator()(char* block)
+  const noexcept
+{
+  RequestPool::deallocate(block);
+}
+
+Networking::TCP::Stream::Stream(int socket,
+                                std::shared_ptr<RequestPool> bufferPool)
+  : m_bufferPool{std::move(bufferPool)}, m_socket{socket}, m_ssl{nullptr},
+    m_readBuffer{}, m_readStart{0}, m_readEnd{0}, m_writeBuffer{},
+    m_writeLength{0}, m_corked{false}, m_atEnd{false}
+{}
+
+Networking::TCP::Stream::Stream(SSL* ssl,
+                                std::shared_ptr<RequestPool> bufferPool)
+  : m_bufferPool{std::move(bufferPool)}, m_socket{SSL_get_fd(ssl)},
+    m_ssl{ssl}, m_readBuffer{}, m_readStart{0}, m_readEnd{0},
+    m_writeBuffer{}, m_writeLength{0}, m_corked{false}, m_atEnd{false}
+{}
+
+Networking::TCP::Stream::Stream(Stream&& other) noexcept
+  : m_bufferPool{std::move(other.m_bufferPool)}, m_socket{other.m_socket},
+    m_ssl{other.m_ssl}, m_readBuffer{std::move(other.m_readBuffer)},
+    m_readStart{std::exchange(other.m_readStart, 0)},
+    m_readEnd{std::exchange(other.m_readEnd, 0)},
+    m_writeBuffer{std::move(other.m_writeBuffer)},
+    m_writeLength{std::exchange(other.m_writeLength, 0)},
+    m_corked{std::exchange(other.m_corked, false)}, m_atEnd{other.m_atEnd}
+{}
+
+Networking::TCP::Stream::~Stream()
+{
+  try
+    {
+      setCork(false);
+      flush();
+    }
+  catch (...)
+    {}
+}
+
+std::shared_ptr<Networking::RequestPool>
+Networking::TCP::Stream::getDefaultBufferPool()
+{
+  static const std::shared_ptr<RequestPool> pool
+    = RequestPool::create(RECORD_SIZE);
+  return pool;
+}
+
+std::size_t Networking::TCP::Stream::read(void* data, std::size_t length)
+{
+  if (0 == length)
+    {
+      return 0;
+    }
+
+  if (m_readStart == m_readEnd)
+    {
+      // Nothing would be gained by going through the buffer.
+      if (length >= getBufferSize())
+        {
+          return receive(data, length);
+        }
+      m_readStart = 0;
+      m_readEnd = receive(getReadBuffer(), getBufferSize());
+    }
+
+  const std::size_t copied = std::min(length, m_readEnd - m_readStart);
+  std::memcpy(data, m_readBuffer.get() + m_readStart, copied);
+  m_readStart += copied;
+  return copied;
+}
+
+std::size_t Networking::TCP::Stream::readv(const struct iovec* vector,
+                                           int count)
+{
+  int index = 0;
+  std::size_t offset = 0;
+  if (m_readStart == m_readEnd)
+    {
+      if (nullptr != m_ssl)
+        {
+          m_readStart = 0;
+          m_readEnd = receive(getReadBuffer(), getBufferSize());
+        }
+      else
+        {
+          // Read into the caller's vectors, and ahead into the buffer.
+          struct iovec gathered[MAX_VECTORS];
+          const int used = std::min(count, MAX_VECTORS - 1);
+          std::size_t capacity = 0;
+          for (int i = 0; i < used; ++i)
+            {
+              gathered[i] = vector[i];
+              capacity += vector[i].iov_len;
+            }
+          gathered[used] = {getReadBuffer(), getBufferSize()};
+
+          const std::size_t received = receive(gathered, used + 1);
+          m_readStart = 0;
+          m_readEnd = received > capacity ? received - capacity : 0;
+          return std::min(received, capacity);
+        }
+    }
+
+  const std::size_t copied = scatter
+    (m_readBuffer.get() + m_readStart, m_readEnd - m_readStart, vector,
+     count, index, offset);
+  m_readStart += copied;
+  return copied;
+}
+
+bool Networking::TCP::Stream::atEnd() const
+{
+  return m_atEnd && m_readStart == m_readEnd;
+}
+
+void Networking::TCP::Stream::write(const void* data, std::size_t length)
+{
+  const struct iovec vector = {const_cast<void*>(data), length};
+  writev(&vector, 1);
+}
+
+void Networking::TCP::Stream::writev(const struct iovec* vector, int count)
+{
+  std::size_t total = 0;
+  for (int i = 0; i < count; ++i)
+    {
+      total += vector[i].iov_len;
+    }
+
+  const std::size_t size = getBufferSize();
+  if (nullptr == m_ssl && m_writeLength + total > size)
+    {
+      // Send the buffer and the caller's data in the same call.
+      struct iovec gathered[MAX_VECTORS];
+      int used = 0;
+      if (0 < m_writeLength)
+        {
+          gathered[used++] = {getWriteBuffer(), m_writeLength};
+          m_writeLength = 0;
+        }
+      for (int i = 0; i < count; ++i)
+        {
+          if (MAX_VECTORS == used)
+            {
+              send(gathered, used);
+              used = 0;
+            }
+          gathered[used++] = vector[i];
+        }
+      send(gathered, used);
+      return;
+    }
+
+  // Fill the buffer, sending it as it fills, so that a TLS connection sends
+  // records that are as large as they can be.
+  char* buffer = getWriteBuffer();
+  for (int i = 0; i < count; ++i)
+    {
+      const char* data = static_cast<const char*>(vector[i].iov_base);
+      std::size_t copied = 0;
+      while (copied < vector[i].iov_len)
+        {
+          if (size == m_writeLength)
+            {
+              m_writeLength = 0;
+              send(buffer, size);
+            }
+          const std::size_t chunk = std::min(size - m_writeLength,
+                                             vector[i].iov_len - copied);
+          std::memcpy(buffer + m_writeLength, data + copied, chunk);
+          m_writeLength += chunk;
+          copied += chunk;
+        }
+    }
+}
+
+void Networking::TCP::Stream::flush()
+{
+  if (0 < m_writeLength)
+    {
+      send(m_writeBuffer.get(), std::exchange(m_writeLength, 0));
+    }
+}
+
+void Networking::TCP::Stream::setCork(bool corked)
+{
+  if (corked == m_corked)
+    {
+      return;
+    }
+  else if (!corked)
+    {
+      flush();
+    }
+
+  const int value = corked ? 1 : 0;
+  if (-1 == ::setsockopt(m_socket, IPPROTO_TCP, TCP_CORK, &value,
+                         sizeof(value)))
+    {
+      throw std::system_error{errno, std::generic_category()};
+    }
+  m_corked = corked;
+}
+
+bool Networking::TCP::Stream::isCorked() const
+{
+  return m_corked;
+}
+
+int Networking::TCP::Stream::getDescriptor() const
+{
+  return m_socket;
+}
+
+SSL* Networking::TCP::Stream::getSSL() const
+{
+  return m_ssl;
+}
+
+std::size_t Networking::TCP::Stream::getBufferSize() const
+{
+  return m_bufferPool->getBlockSize();
+}
+
+char* Networking::TCP::Stream::getReadBuffer()
+{
+  if (!m_readBuffer)
+    {
+      m_readBuffer.reset(static_cast<char*>
+                         (m_bufferPool->allocate(getBufferSize())));
+    }
+  return m_readBuffer.get();
+}
+
+char* Networking::TCP::Stream::getWriteBuffer()
+{
+  if (!m_writeBuffer)
+    {
+      m_writeBuffer.reset(static_cast<char*>
+                          (m_bufferPool->allocate(getBufferSize())));
+    }
+  return m_writeBuffer.get();
+}
+
+std::size_t Networking::TCP::Stream::receive(void* data, std::size_t length)
+{
+  if (nullptr == m_ssl)
+    {
+      const struct iovec vector = {data, length};
+      return receive(&vector, 1);
+    }
+
+  for (;;)
+    {
+      ERR_clear_error();
+      errno = 0;
+      const int result = SSL_read(m_ssl, data, static_cast<int>
+                                  (std::min<std::size_t>(length, INT_MAX)));
+      if (0 < result)
+        {
+          return result;
+        }
+
+      switch (SSL_get_error(m_ssl, result))
+        {
+        case SSL_ERROR_ZERO_RETURN:
+          m_atEnd = true;
+          return 0;
+        case SSL_ERROR_WANT_READ:
+          checkTimeout(m_socket);
+          return 0;
+        case SSL_ERROR_WANT_WRITE:
+          waitFor(m_socket, POLLOUT);
+          break;
+        case SSL_ERROR_SYSCALL:
+          if (0 == ERR_peek_error())
+            {
+              if (0 == errno)
+                {
+                  // The peer closed the connection without a close_notify.
+                  m_atEnd = true;
+                  return 0;
+                }
+              throw std::system_error{errno, std::generic_category()};
+            }
+          [[fallthrough]];
+        default:
+          throw std::runtime_error{"Stream: could not read from the TLS"
+              " connection; error trace:\n" + getSSLErrors()};
+        }
+    }
+}
+
+std::size_t Networking::TCP::Stream::receive(const struct iovec* vector,
+                                             int count)
+{
+  for (;;)
+    {
+      const ssize_t result = ::readv(m_socket, vector, count);
+      if (0 < result)
+        {
+          return result;
+        }
+      else if (0 == result)
+        {
+          m_atEnd = true;
+          return 0;
+        }
+      else if (EAGAIN == errno || EWOULDBLOCK == errno)
+        {
+          checkTimeout(m_socket);
+          return 0;
+        }
+      else if (EINTR != errno)
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+    }
+}
+
+void Networking::TCP::Stream::send(const struct iovec* vector, int count)
+{
+  struct iovec pending[MAX_VECTORS];
+  std::copy(vector, vector + count, pending);
+  struct msghdr message = {};
+  message.msg_iov = pending;
+  message.msg_iovlen = count;
+
+  while (0 < message.msg_iovlen)
+    {
+      const ssize_t result = ::sendmsg(m_socket, &message, MSG_NOSIGNAL);
+      if (-1 == result)
+        {
+          if (EAGAIN == errno || EWOULDBLOCK == errno)
+            {
+              waitFor(m_socket, POLLOUT);
+            }
+          else if (EINTR != errno)
+            {
+              throw std::system_error{errno, std::generic_category()};
+            }
+          continue;
+        }
+
+      // Skip what was sent.
+      std::size_t sent = result;
+      while (0 < message.msg_iovlen && sent >= message.msg_iov->iov_len)
+        {
+          sent -= message.msg_iov->iov_len;
+          ++message.msg_iov;
+          --message.msg_iovlen;
+        }
+      if (0 < message.msg_iovlen)
+        {
+          message.msg_iov->iov_base =
+            static_cast<char*>(message.msg_iov->iov_base) + sent;
+          message.msg_iov->iov_len -= sent;
+        }
+    }
+}
+
+void Networking::TCP::Stream::send(const char* data, std::size_t length)
+{
+  if (nullptr == m_ssl)
+    {
+      const struct iovec vector = {const_cast<char*>(data), length};
+      send(&vector, 1);
+      return;
+    }
+
+  std::size_t sent = 0;
+  while (sent < length)
+    {
+      ERR_clear_error();
+      errno = 0;
+      // SSL_write must be retried with the same arguments.
+      const int result = SSL_write
+        (m_ssl, data + sent,
+         static_cast<int>(std::min<std::size_t>(length - sent, INT_MAX)));
+      if (0 < result)
+        {
+          sent += result;
+          continue;
+        }
+
+      switch (SSL_get_error(m_ssl, result))
+        {
+        case SSL_ERROR_WANT_WRITE:
+          waitFor(m_socket, POLLOUT);
+          break;
+        case SSL_ERROR_WANT_READ:
+          waitFor(m_socket, POLLIN);
+          break;
+        case SSL_ERROR_SYSCALL:
+          if (0 == ERR_peek_error() && 0 != errno)
+            {
+              throw std::system_error{errno, std::generic_category()};
+            }
+          [[fallthrough]];
+        default:
+          throw std::runtime_error{"Stream: could not write to the TLS"
+              " connection; error trace:\n" + getSSLErrors()};
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,424 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSConnectionPool.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the client-side TLS connection pool.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TCP/TLSConnectionPool.h>
+
+#include <openssl/bio.h>
+#include <openssl/ssl.h>
+
+#include <ctime>
+#include <stdexcept>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+
+std::unique_ptr<Networking::TCP::TLSConnectionPool>
+Networking::TCP::TLSConnectionPool::attach(SSL_CTX* context,
+                                           std::size_t maxIdlePerHost,
+                                           std::chrono::seconds maxIdleTime,
+                                           std::chrono::seconds maxLifetime,
+                                           bool sessionReuse)
+{
+  const int index = contextIndex();
+  if (nullptr != SSL_CTX_get_ex_data(context, index))
+    {
+      throw std::logic_error{"TLSConnectionPool: the context already has a"
+          " connection pool"};
+    }
+
+  std::unique_ptr<TLSConnectionPool> pool{new TLSConnectionPool{
+      context, maxIdlePerHost, maxIdleTime, maxLifetime, sessionReuse}};
+  if (0 == SSL_CTX_set_ex_data(context, index, pool.get()))
+    {
+      throw std::runtime_error{"TLSConnectionPool: could not attach the pool"
+          " to the context"};
+    }
+
+  if (sessionReuse)
+    {
+      // The pool keeps the sessions itself, one per host, rather than in
+      // OpenSSL's cache, which is keyed by session ID.
+      SSL_CTX_set_session_cache_mode(context, SSL_SESS_CACHE_CLIENT
+                                     | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+      SSL_CTX_sess_set_new_cb(context, newSession);
+    }
+  else
+    {
+      SSL_CTX_set_session_cache_mode(context, SSL_SESS_CACHE_OFF);
+    }
+  return pool;
+}
+
+Networking::TCP::TLSConnectionPool
+::TLSConnectionPool(SSL_CTX* context, std::size_t maxIdlePerHost,
+                    std::chrono::seconds maxIdleTime,
+                    std::chrono::seconds maxLifetime, bool sessionReuse)
+  : m_context{context}, m_maxIdlePerHost{maxIdlePerHost},
+    m_maxIdleTime{maxIdleTime}, m_maxLifetime{maxLifetime},
+    m_sessionReuse{sessionReuse}, m_idle{0},
+    m_fullHandshakes{0}, m_resumedHandshakes{0}, m_reused{0}, m_expired{0},
+    m_unhealthy{0}
+{}
+
+Networking::TCP::TLSConnectionPool::~TLSConnectionPool()
+{
+  // A connection still open (e.g. an AsyncStream) may yet be sent a
+  // session ticket, and newSession() must then find no pool.
+  SSL_CTX_set_ex_data(m_context, contextIndex(), nullptr);
+  clear();
+}
+
+BIO* Networking::TCP::TLSConnectionPool::checkout(const std::string& host)
+{
+  const auto now = std::chrono::steady_clock::now();
+  std::vector<BIO*> released;
+  BIO* bio = nullptr;
+
+  while (nullptr == bio)
+    {
+      BIO* candidate = nullptr;
+      {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto found = m_hosts.find(host);
+        if (m_hosts.end() == found)
+          {
+            break;
+          }
+
+        std::deque<Idle>& idle = found->second.idle;
+        while (!idle.empty() && now - idle.front().since >= m_maxIdleTime)
+          {
+            released.push_back(idle.front().bio);
+            idle.pop_front();
+            --m_idle;
+            ++m_expired;
+          }
+        if (idle.empty())
+          {
+            break;
+          }
+
+        // The most recently used connection is the likeliest to be alive.
+        candidate = idle.back().bio;
+        idle.pop_back();
+        --m_idle;
+      }
+
+      // The health check may read from the socket, so it is done outside of
+      // the lock.
+      SSL* ssl = nullptr;
+      BIO_get_ssl(candidate, &ssl);
+      if (isExpired(ssl, now))
+        {
+          released.push_back(candidate);
+          ++m_expired;
+        }
+      else if (!isHealthy(ssl))
+        {
+          released.push_back(candidate);
+          ++m_unhealthy;
+        }
+      else
+        {
+          bio = candidate;
+          ++m_reused;
+        }
+    }
+
+  for (BIO* stale : released)
+    {
+      BIO_free_all(stale);
+    }
+  return bio;
+}
+
+void Networking::TCP::TLSConnectionPool::prepare(SSL* ssl,
+                                                 const std::string& host)
+{
+  SSL_SESSION* session = nullptr;
+  SSL_SESSION* expired = nullptr;
+  Host* entry = nullptr;
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    entry = &m_hosts[host];
+    if (m_sessionReuse && nullptr != entry->session)
+      {
+        const long age = static_cast<long>(std::time(nullptr))
+          - SSL_SESSION_get_time(entry->session);
+        if (age >= SSL_SESSION_get_timeout(entry->session))
+          {
+            expired = entry->session;
+            entry->session = nullptr;
+          }
+        else if (TLS1_3_VERSION
+                 == SSL_SESSION_get_protocol_version(entry->session))
+          {
+            // TLS 1.3 tickets are meant to be used only once (RFC 8446
+            // C.4); the server sends a fresh one on every connection.
+            session = entry->session;
+            entry->session = nullptr;
+          }
+        else
+          {
+            session = entry->session;
+            SSL_SESSION_up_ref(session);
+          }
+      }
+  }
+
+  if (nullptr != expired)
+    {
+      SSL_SESSION_free(expired);
+    }
+
+  std::unique_ptr<Tag> tag{new Tag{entry, std::chrono::steady_clock::now()}};
+  if (0 == SSL_set_ex_data(ssl, connectionIndex(), tag.get()))
+    {
+      SSL_SESSION_free(session);
+      throw std::runtime_error{"TLSConnectionPool: could not tag the"
+          " connection"};
+    }
+  // The connection frees the tag from now on (see connectionIndex()).
+  tag.release();
+
+  if (nullptr != session)
+    {
+      // Takes a reference of its own.
+      SSL_set_session(ssl, session);
+      SSL_SESSION_free(session);
+    }
+}
+
+void Networking::TCP::TLSConnectionPool::connected(SSL* ssl)
+{
+  if (SSL_session_reused(ssl))
+    {
+      ++m_resumedHandshakes;
+    }
+  else
+    {
+      ++m_fullHandshakes;
+    }
+}
+
+void Networking::TCP::TLSConnectionPool::checkin(BIO* bio)
+{
+  if (nullptr == bio)
+    {
+      return;
+    }
+
+  SSL* ssl = nullptr;
+  BIO_get_ssl(bio, &ssl);
+  Tag* tag = nullptr == ssl ? nullptr : getTag(ssl);
+  const auto now = std::chrono::steady_clock::now();
+
+  BIO* released = bio;
+  if (nullptr == tag || 0 == m_maxIdlePerHost)
+    {
+      // Not ours to keep.
+    }
+  else if (0 != SSL_get_shutdown(ssl))
+    {
+      ++m_unhealthy;
+    }
+  else if (isExpired(ssl, now))
+    {
+      ++m_expired;
+    }
+  else
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      std::deque<Idle>& idle = tag->host->idle;
+      idle.push_back(Idle{bio, now});
+      ++m_idle;
+      released = nullptr;
+      if (idle.size() > m_maxIdlePerHost)
+        {
+          released = idle.front().bio;
+          idle.pop_front();
+          --m_idle;
+        }
+    }
+
+  if (nullptr != released)
+    {
+      BIO_free_all(released);
+    }
+}
+
+void Networking::TCP::TLSConnectionPool::clear()
+{
+  std::vector<BIO*> connections;
+  std::vector<SSL_SESSION*> sessions;
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    // Connections still checked out point into the map, so the hosts stay.
+    for (auto& host : m_hosts)
+      {
+        for (Idle& idle : host.second.idle)
+          {
+            connections.push_back(idle.bio);
+          }
+        host.second.idle.clear();
+        if (nullptr != host.second.session)
+          {
+            sessions.push_back(host.second.session);
+            host.second.session = nullptr;
+          }
+      }
+    m_idle = 0;
+  }
+
+  for (BIO* bio : connections)
+    {
+      BIO_free_all(bio);
+    }
+  for (SSL_SESSION* session : sessions)
+    {
+      SSL_SESSION_free(session);
+    }
+}
+
+Networking::TCP::TLSConnectionPool::Statistics
+Networking::TCP::TLSConnectionPool::getStatistics() const
+{
+  std::size_t idle = 0;
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    idle = m_idle;
+  }
+  return Statistics{m_fullHandshakes.load(), m_resumedHandshakes.load(),
+      m_reused.load(), m_expired.load(), m_unhealthy.load(), idle};
+}
+
+// An idle connection is healthy if the peer has sent nothing on it but
+// handshake messages (such as TLS 1.3 session tickets), and has not closed
+// it.
+bool Networking::TCP::TLSConnectionPool::isHealthy(SSL* ssl) const
+{
+  if (0 != SSL_get_shutdown(ssl))
+    {
+      return false;
+    }
+
+  const int fd = SSL_get_fd(ssl);
+  if (-1 == fd)
+    {
+      return false;
+    }
+
+  struct pollfd pending{fd, POLLIN, 0};
+  const int ready = ::poll(&pending, 1, 0);
+  if (0 == ready)
+    {
+      return true;
+    }
+  else if (-1 == ready || 0 != (pending.revents & (POLLERR | POLLNVAL)))
+    {
+      return false;
+    }
+
+  // Let OpenSSL look at what arrived, without blocking on a partial record.
+  const int flags = ::fcntl(fd, F_GETFL);
+  if (-1 == flags || -1 == ::fcntl(fd, F_SETFL, flags | O_NONBLOCK))
+    {
+      return false;
+    }
+  char byte = 0;
+  const int result = SSL_peek(ssl, &byte, 1);
+  const int error = SSL_get_error(ssl, result);
+  ::fcntl(fd, F_SETFL, flags);
+
+  // Application data that nobody asked for means the connection is out of
+  // step with the peer's protocol, so it cannot be handed out either.
+  return 0 >= result && SSL_ERROR_WANT_READ == error;
+}
+
+bool Networking::TCP::TLSConnectionPool
+::isExpired(SSL* ssl, std::chrono::steady_clock::time_point now) const
+{
+  Tag* tag = getTag(ssl);
+  return nullptr == tag || now - tag->created >= m_maxLifetime;
+}
+
+// The ex_data slot through which the pool is found from its context.
+int Networking::TCP::TLSConnectionPool::contextIndex()
+{
+  static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr,
+                                                    nullptr, nullptr);
+  if (0 > index)
+    {
+      throw std::runtime_error{"TLSConnectionPool: could not allocate an"
+          " ex_data index"};
+    }
+  return index;
+}
+
+// The ex_data slot through which a connection owns its Tag.
+int Networking::TCP::TLSConnectionPool::connectionIndex()
+{
+  static const int index = SSL_get_ex_new_index
+    (0, nullptr, nullptr, nullptr,
+     [](void*, void* tag, CRYPTO_EX_DATA*, int, long, void*)
+     {
+       delete static_cast<Tag*>(tag);
+     });
+  if (0 > index)
+    {
+      throw std::runtime_error{"TLSConnectionPool: could not allocate an"
+          " ex_data index"};
+    }
+  return index;
+}
+
+Networking::TCP::TLSConnectionPool*
+Networking::TCP::TLSConnectionPool::fromContext(SSL_CTX* context)
+{
+  return static_cast<TLSConnectionPool*>
+    (SSL_CTX_get_ex_data(context, contextIndex()));
+}
+
+Networking::TCP::TLSConnectionPool::Tag*
+Networking::TCP::TLSConnectionPool::getTag(SSL* ssl)
+{
+  return static_cast<Tag*>(SSL_get_ex_data(ssl, connectionIndex()));
+}
+
+int Networking::TCP::TLSConnectionPool::newSession(SSL* ssl,
+                                                   SSL_SESSION* session)
+{
+  TLSConnectionPool* pool = fromContext(SSL_get_SSL_CTX(ssl));
+  Tag* tag = getTag(ssl);
+  if (nullptr == pool || nullptr == tag
+      || !SSL_SESSION_is_resumable(session))
+    {
+      return 0;
+    }
+
+  SSL_SESSION* replaced = nullptr;
+  {
+    std::lock_guard<std::mutex> lock{pool->m_mutex};
+    replaced = tag->host->session;
+    tag->host->session = session;
+  }
+
+  if (nullptr != replaced)
+    {
+      SSL_SESSION_free(replaced);
+    }
+  // The pool took the reference.
+  return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSHandshake.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the non-blocking TLS handshake.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TCP/TLSHandshake.h>
+#include <Networking/EventLoop.h>
+#include <Networking/TCP/TLSException.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <poll.h>
+
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+
+Networking::TCP::TLSHandshake
+::TLSHandshake(SSL* ssl, std::chrono::steady_clock::time_point deadline)
+  : m_ssl{ssl}, m_deadline{deadline}, m_status{WANT_READ}, m_errors{}
+{}
+
+Networking::TCP::TLSHandshake::Status Networking::TCP::TLSHandshake::step()
+{
+  if (isOver())
+    {
+      return m_status;
+    }
+  else if (std::chrono::steady_clock::now() >= m_deadline)
+    {
+      expire();
+      return m_status;
+    }
+
+  ERR_clear_error();
+  errno = 0;
+  const int result = SSL_do_handshake(m_ssl);
+  if (1 == result)
+    {
+      m_status = COMPLETE;
+      return m_status;
+    }
+
+  switch (SSL_get_error(m_ssl, result))
+    {
+    case SSL_ERROR_WANT_READ:
+      m_status = WANT_READ;
+      break;
+    case SSL_ERROR_WANT_WRITE:
+      m_status = WANT_WRITE;
+      break;
+    case SSL_ERROR_SYSCALL:
+      m_status = FAILED;
+      m_errors = 0 != ERR_peek_error() ? getSSLErrors()
+        : (0 != errno ? std::string{strerror(errno)} + "\n"
+           : "Connection closed during the handshake\n");
+      break;
+    default:
+      m_status = FAILED;
+      m_errors = getSSLErrors();
+      break;
+    }
+  return m_status;
+}
+
+Networking::TCP::TLSHandshake::Status Networking::TCP::TLSHandshake::run()
+{
+  for (step(); !isOver(); step())
+    {
+      const auto timeout = std::chrono::ceil<std::chrono::milliseconds>
+        (m_deadline - std::chrono::steady_clock::now());
+      struct pollfd ready = {SSL_get_fd(m_ssl),
+                             static_cast<short>(WANT_WRITE == m_status
+                                                ? POLLOUT : POLLIN), 0};
+      if (-1 == ::poll(&ready, 1,
+                       std::max(0, static_cast<int>(timeout.count())))
+          && EINTR != errno)
+        {
+          m_status = FAILED;
+          m_errors = std::string{strerror(errno)} + "\n";
+        }
+    }
+  return m_status;
+}
+
+void Networking::TCP::TLSHandshake::expire()
+{
+  if (!isOver())
+    {
+      m_status = TIMED_OUT;
+      m_errors = "The handshake did not complete in time\n";
+    }
+}
+
+Networking::TCP::TLSHandshake::Status
+Networking::TCP::TLSHandshake::getStatus() const
+{
+  return m_status;
+}
+
+bool Networking::TCP::TLSHandshake::isOver() const
+{
+  return WANT_READ != m_status && WANT_WRITE != m_status;
+}
+
+unsigned int Networking::TCP::TLSHandshake::getEvents() const
+{
+  return WANT_WRITE == m_status ? EventLoop::WRITABLE : EventLoop::READABLE;
+}
+
+std::chrono::steady_clock::time_point
+Networking::TCP::TLSHandshake::getDeadline() const
+{
+  return m_deadline;
+}
+
+const std::string& Networking::TCP::TLSHandshake::getErrors() const
+{
+  return m_errors;
+}
+
+///////////////////////////////////////////////////////////////////////////////
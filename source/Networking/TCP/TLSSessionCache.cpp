@@ -0,0 +1,297 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSSessionCache.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the sharded TLS session cache.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TCP/TLSSessionCache.h>
+
+#include <openssl/ssl.h>
+
+#include <functional>
+#include <stdexcept>
+
+// Needed by OpenSSL to resume sessions on a server that verifies its
+// clients; names the application that created a session.
+static const unsigned char SESSION_ID_CONTEXT[] = "Networking";
+
+Networking::TCP::TLSSessionCache&
+Networking::TCP::TLSSessionCache::attach(SSL_CTX* context,
+                                         std::size_t capacity,
+                                         unsigned int numShards)
+{
+  const int index = contextIndex();
+  if (nullptr != SSL_CTX_get_ex_data(context, index))
+    {
+      throw std::logic_error{"TLSSessionCache: the context already has a"
+          " session cache"};
+    }
+
+  std::unique_ptr<TLSSessionCache> cache{new TLSSessionCache{capacity,
+                                                             numShards}};
+  if (0 == SSL_CTX_set_ex_data(context, index, cache.get()))
+    {
+      throw std::runtime_error{"TLSSessionCache: could not attach the cache"
+          " to the context"};
+    }
+
+  // The context frees the cache from now on (see contextIndex()).
+  TLSSessionCache& attached = *cache.release();
+  SSL_CTX_set_session_id_context(context, SESSION_ID_CONTEXT,
+                                 sizeof(SESSION_ID_CONTEXT) - 1);
+  SSL_CTX_set_session_cache_mode(context, SSL_SESS_CACHE_SERVER
+                                 | SSL_SESS_CACHE_NO_INTERNAL);
+  SSL_CTX_sess_set_new_cb(context, newSession);
+  SSL_CTX_sess_set_get_cb(context, getSession);
+  SSL_CTX_sess_set_remove_cb(context, removeSession);
+  return attached;
+}
+
+Networking::TCP::TLSSessionCache
+::TLSSessionCache(std::size_t capacity, unsigned int numShards)
+  : m_shardCapacity{0 == numShards ? capacity
+      : (capacity + numShards - 1) / numShards},
+    m_hits{0}, m_misses{0}, m_evictions{0}
+{
+  numShards = 0 == numShards ? 1 : numShards;
+  for (unsigned int i = 0; i < numShards; ++i)
+    {
+      m_shards.push_back(std::make_unique<Shard>());
+    }
+}
+
+Networking::TCP::TLSSessionCache::~TLSSessionCache()
+{
+  for (auto& shard : m_shards)
+    {
+      for (Entry& entry : shard->entries)
+        {
+          SSL_SESSION_free(entry.session);
+        }
+    }
+}
+
+Networking::TCP::TLSSessionCache::Statistics
+Networking::TCP::TLSSessionCache::getStatistics() const
+{
+  std::size_t size = 0;
+  for (const auto& shard : m_shards)
+    {
+      std::lock_guard<std::mutex> lock{shard->mutex};
+      size += shard->entries.size();
+    }
+  return Statistics{m_hits.load(), m_misses.load(), m_evictions.load(), size};
+}
+
+Networking::TCP::TLSSessionCache::Shard&
+Networking::TCP::TLSSessionCache::getShard(const std::string& id)
+{
+  return *m_shards[std::hash<std::string>{}(id) % m_shards.size()];
+}
+
+// Returns true if the cache took the reference to session.
+bool Networking::TCP::TLSSessionCache::insert(SSL_SESSION* session)
+{
+  if (0 == m_shardCapacity)
+    {
+      return false;
+    }
+
+  unsigned int length = 0;
+  const unsigned char* rawId = SSL_SESSION_get_id(session, &length);
+  std::string id{reinterpret_cast<const char*>(rawId), length};
+  const auto expiry = std::chrono::steady_clock::now()
+    + std::chrono::seconds{SSL_SESSION_get_timeout(session)};
+
+  std::vector<SSL_SESSION*> released;
+  Shard& shard = getShard(id);
+  {
+    std::lock_guard<std::mutex> lock{shard.mutex};
+    auto existing = shard.index.find(id);
+    if (shard.index.end() != existing)
+      {
+        released.push_back(existing->second->session);
+        shard.entries.erase(existing->second);
+        shard.index.erase(existing);
+      }
+
+    shard.entries.push_front(Entry{id, session, expiry});
+    try
+      {
+        shard.index.emplace(std::move(id), shard.entries.begin());
+      }
+    catch (...)
+      {
+        shard.entries.pop_front();
+        throw;
+      }
+
+    while (shard.entries.size() > m_shardCapacity)
+      {
+        Entry& oldest = shard.entries.back();
+        released.push_back(oldest.session);
+        shard.index.erase(oldest.id);
+        shard.entries.pop_back();
+        ++m_evictions;
+      }
+  }
+
+  // Outside of the lock, to keep it short.
+  for (SSL_SESSION* stale : released)
+    {
+      SSL_SESSION_free(stale);
+    }
+  return true;
+}
+
+// Returns a new reference to the session, or nullptr.
+SSL_SESSION* Networking::TCP::TLSSessionCache::find(const std::string& id)
+{
+  SSL_SESSION* expired = nullptr;
+  SSL_SESSION* session = nullptr;
+  Shard& shard = getShard(id);
+  {
+    std::lock_guard<std::mutex> lock{shard.mutex};
+    auto found = shard.index.find(id);
+    if (shard.index.end() != found)
+      {
+        auto entry = found->second;
+        if (std::chrono::steady_clock::now() >= entry->expiry)
+          {
+            expired = entry->session;
+            shard.entries.erase(entry);
+            shard.index.erase(found);
+          }
+        else
+          {
+            shard.entries.splice(shard.entries.begin(), shard.entries,
+                                 entry);
+            session = entry->session;
+            // Taken under the lock, so that an eviction cannot free it
+            // before OpenSSL has it.
+            SSL_SESSION_up_ref(session);
+          }
+      }
+  }
+
+  if (nullptr != expired)
+    {
+      SSL_SESSION_free(expired);
+    }
+  if (nullptr == session)
+    {
+      ++m_misses;
+    }
+  else
+    {
+      ++m_hits;
+    }
+  return session;
+}
+
+void Networking::TCP::TLSSessionCache::erase(SSL_SESSION* session)
+{
+  unsigned int length = 0;
+  const unsigned char* rawId = SSL_SESSION_get_id(session, &length);
+  const std::string id{reinterpret_cast<const char*>(rawId), length};
+
+  SSL_SESSION* removed = nullptr;
+  Shard& shard = getShard(id);
+  {
+    std::lock_guard<std::mutex> lock{shard.mutex};
+    auto found = shard.index.find(id);
+    // The entry may since have been replaced by a newer session.
+    if (shard.index.end() != found && session == found->second->session)
+      {
+        removed = session;
+        shard.entries.erase(found->second);
+        shard.index.erase(found);
+      }
+  }
+
+  if (nullptr != removed)
+    {
+      SSL_SESSION_free(removed);
+    }
+}
+
+// The ex_data slot through which a context owns its cache.
+int Networking::TCP::TLSSessionCache::contextIndex()
+{
+  static const int index = SSL_CTX_get_ex_new_index
+    (0, nullptr, nullptr, nullptr,
+     [](void*, void* cache, CRYPTO_EX_DATA*, int, long, void*)
+     {
+       delete static_cast<TLSSessionCache*>(cache);
+     });
+  if (0 > index)
+    {
+      throw std::runtime_error{"TLSSessionCache: could not allocate an"
+          " ex_data index"};
+    }
+  return index;
+}
+
+Networking::TCP::TLSSessionCache*
+Networking::TCP::TLSSessionCache::fromContext(SSL_CTX* context)
+{
+  return static_cast<TLSSessionCache*>
+    (SSL_CTX_get_ex_data(context, contextIndex()));
+}
+
+int Networking::TCP::TLSSessionCache::newSession(SSL* ssl,
+                                                 SSL_SESSION* session)
+{
+  TLSSessionCache* cache = fromContext(SSL_get_SSL_CTX(ssl));
+  try
+    {
+      return nullptr != cache && cache->insert(session) ? 1 : 0;
+    }
+  catch (const std::exception&)
+    {
+      // Not worth failing the handshake over.
+      return 0;
+    }
+}
+
+SSL_SESSION*
+Networking::TCP::TLSSessionCache::getSession(SSL* ssl,
+                                             const unsigned char* id,
+                                             int length, int* copy)
+{
+  // find() has already taken the reference that OpenSSL will own.
+  *copy = 0;
+  TLSSessionCache* cache = fromContext(SSL_get_SSL_CTX(ssl));
+  if (nullptr == cache || 0 > length)
+    {
+      return nullptr;
+    }
+
+  try
+    {
+      return cache->find(std::string{reinterpret_cast<const char*>(id),
+                                     static_cast<std::size_t>(length)});
+    }
+  catch (const std::exception&)
+    {
+      return nullptr;
+    }
+}
+
+void Networking::TCP::TLSSessionCache::removeSession(SSL_CTX* context,
+                                                     SSL_SESSION* session)
+{
+  TLSSessionCache* cache = fromContext(context);
+  if (nullptr != cache)
+    {
+      cache->erase(session);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,274 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSTicketKeys.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the rotating session ticket keys.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TCP/TLSTicketKeys.h>
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <openssl/ssl.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#  include <openssl/core_names.h>
+#  include <openssl/params.h>
+#else
+#  include <openssl/hmac.h>
+#endif
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+Networking::TCP::TLSTicketKeys&
+Networking::TCP::TLSTicketKeys::attach(SSL_CTX* context,
+                                       std::chrono::seconds rotationInterval)
+{
+  const int index = contextIndex();
+  if (nullptr != SSL_CTX_get_ex_data(context, index))
+    {
+      throw std::logic_error{"TLSTicketKeys: the context already has ticket"
+          " keys"};
+    }
+
+  std::unique_ptr<TLSTicketKeys> keys{new TLSTicketKeys{rotationInterval}};
+  if (0 == SSL_CTX_set_ex_data(context, index, keys.get()))
+    {
+      throw std::runtime_error{"TLSTicketKeys: could not attach the keys to"
+          " the context"};
+    }
+
+  // The context frees the keys from now on (see contextIndex()).
+  TLSTicketKeys& attached = *keys.release();
+  SSL_CTX_clear_options(context, SSL_OP_NO_TICKET);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  SSL_CTX_set_tlsext_ticket_key_evp_cb(context, handleTicket);
+#else
+  SSL_CTX_set_tlsext_ticket_key_cb(context, handleTicket);
+#endif
+  return attached;
+}
+
+Networking::TCP::TLSTicketKeys
+::TLSTicketKeys(std::chrono::seconds rotationInterval)
+  : m_rotationInterval{rotationInterval}, m_hasPrevious{false},
+    m_issued{0}, m_accepted{0}, m_renewed{0}, m_rejected{0}, m_rotations{0}
+{
+  generate(m_current);
+  std::memset(&m_previous, 0, sizeof(m_previous));
+  m_nextRotation = std::chrono::steady_clock::now() + m_rotationInterval;
+  ++m_rotations;
+}
+
+Networking::TCP::TLSTicketKeys::~TLSTicketKeys()
+{
+  OPENSSL_cleanse(&m_current, sizeof(m_current));
+  OPENSSL_cleanse(&m_previous, sizeof(m_previous));
+}
+
+void Networking::TCP::TLSTicketKeys::rotate()
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  rotateLocked(std::chrono::steady_clock::now());
+}
+
+Networking::TCP::TLSTicketKeys::Statistics
+Networking::TCP::TLSTicketKeys::getStatistics() const
+{
+  return Statistics{m_issued.load(), m_accepted.load(), m_renewed.load(),
+      m_rejected.load(), m_rotations.load()};
+}
+
+Networking::TCP::TLSTicketKeys::Key
+Networking::TCP::TLSTicketKeys::getCurrentKey()
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  rotateIfDueLocked();
+  return m_current;
+}
+
+int Networking::TCP::TLSTicketKeys::findKey(const unsigned char* name,
+                                            Key& key)
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  rotateIfDueLocked();
+  if (0 == std::memcmp(name, m_current.name, sizeof(m_current.name)))
+    {
+      key = m_current;
+      return 1;
+    }
+  else if (m_hasPrevious
+           && 0 == std::memcmp(name, m_previous.name,
+                               sizeof(m_previous.name)))
+    {
+      key = m_previous;
+      return 2;
+    }
+  return 0;
+}
+
+// Keys are only rotated when they are used, so the current key may be more
+// than one interval overdue, in which case the previous one has expired.
+void Networking::TCP::TLSTicketKeys::rotateIfDueLocked()
+{
+  const auto now = std::chrono::steady_clock::now();
+  if (now < m_nextRotation)
+    {
+      return;
+    }
+
+  const bool previousExpired = now >= m_nextRotation + m_rotationInterval;
+  rotateLocked(now);
+  if (previousExpired)
+    {
+      OPENSSL_cleanse(&m_previous, sizeof(m_previous));
+      m_hasPrevious = false;
+    }
+}
+
+void Networking::TCP::TLSTicketKeys
+::rotateLocked(std::chrono::steady_clock::time_point now)
+{
+  Key next;
+  generate(next);
+  m_previous = m_current;
+  m_hasPrevious = true;
+  m_current = next;
+  OPENSSL_cleanse(&next, sizeof(next));
+  m_nextRotation = now + m_rotationInterval;
+  ++m_rotations;
+}
+
+void Networking::TCP::TLSTicketKeys::generate(Key& key)
+{
+  if (1 != RAND_bytes(reinterpret_cast<unsigned char*>(&key), sizeof(key)))
+    {
+      throw std::runtime_error{"TLSTicketKeys: could not generate a key"};
+    }
+}
+
+// The ex_data slot through which a context owns its keys.
+int Networking::TCP::TLSTicketKeys::contextIndex()
+{
+  static const int index = SSL_CTX_get_ex_new_index
+    (0, nullptr, nullptr, nullptr,
+     [](void*, void* keys, CRYPTO_EX_DATA*, int, long, void*)
+     {
+       delete static_cast<TLSTicketKeys*>(keys);
+     });
+  if (0 > index)
+    {
+      throw std::runtime_error{"TLSTicketKeys: could not allocate an"
+          " ex_data index"};
+    }
+  return index;
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+int Networking::TCP::TLSTicketKeys
+::handleTicket(SSL* ssl, unsigned char* keyName, unsigned char* iv,
+               EVP_CIPHER_CTX* cipherContext, EVP_MAC_CTX* macContext,
+               int encrypt)
+#else
+int Networking::TCP::TLSTicketKeys
+::handleTicket(SSL* ssl, unsigned char* keyName, unsigned char* iv,
+               EVP_CIPHER_CTX* cipherContext, HMAC_CTX* macContext,
+               int encrypt)
+#endif
+{
+  TLSTicketKeys* keys = static_cast<TLSTicketKeys*>
+    (SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), contextIndex()));
+  if (nullptr == keys)
+    {
+      return -1;
+    }
+
+  // Returns 0 (no ticket, or a full handshake) rather than letting an
+  // exception out into OpenSSL.
+  Key key;
+  int result = 1;
+  try
+    {
+      if (encrypt)
+        {
+          key = keys->getCurrentKey();
+          if (1 != RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())))
+            {
+              return -1;
+            }
+          std::memcpy(keyName, key.name, sizeof(key.name));
+          if (1 != EVP_EncryptInit_ex(cipherContext, EVP_aes_256_cbc(),
+                                      nullptr, key.aesKey, iv))
+            {
+              return -1;
+            }
+        }
+      else
+        {
+          result = keys->findKey(keyName, key);
+          if (0 == result)
+            {
+              ++keys->m_rejected;
+              return 0;
+            }
+          if (1 != EVP_DecryptInit_ex(cipherContext, EVP_aes_256_cbc(),
+                                      nullptr, key.aesKey, iv))
+            {
+              return -1;
+            }
+        }
+    }
+  catch (const std::exception&)
+    {
+      return encrypt ? -1 : 0;
+    }
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  char digest[] = "SHA256";
+  OSSL_PARAM parameters[] =
+    {
+      OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key.hmacKey,
+                                        sizeof(key.hmacKey)),
+      OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest, 0),
+      OSSL_PARAM_construct_end()
+    };
+  const bool macReady = 1 == EVP_MAC_CTX_set_params(macContext, parameters);
+#else
+  const bool macReady = 1 == HMAC_Init_ex(macContext, key.hmacKey,
+                                          sizeof(key.hmacKey), EVP_sha256(),
+                                          nullptr);
+#endif
+  OPENSSL_cleanse(&key, sizeof(key));
+  if (!macReady)
+    {
+      return -1;
+    }
+
+  if (encrypt)
+    {
+      ++keys->m_issued;
+      return 1;
+    }
+  else if (1 == result)
+    {
+      ++keys->m_accepted;
+    }
+  else
+    {
+      // Decrypted with the previous key: ask OpenSSL for a new ticket.
+      ++keys->m_renewed;
+    }
+
+  // TLS 1.3 clients use a ticket once, and OpenSSL only issues another after
+  // a resumed handshake if asked to renew.
+  return TLS1_3_VERSION <= SSL_version(ssl) ? 2 : result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,253 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            ZeroCopy.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the bulk transmission helpers.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TCP/ZeroCopy.h>
+#include <Networking/FileDescriptor.h>
+#include <Networking/TCP/TLSException.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/sendfile.h>
+#include <unistd.h>
+
+#include <openssl/bio.h>
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+
+namespace
+{
+  // The most that one call to splice(2) moves through the pipe: its default
+  // capacity on Linux.
+  constexpr std::size_t PIPE_CAPACITY = 65536;
+  // The most that one TLS record holds.
+  constexpr std::size_t RECORD_SIZE = 16384;
+
+  void waitFor(int fd, short events)
+  {
+    // A blocking socket only fails with EAGAIN once its SO_SNDTIMEO (see
+    // ConnectionTimeouts) has passed.
+    const int flags = ::fcntl(fd, F_GETFL);
+    if (-1 != flags && 0 == (flags & O_NONBLOCK))
+      {
+        throw std::system_error{ETIMEDOUT, std::generic_category()};
+      }
+
+    struct pollfd ready = {fd, events, 0};
+    while (-1 == ::poll(&ready, 1, -1))
+      {
+        if (EINTR != errno)
+          {
+            throw std::system_error{errno, std::generic_category()};
+          }
+      }
+  }
+
+  // A pipe for the calling thread, made on first use. It is replaced if it
+  // is left holding data by an error.
+  struct Pipe
+  {
+    Networking::FileDescriptor readEnd;
+    Networking::FileDescriptor writeEnd;
+  };
+
+  Pipe& getPipe()
+  {
+    thread_local Pipe thePipe;
+    if (!thePipe.readEnd)
+      {
+        int ends[2];
+        if (-1 == ::pipe2(ends, O_CLOEXEC))
+          {
+            throw std::system_error{errno, std::generic_category()};
+          }
+        thePipe.readEnd.reset(ends[0]);
+        thePipe.writeEnd.reset(ends[1]);
+      }
+    return thePipe;
+  }
+};
+
+std::size_t Networking::TCP::sendFile(int socket, int file, off_t offset,
+                                      std::size_t count)
+{
+  std::size_t sent = 0;
+  while (sent < count)
+    {
+      const ssize_t result = ::sendfile(socket, file, &offset, count - sent);
+      if (0 == result)
+        {
+          break; // The end of the file
+        }
+      else if (-1 == result)
+        {
+          if (EAGAIN == errno || EWOULDBLOCK == errno)
+            {
+              waitFor(socket, POLLOUT);
+            }
+          else if (EINTR != errno)
+            {
+              throw std::system_error{errno, std::generic_category()};
+            }
+          continue;
+        }
+      sent += result;
+    }
+  return sent;
+}
+
+std::size_t Networking::TCP::splice(int from, int to, std::size_t count)
+{
+  Pipe& pipe = getPipe();
+  std::size_t moved = 0;
+  try
+    {
+      while (moved < count)
+        {
+          const ssize_t filled = ::splice
+            (from, nullptr, pipe.writeEnd.get(), nullptr,
+             std::min(count - moved, PIPE_CAPACITY),
+             SPLICE_F_MOVE | SPLICE_F_MORE);
+          if (0 == filled)
+            {
+              break; // The end of the stream
+            }
+          else if (-1 == filled)
+            {
+              if (EAGAIN == errno || EWOULDBLOCK == errno)
+                {
+                  break;
+                }
+              else if (EINTR != errno)
+                {
+                  throw std::system_error{errno, std::generic_category()};
+                }
+              continue;
+            }
+
+          // Empty the pipe before filling it again.
+          std::size_t pending = filled;
+          while (0 < pending)
+            {
+              const ssize_t drained = ::splice
+                (pipe.readEnd.get(), nullptr, to, nullptr, pending,
+                 SPLICE_F_MOVE | (moved + pending < count
+                                  ? SPLICE_F_MORE : 0));
+              if (-1 == drained)
+                {
+                  if (EAGAIN == errno || EWOULDBLOCK == errno)
+                    {
+                      waitFor(to, POLLOUT);
+                    }
+                  else if (EINTR != errno)
+                    {
+                      throw std::system_error{errno,
+                          std::generic_category()};
+                    }
+                  continue;
+                }
+              pending -= drained;
+              moved += drained;
+            }
+        }
+    }
+  catch (...)
+    {
+      pipe.readEnd.reset();
+      pipe.writeEnd.reset();
+      throw;
+    }
+  return moved;
+}
+
+bool Networking::TCP::isKernelTLSSend(SSL* ssl)
+{
+  return 0 != BIO_get_ktls_send(SSL_get_wbio(ssl));
+}
+
+std::size_t Networking::TCP::sendFile(SSL* ssl, int file, off_t offset,
+                                      std::size_t count)
+{
+  const bool isKernelTLS = isKernelTLSSend(ssl);
+  char buffer[RECORD_SIZE];
+  std::size_t sent = 0;
+  while (sent < count)
+    {
+      const std::size_t length = isKernelTLS ? count - sent
+        : std::min(count - sent, sizeof(buffer));
+      long result = 0;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(OPENSSL_NO_KTLS)
+      if (isKernelTLS)
+        {
+          result = SSL_sendfile(ssl, file, offset + sent, length, 0);
+          if (0 == result)
+            {
+              break; // The end of the file
+            }
+        }
+      else
+#endif
+        {
+          const ssize_t filled = ::pread(file, buffer, length,
+                                         offset + sent);
+          if (-1 == filled && EINTR == errno)
+            {
+              continue;
+            }
+          else if (-1 == filled)
+            {
+              throw std::system_error{errno, std::generic_category()};
+            }
+          else if (0 == filled)
+            {
+              break; // The end of the file
+            }
+
+          // SSL_write must be retried with the same arguments.
+          while (0 >= (result = SSL_write(ssl, buffer, filled))
+                 && SSL_ERROR_WANT_WRITE
+                 == SSL_get_error(ssl, static_cast<int>(result)))
+            {
+              waitFor(SSL_get_fd(ssl), POLLOUT);
+            }
+        }
+
+      if (0 < result)
+        {
+          sent += result;
+          continue;
+        }
+
+      switch (SSL_get_error(ssl, static_cast<int>(result)))
+        {
+        case SSL_ERROR_WANT_WRITE:
+          waitFor(SSL_get_fd(ssl), POLLOUT);
+          break;
+        case SSL_ERROR_SYSCALL:
+          if (0 == ERR_peek_error() && 0 != errno)
+            {
+              throw std::system_error{errno, std::generic_category()};
+            }
+          [[fallthrough]];
+        default:
+          throw std::runtime_error{"sendFile: could not write to the TLS"
+              " connection; error trace:\n" + getSSLErrors()};
+        }
+    }
+  return sent;
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TimerThread.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the TimerThread.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TimerThread.h>
+
+#include <utility>
+
+Networking::TimerThread
+::TimerThread(std::chrono::milliseconds resolution,
+              std::function<void(const std::string&)> logStream)
+  : m_wheel{resolution, std::move(logStream)}, m_stopping{false},
+    m_thread{&TimerThread::run, this}
+{}
+
+Networking::TimerThread::~TimerThread()
+{
+  {
+    std::lock_guard<std::recursive_mutex> lock{m_mutex};
+    m_stopping = true;
+  }
+  m_wakeup.notify_one();
+  m_thread.join();
+}
+
+void Networking::TimerThread::schedule(TimerWheel::Timer& timer,
+                                       TimerWheel::Clock::time_point deadline)
+{
+  {
+    std::lock_guard<std::recursive_mutex> lock{m_mutex};
+    m_wheel.schedule(timer, deadline);
+  }
+  // It may now have to wake up sooner.
+  m_wakeup.notify_one();
+}
+
+void Networking::TimerThread::cancel(TimerWheel::Timer& timer)
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_wheel.cancel(timer);
+}
+
+void Networking::TimerThread::run()
+{
+  std::unique_lock<std::recursive_mutex> lock{m_mutex};
+  while (!m_stopping)
+    {
+      const TimerWheel::Clock::time_point next = m_wheel.getNextExpiry();
+      if (TimerWheel::Clock::time_point::max() == next)
+        {
+          m_wakeup.wait(lock);
+        }
+      else
+        {
+          m_wakeup.wait_until(lock, next);
+        }
+      m_wheel.advance(TimerWheel::Clock::now());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
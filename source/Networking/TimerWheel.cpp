@@ -0,0 +1,297 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TimerWheel.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Implementation of the hierarchical timing wheel.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/TimerWheel.h>
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+Networking::TimerWheel
+::TimerWheel(std::chrono::milliseconds resolution,
+             std::function<void(const std::string&)> logStream)
+  : m_resolution{std::max(std::chrono::nanoseconds{resolution},
+                          std::chrono::nanoseconds{1})},
+    m_epoch{Clock::now()}, m_logStream{std::move(logStream)}, m_now{0},
+    m_size{0}, m_occupied{}
+{
+  for (Link& head : m_slots)
+    {
+      head.previous = &head;
+      head.next = &head;
+    }
+}
+
+Networking::TimerWheel::~TimerWheel()
+{
+  for (Link& head : m_slots)
+    {
+      while (head.next != &head)
+        {
+          unlink(static_cast<Timer&>(*head.next));
+        }
+    }
+}
+
+void Networking::TimerWheel::schedule(Timer& timer,
+                                      Clock::time_point deadline)
+{
+  if (this == timer.m_wheel)
+    {
+      unlink(timer);
+    }
+  else if (nullptr != timer.m_wheel)
+    {
+      throw std::logic_error{"TimerWheel: the timer is scheduled on another"
+          " wheel"};
+    }
+
+  timer.m_tick = getTick(deadline);
+  timer.m_wheel = this;
+  insert(timer);
+  ++m_size;
+}
+
+void Networking::TimerWheel::cancel(Timer& timer)
+{
+  if (nullptr == timer.m_wheel)
+    {
+      return;
+    }
+  else if (this != timer.m_wheel)
+    {
+      throw std::logic_error{"TimerWheel: the timer is scheduled on another"
+          " wheel"};
+    }
+  unlink(timer);
+}
+
+std::size_t Networking::TimerWheel::advance(Clock::time_point now)
+{
+  if (now < m_epoch)
+    {
+      return 0;
+    }
+
+  const std::uint64_t target = (now - m_epoch) / m_resolution;
+  std::size_t called = 0;
+  while (0 < m_size)
+    {
+      // Skip straight to the next tick with a slot to process.
+      const std::uint64_t tick = getNextTick();
+      if (tick > target)
+        {
+          break;
+        }
+      m_now = tick;
+
+      // Each slot that begins at this tick is spread over the levels below
+      // it, from the top down, so that its timers due now reach the first.
+      for (unsigned int level = LEVELS - 1; 0 < level; --level)
+        {
+          const unsigned int shift = SLOT_BITS * level;
+          if (0 != (tick & ((std::uint64_t{1} << shift) - 1)))
+            {
+              continue;
+            }
+
+          Link head;
+          take(level * SLOTS + ((tick >> shift) & (SLOTS - 1)), head);
+          while (head.next != &head)
+            {
+              Timer& timer = static_cast<Timer&>(*head.next);
+              timer.previous->next = timer.next;
+              timer.next->previous = timer.previous;
+              insert(timer);
+            }
+        }
+
+      // The hand moves on before any timer is called, so that one
+      // scheduled again for now falls due at the next tick, not this one.
+      Link due;
+      take(tick & (SLOTS - 1), due);
+      m_now = tick + 1;
+      while (due.next != &due)
+        {
+          Timer& timer = static_cast<Timer&>(*due.next);
+          unlink(timer);
+          ++called;
+          try
+            {
+              timer.m_callback();
+            }
+          catch (const std::exception& e)
+            {
+              m_logStream(std::string{"TimerWheel: timer callback threw: "}
+                          + e.what());
+            }
+          catch (...)
+            {
+              m_logStream("TimerWheel: timer callback threw an unknown"
+                          " exception");
+            }
+        }
+    }
+
+  m_now = std::max(m_now, target + 1);
+  return called;
+}
+
+Networking::TimerWheel::Clock::time_point
+Networking::TimerWheel::getNextExpiry() const
+{
+  if (0 == m_size)
+    {
+      return Clock::time_point::max();
+    }
+  return m_epoch + std::chrono::duration_cast<Clock::duration>
+    (m_resolution * getNextTick());
+}
+
+std::size_t Networking::TimerWheel::size() const
+{
+  return m_size;
+}
+
+// The first tick at or after the deadline, so that no timer fires early.
+std::uint64_t
+Networking::TimerWheel::getTick(Clock::time_point deadline) const
+{
+  if (deadline <= m_epoch)
+    {
+      return 0;
+    }
+  const std::chrono::nanoseconds sinceEpoch = deadline - m_epoch;
+  return (sinceEpoch.count() + m_resolution.count() - 1)
+    / m_resolution.count();
+}
+
+std::uint64_t Networking::TimerWheel::getNextTick() const
+{
+  std::uint64_t next = std::numeric_limits<std::uint64_t>::max();
+  for (unsigned int level = 0; level < LEVELS; ++level)
+    {
+      const std::uint64_t occupied = m_occupied[level];
+      if (0 == occupied)
+        {
+          continue;
+        }
+
+      // A slot is processed at the tick it begins. Those behind the hand
+      // (and its own, once the hand is past the beginning of it) hold
+      // timers for the next time round.
+      const unsigned int shift = SLOT_BITS * level;
+      const std::uint64_t span = m_now >> shift;
+      const unsigned int index = span & (SLOTS - 1);
+      const bool atStart = 0 == (m_now & ((std::uint64_t{1} << shift) - 1));
+      const unsigned int from = atStart ? index : index + 1;
+      const std::uint64_t ahead = SLOTS > from
+        ? occupied & (~std::uint64_t{0} << from) : 0;
+
+      const std::uint64_t round = span - index;
+      const std::uint64_t slot = 0 != ahead ? round + __builtin_ctzll(ahead)
+        : round + SLOTS + __builtin_ctzll(occupied);
+      next = std::min(next, slot << shift);
+    }
+  return next;
+}
+
+void Networking::TimerWheel::insert(Timer& timer)
+{
+  const std::uint64_t tick = std::max(timer.m_tick, m_now);
+  const std::uint64_t delta = tick - m_now;
+  unsigned int level = 0;
+  while (LEVELS - 1 > level
+         && delta >= std::uint64_t{1} << (SLOT_BITS * (level + 1)))
+    {
+      ++level;
+    }
+
+  // Beyond the reach of the wheel: park it as far off as possible, and it
+  // is placed again when that slot comes round.
+  const std::uint64_t reach = std::uint64_t{1} << (SLOT_BITS * LEVELS);
+  const std::uint64_t placed = delta < reach ? tick : m_now + reach - 1;
+  const unsigned int index = (placed >> (SLOT_BITS * level)) & (SLOTS - 1);
+  const unsigned int slot = level * SLOTS + index;
+
+  Link& head = m_slots[slot];
+  timer.previous = head.previous;
+  timer.next = &head;
+  head.previous->next = &timer;
+  head.previous = &timer;
+  timer.m_slot = static_cast<std::uint16_t>(slot);
+  m_occupied[level] |= std::uint64_t{1} << index;
+}
+
+void Networking::TimerWheel::unlink(Timer& timer)
+{
+  timer.previous->next = timer.next;
+  timer.next->previous = timer.previous;
+  if (Timer::DUE != timer.m_slot
+      && m_slots[timer.m_slot].next == &m_slots[timer.m_slot])
+    {
+      m_occupied[timer.m_slot / SLOTS]
+        &= ~(std::uint64_t{1} << (timer.m_slot & (SLOTS - 1)));
+    }
+  timer.m_wheel = nullptr;
+  --m_size;
+}
+
+void Networking::TimerWheel::take(unsigned int slot, Link& head)
+{
+  Link& list = m_slots[slot];
+  if (list.next == &list)
+    {
+      head.previous = &head;
+      head.next = &head;
+      return;
+    }
+
+  head.next = list.next;
+  head.previous = list.previous;
+  head.next->previous = &head;
+  head.previous->next = &head;
+  list.next = &list;
+  list.previous = &list;
+  m_occupied[slot / SLOTS] &= ~(std::uint64_t{1} << (slot & (SLOTS - 1)));
+
+  for (Link* link = head.next; link != &head; link = link->next)
+    {
+      static_cast<Timer*>(link)->m_slot = Timer::DUE;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// TimerWheel::Timer
+////
+
+Networking::TimerWheel::Timer::Timer(std::function<void()> callback)
+  : Link{nullptr, nullptr}, m_callback{std::move(callback)},
+    m_wheel{nullptr}, m_tick{0}, m_slot{DUE}
+{}
+
+Networking::TimerWheel::Timer::~Timer()
+{
+  if (nullptr != m_wheel)
+    {
+      m_wheel->cancel(*this);
+    }
+}
+
+bool Networking::TimerWheel::Timer::isScheduled() const
+{
+  return nullptr != m_wheel;
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1070 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            UringBackend.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     EventLoop backend on io_uring, driven directly through
+//                  the system calls. Listening sockets use multishot accept,
+//                  and connections registered with receive() use multishot
+//                  recv into buffers provided to the kernel (in a buffer
+//                  ring, where supported), so neither needs a system call
+//                  per connection or per read.
+//                  Readiness is watched with multishot poll. Sends queued
+//                  during a round are submitted together when the loop next
+//                  waits, in the same system call.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include <Networking/EventLoopBackend.h>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+
+// Multishot recv is the newest feature required at compile time (Linux 6.0
+// headers). Without it, io_uring is reported as unavailable.
+#ifdef IORING_RECV_MULTISHOT
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+  using Networking::EventLoop;
+
+  // user_data holds the operation in the top byte and the token (which
+  // never uses the top byte) below it. For sends, the outbox replaces the
+  // token, since a send may outlive the registration it was queued on.
+  enum Operation : std::uint64_t
+    {
+      POLL = 1,
+      RECEIVE,
+      ACCEPT,
+      SEND,
+      CANCEL,
+      WAKEUP,
+      PROVIDE
+    };
+  const unsigned int OPERATION_SHIFT = 56;
+  const std::uint64_t TOKEN_MASK = (std::uint64_t{1} << OPERATION_SHIFT) - 1;
+
+  std::uint64_t userData(Operation operation, std::uint64_t token)
+  {
+    return (static_cast<std::uint64_t>(operation) << OPERATION_SHIFT) | token;
+  }
+
+  // Provided buffer ring used by multishot recv. Must be a power of two.
+  const unsigned int BUFFER_COUNT = 256;
+  const unsigned int BUFFER_SIZE = 4096;
+  const unsigned short BUFFER_GROUP = 0;
+
+  std::uint32_t toPollEvents(unsigned int events)
+  {
+    std::uint32_t pollEvents = POLLRDHUP | POLLERR | POLLHUP;
+    if (events & EventLoop::READABLE)
+      {
+        pollEvents |= POLLIN;
+      }
+    if (events & EventLoop::WRITABLE)
+      {
+        pollEvents |= POLLOUT;
+      }
+    return pollEvents;
+  }
+
+  unsigned int fromPollEvents(std::uint32_t pollEvents)
+  {
+    unsigned int events = 0;
+    if (pollEvents & POLLIN)
+      {
+        events |= EventLoop::READABLE;
+      }
+    if (pollEvents & POLLOUT)
+      {
+        events |= EventLoop::WRITABLE;
+      }
+    if (pollEvents & (POLLRDHUP | POLLHUP))
+      {
+        events |= EventLoop::HANGUP;
+      }
+    if (pollEvents & POLLERR)
+      {
+        events |= EventLoop::ERROR;
+      }
+    return events;
+  }
+
+  class UringBackend : public EventLoop::Backend
+  {
+  public:
+    UringBackend(unsigned int entries,
+                 std::function<void(const std::string&)> logStream);
+    virtual ~UringBackend();
+
+    virtual EventLoop::Engine getEngine() const override
+    { return EventLoop::IO_URING; }
+
+    virtual void add(int fd, std::uint64_t token, unsigned int events)
+      override;
+    virtual void modify(int fd, std::uint64_t token, unsigned int events)
+      override;
+    virtual void receive(int fd, std::uint64_t token) override;
+    virtual void accept(int fd, std::uint64_t token) override;
+    virtual void send(int fd, std::uint64_t token, const char* data,
+                      std::size_t length) override;
+    virtual void remove(int fd, std::uint64_t token) override;
+    virtual unsigned int wait(EventLoop& loop, int timeoutMilliseconds)
+      override;
+    virtual void wakeup() override;
+
+  private:
+    enum class Mode { READINESS, RECEIVE, ACCEPT };
+    static const std::size_t NO_OUTBOX = static_cast<std::size_t>(-1);
+
+    struct Watch
+    {
+      std::uint64_t token = 0;  // 0 if not in use
+      Mode mode = Mode::READINESS;
+      unsigned int events = 0;
+      bool armed = false;       // An operation is outstanding
+      std::size_t outbox = NO_OUTBOX;
+    };
+
+    // At most one send per outbox is in flight, so that data reaches the
+    // socket in order. Data queued meanwhile is sent after it.
+    struct Outbox
+    {
+      int fd = -1;
+      bool inUse = false;
+      bool inFlight = false;
+      bool dirty = false;       // In m_dirty
+      bool lingering = false;   // fd is a duplicate, owned by the outbox
+      std::string queued;
+      std::string sending;      // Referred to by the send in flight
+      std::size_t offset = 0;
+    };
+
+    void release();
+    Watch* find(int fd, std::uint64_t token);
+    Watch& watch(int fd, std::uint64_t token, Mode mode);
+    struct io_uring_sqe* prepare(std::uint8_t opcode, int fd,
+                                 std::uint64_t userData);
+    void enter(unsigned int minComplete, int timeoutMilliseconds);
+    unsigned int reap(EventLoop& loop);
+    unsigned int complete(EventLoop& loop, std::uint64_t userData,
+                          std::int32_t result, std::uint32_t flags);
+
+    void armPoll(int fd, const Watch&);
+    void armReceive(int fd, const Watch&);
+    void armAccept(int fd, const Watch&);
+    void armWakeup();
+    bool registerBufferRing();
+    void recycle(unsigned short bufferId);
+
+    std::size_t allocateOutbox(int fd);
+    void releaseOutbox(std::size_t index);
+    void markDirty(std::size_t index);
+    void flushSends();
+    void sent(std::size_t index, std::int32_t result);
+
+    std::function<void(const std::string&)> m_logStream;
+    int m_ring;
+    int m_wakeup;
+
+    void* m_ringMemory;
+    std::size_t m_ringSize;
+    void* m_sqeMemory;
+    std::size_t m_sqeSize;
+    unsigned int* m_sqHead;
+    unsigned int* m_sqTail;
+    unsigned int m_sqMask;
+    unsigned int m_sqEntries;
+    unsigned int m_sqLocalTail;
+    struct io_uring_sqe* m_sqes;
+    unsigned int* m_cqHead;
+    unsigned int* m_cqTail;
+    unsigned int m_cqMask;
+    struct io_uring_cqe* m_cqes;
+
+    struct io_uring_buf_ring* m_bufferRing; // nullptr if not supported
+    std::size_t m_bufferRingSize;
+    std::unique_ptr<char[]> m_buffers;
+    unsigned short m_bufferTail;
+
+    // Cleared if the kernel turns out not to support them (Linux 5.19 has
+    // multishot accept, but multishot recv only arrived in 6.0).
+    bool m_multishotReceive;
+    bool m_multishotAccept;
+
+    std::vector<Watch> m_watches; // by fd
+    std::vector<std::unique_ptr<Outbox>> m_outboxes;
+    std::vector<std::size_t> m_freeOutboxes;
+    std::vector<std::size_t> m_dirty;
+  };
+}
+
+UringBackend
+::UringBackend(unsigned int entries,
+               std::function<void(const std::string&)> logStream)
+  : m_logStream{logStream}, m_ring{-1}, m_wakeup{-1},
+    m_ringMemory{MAP_FAILED}, m_ringSize{0}, m_sqeMemory{MAP_FAILED},
+    m_sqeSize{0}, m_sqLocalTail{0}, m_bufferRing{nullptr},
+    m_bufferRingSize{0}, m_bufferTail{0}, m_multishotReceive{true},
+    m_multishotAccept{true}
+{
+  try
+    {
+      struct io_uring_params params;
+      std::memset(&params, 0, sizeof(params));
+      params.flags = IORING_SETUP_CLAMP | IORING_SETUP_CQSIZE
+        | IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN;
+      // Multishot operations post many completions per submission.
+      params.cq_entries = 4 * entries;
+      m_ring = ::syscall(__NR_io_uring_setup, entries, &params);
+      if (-1 == m_ring && EINVAL == errno)
+        {
+          // SUBMIT_ALL and COOP_TASKRUN are only optimizations.
+          params.flags = IORING_SETUP_CLAMP | IORING_SETUP_CQSIZE;
+          m_ring = ::syscall(__NR_io_uring_setup, entries, &params);
+        }
+      if (-1 == m_ring)
+        {
+          throw std::system_error{errno, std::generic_category(),
+              "io_uring_setup"};
+        }
+
+      const unsigned int required = IORING_FEAT_SINGLE_MMAP
+        | IORING_FEAT_NODROP | IORING_FEAT_FAST_POLL | IORING_FEAT_EXT_ARG;
+      if (required != (params.features & required))
+        {
+          throw std::runtime_error{"io_uring lacks required features"};
+        }
+
+      const std::size_t sqSize = params.sq_off.array
+        + params.sq_entries * sizeof(unsigned int);
+      const std::size_t cqSize = params.cq_off.cqes
+        + params.cq_entries * sizeof(struct io_uring_cqe);
+      m_ringSize = sqSize > cqSize ? sqSize : cqSize;
+      m_ringMemory = ::mmap(nullptr, m_ringSize, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, m_ring,
+                            IORING_OFF_SQ_RING);
+      if (MAP_FAILED == m_ringMemory)
+        {
+          throw std::system_error{errno, std::generic_category(), "mmap"};
+        }
+
+      m_sqeSize = params.sq_entries * sizeof(struct io_uring_sqe);
+      m_sqeMemory = ::mmap(nullptr, m_sqeSize, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, m_ring,
+                           IORING_OFF_SQES);
+      if (MAP_FAILED == m_sqeMemory)
+        {
+          throw std::system_error{errno, std::generic_category(), "mmap"};
+        }
+
+      char* ring = static_cast<char*>(m_ringMemory);
+      m_sqHead = reinterpret_cast<unsigned int*>(ring + params.sq_off.head);
+      m_sqTail = reinterpret_cast<unsigned int*>(ring + params.sq_off.tail);
+      m_sqMask = *reinterpret_cast<unsigned int*>
+        (ring + params.sq_off.ring_mask);
+      m_sqEntries = params.sq_entries;
+      m_sqLocalTail = *m_sqTail;
+      m_sqes = static_cast<struct io_uring_sqe*>(m_sqeMemory);
+      unsigned int* array
+        = reinterpret_cast<unsigned int*>(ring + params.sq_off.array);
+      for (unsigned int i = 0; i < m_sqEntries; ++i)
+        {
+          array[i] = i;
+        }
+
+      m_cqHead = reinterpret_cast<unsigned int*>(ring + params.cq_off.head);
+      m_cqTail = reinterpret_cast<unsigned int*>(ring + params.cq_off.tail);
+      m_cqMask = *reinterpret_cast<unsigned int*>
+        (ring + params.cq_off.ring_mask);
+      m_cqes = reinterpret_cast<struct io_uring_cqe*>
+        (ring + params.cq_off.cqes);
+
+      m_buffers.reset(new char[BUFFER_COUNT * BUFFER_SIZE]);
+      if (!registerBufferRing())
+        {
+          // Provide the buffers the old way: one submission per recycle.
+          struct io_uring_sqe* sqe = prepare(IORING_OP_PROVIDE_BUFFERS,
+                                             BUFFER_COUNT,
+                                             userData(PROVIDE, 0));
+          sqe->addr = reinterpret_cast<std::uint64_t>(m_buffers.get());
+          sqe->len = BUFFER_SIZE;
+          sqe->off = 0;
+          sqe->buf_group = BUFFER_GROUP;
+        }
+
+      m_wakeup = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+      if (-1 == m_wakeup)
+        {
+          throw std::system_error{errno, std::generic_category(), "eventfd"};
+        }
+      armWakeup();
+    }
+  catch (...)
+    {
+      release();
+      throw;
+    }
+}
+
+UringBackend::~UringBackend()
+{
+  // Sends in flight refer to the outboxes, so wait for the kernel to let go
+  // of them. Cancelling everything also returns any connections accepted but
+  // not yet reaped, which must be closed.
+  try
+    {
+      struct io_uring_sqe* sqe = prepare(IORING_OP_ASYNC_CANCEL, -1,
+                                         userData(CANCEL, 0));
+      sqe->cancel_flags = IORING_ASYNC_CANCEL_ANY | IORING_ASYNC_CANCEL_ALL;
+
+      const int MAXIMUM_ROUNDS = 10;
+      for (int i = 0; i < MAXIMUM_ROUNDS; ++i)
+        {
+          enter(1, 10);
+          unsigned int head = *m_cqHead;
+          const unsigned int tail = __atomic_load_n(m_cqTail,
+                                                    __ATOMIC_ACQUIRE);
+          if (head == tail)
+            {
+              break;
+            }
+          for (; head != tail; ++head)
+            {
+              const struct io_uring_cqe& cqe = m_cqes[head & m_cqMask];
+              const std::uint64_t operation
+                = cqe.user_data >> OPERATION_SHIFT;
+              if (ACCEPT == operation && 0 <= cqe.res)
+                {
+                  ::close(cqe.res);
+                }
+              else if (SEND == operation)
+                {
+                  m_outboxes[cqe.user_data & TOKEN_MASK]->inFlight = false;
+                }
+            }
+          __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+        }
+    }
+  catch (const std::exception& e)
+    {
+      m_logStream(std::string{"EventLoop: while closing io_uring: "}
+                  + e.what());
+    }
+
+  for (auto& outbox : m_outboxes)
+    {
+      if (outbox->lingering && 0 <= outbox->fd)
+        {
+          ::close(outbox->fd);
+        }
+    }
+  release();
+}
+
+void UringBackend::add(int fd, std::uint64_t token, unsigned int events)
+{
+  Watch& watch = this->watch(fd, token, Mode::READINESS);
+  watch.events = events;
+  armPoll(fd, watch);
+}
+
+void UringBackend::modify(int fd, std::uint64_t token, unsigned int events)
+{
+  Watch* watch = find(fd, token);
+  if (nullptr == watch)
+    {
+      return;
+    }
+
+  watch->events = events;
+  if (watch->armed)
+    {
+      // If the poll has already finished, the update fails, and the poll is
+      // re-armed with the new events when its completion is reaped.
+      struct io_uring_sqe* sqe = prepare(IORING_OP_POLL_REMOVE, -1,
+                                         userData(CANCEL, 0));
+      sqe->addr = userData(POLL, token);
+      sqe->len = IORING_POLL_UPDATE_EVENTS | IORING_POLL_ADD_MULTI;
+      sqe->poll32_events = toPollEvents(events);
+    }
+}
+
+void UringBackend::receive(int fd, std::uint64_t token)
+{
+  armReceive(fd, watch(fd, token, Mode::RECEIVE));
+}
+
+void UringBackend::accept(int fd, std::uint64_t token)
+{
+  armAccept(fd, watch(fd, token, Mode::ACCEPT));
+}
+
+void
+UringBackend::send(int fd, std::uint64_t token, const char* data,
+                   std::size_t length)
+{
+  Watch* watch = find(fd, token);
+  if (nullptr == watch)
+    {
+      return;
+    }
+
+  if (NO_OUTBOX == watch->outbox)
+    {
+      // May resize m_watches.
+      const std::size_t outbox = allocateOutbox(fd);
+      watch = find(fd, token);
+      watch->outbox = outbox;
+    }
+  m_outboxes[watch->outbox]->queued.append(data, length);
+  markDirty(watch->outbox);
+}
+
+void UringBackend::remove(int fd, std::uint64_t token)
+{
+  Watch* watch = find(fd, token);
+  if (nullptr == watch)
+    {
+      return;
+    }
+
+  // The caller closes fd after this round. Operations on it that have not
+  // been submitted yet would find the descriptor closed, or worse, reused.
+  if (m_sqLocalTail != __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE))
+    {
+      enter(0, 0);
+    }
+
+  if (watch->armed)
+    {
+      const Operation operation = Mode::RECEIVE == watch->mode ? RECEIVE
+        : (Mode::ACCEPT == watch->mode ? ACCEPT : POLL);
+      struct io_uring_sqe* sqe = prepare(IORING_OP_ASYNC_CANCEL, -1,
+                                         userData(CANCEL, 0));
+      sqe->addr = userData(operation, token);
+    }
+
+  if (NO_OUTBOX != watch->outbox)
+    {
+      Outbox& outbox = *m_outboxes[watch->outbox];
+      if (outbox.inFlight || !outbox.sending.empty()
+          || !outbox.queued.empty())
+        {
+          // Keep a duplicate of fd open until the rest has been written.
+          outbox.fd = ::fcntl(fd, F_DUPFD_CLOEXEC, 0);
+          outbox.lingering = true;
+          if (-1 == outbox.fd)
+            {
+              m_logStream("EventLoop: dropping data queued for fd "
+                          + std::to_string(fd) + ": "
+                          + std::system_error{errno,
+                              std::generic_category()}.what());
+              outbox.queued.clear();
+              if (!outbox.inFlight)
+                {
+                  releaseOutbox(watch->outbox);
+                }
+            }
+        }
+      else
+        {
+          releaseOutbox(watch->outbox);
+        }
+    }
+
+  m_watches[fd] = Watch{};
+}
+
+unsigned int UringBackend::wait(EventLoop& loop, int timeoutMilliseconds)
+{
+  flushSends();
+
+  const bool pending = *m_cqHead
+    != __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+  enter(pending || 0 == timeoutMilliseconds ? 0 : 1, timeoutMilliseconds);
+  return reap(loop);
+}
+
+void UringBackend::wakeup()
+{
+  const std::uint64_t one = 1;
+  // Can only fail if the counter would overflow, in which case the loop is
+  // going to wake up anyway.
+  (void)!::write(m_wakeup, &one, sizeof(one));
+}
+
+void UringBackend::release()
+{
+  if (MAP_FAILED != m_sqeMemory)
+    {
+      ::munmap(m_sqeMemory, m_sqeSize);
+    }
+  if (MAP_FAILED != m_ringMemory)
+    {
+      ::munmap(m_ringMemory, m_ringSize);
+    }
+  if (-1 != m_ring)
+    {
+      // Also unregisters the buffer ring.
+      ::close(m_ring);
+    }
+  if (nullptr != m_bufferRing)
+    {
+      ::munmap(m_bufferRing, m_bufferRingSize);
+    }
+  if (-1 != m_wakeup)
+    {
+      ::close(m_wakeup);
+    }
+}
+
+UringBackend::Watch* UringBackend::find(int fd, std::uint64_t token)
+{
+  if (0 > fd || m_watches.size() <= static_cast<std::size_t>(fd)
+      || m_watches[fd].token != token)
+    {
+      return nullptr;
+    }
+  return &m_watches[fd];
+}
+
+UringBackend::Watch&
+UringBackend::watch(int fd, std::uint64_t token, Mode mode)
+{
+  if (m_watches.size() <= static_cast<std::size_t>(fd))
+    {
+      m_watches.resize(fd + 1);
+    }
+  m_watches[fd] = Watch{};
+  m_watches[fd].token = token;
+  m_watches[fd].mode = mode;
+  return m_watches[fd];
+}
+
+struct io_uring_sqe*
+UringBackend::prepare(std::uint8_t opcode, int fd, std::uint64_t userData)
+{
+  if (m_sqEntries == m_sqLocalTail
+      - __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE))
+    {
+      enter(0, 0);
+      if (m_sqEntries == m_sqLocalTail
+          - __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE))
+        {
+          throw std::system_error{EBUSY, std::generic_category(),
+              "io_uring submission queue is full"};
+        }
+    }
+
+  struct io_uring_sqe* sqe = &m_sqes[m_sqLocalTail & m_sqMask];
+  std::memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = opcode;
+  sqe->fd = fd;
+  sqe->user_data = userData;
+  ++m_sqLocalTail;
+  return sqe;
+}
+
+// Submits everything prepared so far, and waits for at most
+// timeoutMilliseconds (-1 to wait forever) for minComplete completions.
+void UringBackend::enter(unsigned int minComplete, int timeoutMilliseconds)
+{
+  __atomic_store_n(m_sqTail, m_sqLocalTail, __ATOMIC_RELEASE);
+  const unsigned int submit = m_sqLocalTail
+    - __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+
+  unsigned int flags = IORING_ENTER_GETEVENTS;
+  struct __kernel_timespec timeout = {};
+  struct io_uring_getevents_arg argument = {};
+  void* arg = nullptr;
+  std::size_t argSize = 0;
+  if (0 < minComplete && 0 <= timeoutMilliseconds)
+    {
+      timeout.tv_sec = timeoutMilliseconds / 1000;
+      timeout.tv_nsec = (timeoutMilliseconds % 1000) * 1000000L;
+      argument.ts = reinterpret_cast<std::uint64_t>(&timeout);
+      flags |= IORING_ENTER_EXT_ARG;
+      arg = &argument;
+      argSize = sizeof(argument);
+    }
+
+  errno = 0;
+  if (-1 == ::syscall(__NR_io_uring_enter, m_ring, submit, minComplete,
+                      flags, arg, argSize))
+    {
+      // EBUSY: the completion queue overflowed; reaping makes room.
+      if (EINTR != errno && ETIME != errno && EBUSY != errno
+          && EAGAIN != errno)
+        {
+          throw std::system_error{errno, std::generic_category(),
+              "io_uring_enter"};
+        }
+    }
+}
+
+unsigned int UringBackend::reap(EventLoop& loop)
+{
+  unsigned int delivered = 0;
+  unsigned int head = *m_cqHead;
+  const unsigned int tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+  while (head != tail)
+    {
+      const struct io_uring_cqe& cqe = m_cqes[head & m_cqMask];
+      const std::uint64_t data = cqe.user_data;
+      const std::int32_t result = cqe.res;
+      const std::uint32_t flags = cqe.flags;
+      // Hand the entry back before the callbacks, which may take a while.
+      __atomic_store_n(m_cqHead, ++head, __ATOMIC_RELEASE);
+      delivered += complete(loop, data, result, flags);
+    }
+  return delivered;
+}
+
+unsigned int
+UringBackend::complete(EventLoop& loop, std::uint64_t data,
+                       std::int32_t result, std::uint32_t flags)
+{
+  const std::uint64_t operation = data >> OPERATION_SHIFT;
+  const std::uint64_t token = data & TOKEN_MASK;
+  const int fd = static_cast<int>(token & 0xffffffff);
+  const bool more = flags & IORING_CQE_F_MORE;
+
+  switch (operation)
+    {
+    case WAKEUP:
+      {
+        std::uint64_t counter = 0;
+        (void)!::read(m_wakeup, &counter, sizeof(counter));
+        if (!more)
+          {
+            armWakeup();
+          }
+        return 0;
+      }
+
+    case SEND:
+      sent(token, result);
+      return 0;
+
+    case POLL:
+      {
+        Watch* watch = find(fd, token);
+        if (nullptr == watch)
+          {
+            return 0;
+          }
+        watch->armed = watch->armed && more;
+
+        unsigned int events = 0;
+        if (0 <= result)
+          {
+            events = fromPollEvents(result)
+              & (watch->events | EventLoop::HANGUP | EventLoop::ERROR);
+          }
+        else if (-ECANCELED != result)
+          {
+            events = EventLoop::ERROR;
+          }
+        if (0 != events)
+          {
+            Backend::ready(loop, token, events);
+          }
+
+        // The callback may have removed the descriptor.
+        watch = find(fd, token);
+        if (nullptr != watch && !watch->armed
+            && (0 <= result || -ECANCELED == result))
+          {
+            armPoll(fd, *watch);
+          }
+        return 0 != events;
+      }
+
+    case RECEIVE:
+      {
+        const bool hasBuffer = flags & IORING_CQE_F_BUFFER;
+        const unsigned short bufferId = flags >> IORING_CQE_BUFFER_SHIFT;
+        Watch* watch = find(fd, token);
+        bool rearm = false;
+        unsigned int delivered = 0;
+        if (nullptr != watch)
+          {
+            watch->armed = watch->armed && more;
+            if (0 < result)
+              {
+                rearm = true;
+                delivered = 1;
+                Backend::received(loop, token,
+                                  m_buffers.get() + bufferId * BUFFER_SIZE,
+                                  result);
+              }
+            else if (-ENOBUFS == result || -ECANCELED == result)
+              {
+                // Out of buffers until this round's have been recycled.
+                rearm = true;
+              }
+            else if (-EINVAL == result && m_multishotReceive)
+              {
+                m_multishotReceive = false;
+                rearm = true;
+              }
+            else
+              {
+                delivered = 1;
+                Backend::received(loop, token, nullptr, result);
+              }
+          }
+
+        if (hasBuffer)
+          {
+            recycle(bufferId);
+          }
+        watch = find(fd, token);
+        if (rearm && nullptr != watch && !watch->armed)
+          {
+            armReceive(fd, *watch);
+          }
+        return delivered;
+      }
+
+    case ACCEPT:
+      {
+        Watch* watch = find(fd, token);
+        if (nullptr != watch)
+          {
+            watch->armed = watch->armed && more;
+          }
+
+        bool rearm = true;
+        unsigned int delivered = 0;
+        if (0 <= result)
+          {
+            // Closes the socket if the registration is gone.
+            delivered = nullptr != watch;
+            Backend::accepted(loop, token, result);
+          }
+        else if (nullptr == watch || -ECANCELED == result)
+          {
+            // Nothing to report.
+          }
+        else if (-EINVAL == result && m_multishotAccept)
+          {
+            m_multishotAccept = false;
+          }
+        else
+          {
+            // Errors like EMFILE are transient, but others would recur.
+            rearm = -EBADF != result && -ENOTSOCK != result
+              && -EINVAL != result && -EOPNOTSUPP != result;
+            delivered = 1;
+            Backend::accepted(loop, token, result);
+          }
+
+        watch = find(fd, token);
+        if (rearm && nullptr != watch && !watch->armed)
+          {
+            armAccept(fd, *watch);
+          }
+        return delivered;
+      }
+
+    default:
+      // CANCEL, PROVIDE, and updates to polls.
+      return 0;
+    }
+}
+
+void UringBackend::armPoll(int fd, const Watch& watch)
+{
+  struct io_uring_sqe* sqe = prepare(IORING_OP_POLL_ADD, fd,
+                                     userData(POLL, watch.token));
+  sqe->poll32_events = toPollEvents(watch.events);
+  sqe->len = IORING_POLL_ADD_MULTI;
+  m_watches[fd].armed = true;
+}
+
+void UringBackend::armReceive(int fd, const Watch& watch)
+{
+  struct io_uring_sqe* sqe = prepare(IORING_OP_RECV, fd,
+                                     userData(RECEIVE, watch.token));
+  sqe->flags = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = BUFFER_GROUP;
+  sqe->ioprio = m_multishotReceive ? IORING_RECV_MULTISHOT : 0;
+  m_watches[fd].armed = true;
+}
+
+void UringBackend::armAccept(int fd, const Watch& watch)
+{
+  struct io_uring_sqe* sqe = prepare(IORING_OP_ACCEPT, fd,
+                                     userData(ACCEPT, watch.token));
+  sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+  sqe->ioprio = m_multishotAccept ? IORING_ACCEPT_MULTISHOT : 0;
+  m_watches[fd].armed = true;
+}
+
+void UringBackend::armWakeup()
+{
+  struct io_uring_sqe* sqe = prepare(IORING_OP_POLL_ADD, m_wakeup,
+                                     userData(WAKEUP, 0));
+  sqe->poll32_events = POLLIN;
+  sqe->len = IORING_POLL_ADD_MULTI;
+}
+
+// Returns false if the kernel does not support buffer rings, or (as seen on
+// some virtualized kernels) accepts the registration but never finds any
+// buffers in the ring, which is checked by receiving a byte into it.
+bool UringBackend::registerBufferRing()
+{
+  // The buffer ring must be page-aligned, hence mmap.
+  m_bufferRingSize = BUFFER_COUNT * sizeof(struct io_uring_buf);
+  void* bufferRing = ::mmap(nullptr, m_bufferRingSize, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (MAP_FAILED == bufferRing)
+    {
+      throw std::system_error{errno, std::generic_category(), "mmap"};
+    }
+  m_bufferRing = static_cast<struct io_uring_buf_ring*>(bufferRing);
+
+  struct io_uring_buf_reg registration;
+  std::memset(&registration, 0, sizeof(registration));
+  registration.ring_addr = reinterpret_cast<std::uint64_t>(m_bufferRing);
+  registration.ring_entries = BUFFER_COUNT;
+  registration.bgid = BUFFER_GROUP;
+  bool works = 0 == ::syscall(__NR_io_uring_register, m_ring,
+                              IORING_REGISTER_PBUF_RING, &registration, 1);
+  if (works)
+    {
+      for (unsigned int i = 0; i < BUFFER_COUNT; ++i)
+        {
+          recycle(i);
+        }
+
+      int pair[2];
+      if (0 != ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, pair))
+        {
+          throw std::system_error{errno, std::generic_category(),
+              "socketpair"};
+        }
+      const char byte = 0;
+      (void)!::write(pair[1], &byte, sizeof(byte));
+      struct io_uring_sqe* sqe = prepare(IORING_OP_RECV, pair[0],
+                                         userData(PROVIDE, 0));
+      sqe->flags = IOSQE_BUFFER_SELECT;
+      sqe->buf_group = BUFFER_GROUP;
+      try
+        {
+          enter(1, -1);
+        }
+      catch (...)
+        {
+          ::close(pair[0]);
+          ::close(pair[1]);
+          throw;
+        }
+      ::close(pair[0]);
+      ::close(pair[1]);
+
+      // Nothing else has been submitted yet.
+      const struct io_uring_cqe& cqe = m_cqes[*m_cqHead & m_cqMask];
+      works = 0 < cqe.res && (cqe.flags & IORING_CQE_F_BUFFER);
+      if (works)
+        {
+          recycle(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+        }
+      __atomic_store_n(m_cqHead, *m_cqHead + 1, __ATOMIC_RELEASE);
+
+      if (!works)
+        {
+          ::syscall(__NR_io_uring_register, m_ring,
+                    IORING_UNREGISTER_PBUF_RING, &registration, 1);
+        }
+    }
+
+  if (!works)
+    {
+      ::munmap(m_bufferRing, m_bufferRingSize);
+      m_bufferRing = nullptr;
+    }
+  return works;
+}
+
+void UringBackend::recycle(unsigned short bufferId)
+{
+  if (nullptr == m_bufferRing)
+    {
+      struct io_uring_sqe* sqe = prepare(IORING_OP_PROVIDE_BUFFERS, 1,
+                                         userData(PROVIDE, 0));
+      sqe->addr = reinterpret_cast<std::uint64_t>
+        (m_buffers.get() + bufferId * BUFFER_SIZE);
+      sqe->len = BUFFER_SIZE;
+      sqe->off = bufferId;
+      sqe->buf_group = BUFFER_GROUP;
+      return;
+    }
+
+  struct io_uring_buf& buffer
+    = m_bufferRing->bufs[m_bufferTail & (BUFFER_COUNT - 1)];
+  buffer.addr = reinterpret_cast<std::uint64_t>
+    (m_buffers.get() + bufferId * BUFFER_SIZE);
+  buffer.len = BUFFER_SIZE;
+  buffer.bid = bufferId;
+  __atomic_store_n(&m_bufferRing->tail, ++m_bufferTail, __ATOMIC_RELEASE);
+}
+
+std::size_t UringBackend::allocateOutbox(int fd)
+{
+  std::size_t index = m_outboxes.size();
+  if (!m_freeOutboxes.empty())
+    {
+      index = m_freeOutboxes.back();
+      m_freeOutboxes.pop_back();
+    }
+  else
+    {
+      // Outboxes are allocated individually, since the kernel holds on to
+      // the address of the data being sent.
+      m_outboxes.push_back(std::make_unique<Outbox>());
+    }
+
+  Outbox& outbox = *m_outboxes[index];
+  outbox.fd = fd;
+  outbox.inUse = true;
+  return index;
+}
+
+void UringBackend::releaseOutbox(std::size_t index)
+{
+  Outbox& outbox = *m_outboxes[index];
+  if (outbox.lingering && 0 <= outbox.fd)
+    {
+      ::close(outbox.fd);
+    }
+  outbox.fd = -1;
+  outbox.inUse = false;
+  outbox.lingering = false;
+  outbox.queued.clear();
+  outbox.sending.clear();
+  outbox.offset = 0;
+  m_freeOutboxes.push_back(index);
+}
+
+void UringBackend::markDirty(std::size_t index)
+{
+  Outbox& outbox = *m_outboxes[index];
+  if (!outbox.dirty && !outbox.inFlight)
+    {
+      outbox.dirty = true;
+      m_dirty.push_back(index);
+    }
+}
+
+void UringBackend::flushSends()
+{
+  for (std::size_t index : m_dirty)
+    {
+      Outbox& outbox = *m_outboxes[index];
+      outbox.dirty = false;
+      if (!outbox.inUse || outbox.inFlight || 0 > outbox.fd)
+        {
+          continue;
+        }
+
+      if (outbox.offset == outbox.sending.size())
+        {
+          if (outbox.queued.empty())
+            {
+              continue;
+            }
+          outbox.sending.clear();
+          outbox.sending.swap(outbox.queued);
+          outbox.offset = 0;
+        }
+
+      struct io_uring_sqe* sqe = prepare(IORING_OP_SEND, outbox.fd,
+                                         userData(SEND, index));
+      sqe->addr = reinterpret_cast<std::uint64_t>
+        (outbox.sending.data() + outbox.offset);
+      sqe->len = outbox.sending.size() - outbox.offset;
+      sqe->msg_flags = MSG_NOSIGNAL;
+      outbox.inFlight = true;
+    }
+  m_dirty.clear();
+}
+
+void UringBackend::sent(std::size_t index, std::int32_t result)
+{
+  Outbox& outbox = *m_outboxes[index];
+  outbox.inFlight = false;
+  if (0 < result)
+    {
+      outbox.offset += result;
+    }
+  else if (-EINTR != result && -EAGAIN != result)
+    {
+      // The error is reported to the registration by its next read.
+      outbox.sending.clear();
+      outbox.queued.clear();
+      outbox.offset = 0;
+    }
+
+  if (outbox.offset == outbox.sending.size() && outbox.queued.empty())
+    {
+      outbox.sending.clear();
+      outbox.offset = 0;
+      if (outbox.lingering)
+        {
+          releaseOutbox(index);
+        }
+      return;
+    }
+  markDirty(index);
+}
+
+std::unique_ptr<Networking::EventLoop::Backend>
+Networking::EventLoop::Backend
+::createUring(unsigned int entries,
+              std::function<void(const std::string&)> logStream)
+{
+  try
+    {
+      return std::make_unique<UringBackend>(entries, logStream);
+    }
+  catch (const std::exception& e)
+    {
+      logStream(std::string{"EventLoop: "} + e.what());
+      return nullptr;
+    }
+}
+
+#else // IORING_RECV_MULTISHOT
+
+std::unique_ptr<Networking::EventLoop::Backend>
+Networking::EventLoop::Backend
+::createUring(unsigned int, std::function<void(const std::string&)>)
+{
+  return nullptr;
+}
+
+#endif // IORING_RECV_MULTISHOT
+
+///////////////////////////////////////////////////////////////////////////////
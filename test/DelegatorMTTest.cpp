@@ -0,0 +1,147 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            DelegatorMTTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the thread-pool delegator, and of each of its
+//                  policies for a full queue.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include "TestRequest.h"
+
+#include <Networking/DelegatorMT.h>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Networking;
+
+namespace
+{
+  // Occupies the only worker of a delegator until it is released.
+  struct Blocker
+  {
+    std::unique_ptr<Interfaces::IRequest> make()
+    {
+      return TestRequest::make([this]()
+        {
+          started.set_value();
+          released.wait();
+        });
+    }
+
+    std::promise<void> started;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+  };
+};
+
+TEST(DelegatorMTTest, HandlesEveryRequest)
+{
+  std::atomic<unsigned int> handled{0};
+  {
+    DelegatorMT delegator{4, 8};
+    for (int i = 0; i < 1000; ++i)
+      {
+        delegator.dispatch(TestRequest::make([&handled]() { ++handled; }));
+      }
+    // The destructor handles what is still queued.
+  }
+  EXPECT_EQ(1000u, handled.load());
+}
+
+TEST(DelegatorMTTest, RejectsWhenTheQueueIsFull)
+{
+  std::vector<std::string> log;
+  unsigned int handled = 0;
+  bool destroyed = false;
+  Blocker blocker;
+  {
+    DelegatorMT delegator{1, 1, DelegatorMT::REJECT,
+        [&log](const std::string& message) { log.push_back(message); }};
+    delegator.dispatch(blocker.make());
+    blocker.started.get_future().wait();
+
+    delegator.dispatch(TestRequest::make([&handled]() { ++handled; }));
+    delegator.dispatch(TestRequest::make([&handled]() { ++handled; },
+                                         [&destroyed]()
+                                         {
+                                           destroyed = true;
+                                         }));
+    // The rejected request is destroyed without being handled.
+    EXPECT_TRUE(destroyed);
+    EXPECT_EQ(1u, log.size());
+    blocker.release.set_value();
+  }
+  EXPECT_EQ(1u, handled);
+}
+
+TEST(DelegatorMTTest, RunsInlineWhenTheQueueIsFull)
+{
+  std::thread::id handledOn;
+  Blocker blocker;
+  {
+    DelegatorMT delegator{1, 1, DelegatorMT::RUN_INLINE};
+    delegator.dispatch(blocker.make());
+    blocker.started.get_future().wait();
+
+    delegator.dispatch(TestRequest::make([]() {}));
+    delegator.dispatch(TestRequest::make([&handledOn]()
+      {
+        handledOn = std::this_thread::get_id();
+      }));
+    EXPECT_EQ(std::this_thread::get_id(), handledOn);
+    blocker.release.set_value();
+  }
+}
+
+TEST(DelegatorMTTest, BlocksUntilTheQueueHasRoom)
+{
+  std::atomic<unsigned int> handled{0};
+  Blocker blocker;
+  DelegatorMT delegator{1, 1, DelegatorMT::BLOCK};
+  delegator.dispatch(blocker.make());
+  blocker.started.get_future().wait();
+  delegator.dispatch(TestRequest::make([&handled]() { ++handled; }));
+
+  auto dispatched = std::async(std::launch::async, [&]()
+    {
+      delegator.dispatch(TestRequest::make([&handled]() { ++handled; }));
+    });
+  EXPECT_EQ(std::future_status::timeout,
+            dispatched.wait_for(std::chrono::milliseconds{50}));
+
+  blocker.release.set_value();
+  dispatched.get();
+}
+
+TEST(DelegatorMTTest, LogsHandlersThatThrow)
+{
+  std::vector<std::string> log;
+  std::atomic<unsigned int> handled{0};
+  {
+    DelegatorMT delegator{1, 4, DelegatorMT::BLOCK,
+        [&log](const std::string& message) { log.push_back(message); }};
+    delegator.dispatch(TestRequest::make([]()
+      {
+        throw std::runtime_error{"expected"};
+      }));
+    delegator.dispatch(TestRequest::make([&handled]() { ++handled; }));
+  }
+  EXPECT_EQ(1u, handled.load());
+  ASSERT_EQ(1u, log.size());
+  EXPECT_NE(std::string::npos, log.front().find("expected"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
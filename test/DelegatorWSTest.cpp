@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            DelegatorWSTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the work-stealing delegator, and of its lock-free
+//                  queues under concurrent pops and steals.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include "TestRequest.h"
+
+#include <Networking/DelegatorWS.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Networking;
+
+TEST(DelegatorWSTest, HandlesEachRequestExactlyOnce)
+{
+  // Small queues keep the owners popping and the thieves stealing from the
+  // same few slots, and push some requests onto the dispatching thread.
+  static constexpr std::size_t COUNT = 100000;
+  std::vector<std::atomic<unsigned int>> handled(COUNT);
+  {
+    DelegatorWS delegator{4, 4};
+    for (std::size_t i = 0; i < COUNT; ++i)
+      {
+        delegator.dispatch(TestRequest::make([&handled, i]()
+          {
+            ++handled[i];
+          }));
+      }
+  }
+
+  for (std::size_t i = 0; i < COUNT; ++i)
+    {
+      ASSERT_EQ(1u, handled[i].load()) << "request " << i;
+    }
+}
+
+TEST(DelegatorWSTest, StealsFromABusyWorker)
+{
+  std::promise<void> started;
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::atomic<unsigned int> handled{0};
+
+  DelegatorWS delegator{2, 64};
+  delegator.dispatch(TestRequest::make([&started, released]()
+    {
+      started.set_value();
+      released.wait();
+    }));
+  started.get_future().wait();
+
+  // Dispatch is round-robin, so half of these queue up behind the request
+  // that occupies the first worker. Only stealing can get them handled.
+  static constexpr unsigned int COUNT = 20;
+  for (unsigned int i = 0; i < COUNT; ++i)
+    {
+      delegator.dispatch(TestRequest::make([&handled]() { ++handled; }));
+    }
+
+  const auto deadline = std::chrono::steady_clock::now()
+    + std::chrono::seconds{5};
+  while (COUNT != handled.load()
+         && std::chrono::steady_clock::now() < deadline)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+  EXPECT_EQ(COUNT, handled.load());
+
+  std::uint64_t steals = 0;
+  for (const auto& statistics : delegator.getStatistics())
+    {
+      steals += statistics.steals;
+    }
+  EXPECT_LT(0u, steals);
+  release.set_value();
+}
+
+TEST(DelegatorWSTest, HandlesQueuedRequestsOnDestruction)
+{
+  std::promise<void> started;
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::atomic<unsigned int> handled{0};
+  {
+    DelegatorWS delegator{1, 64};
+    delegator.dispatch(TestRequest::make([&started, released]()
+      {
+        started.set_value();
+        released.wait();
+      }));
+    started.get_future().wait();
+    for (int i = 0; i < 32; ++i)
+      {
+        delegator.dispatch(TestRequest::make([&handled]() { ++handled; }));
+      }
+    EXPECT_EQ(32u, delegator.getStatistics().front().queueDepth);
+    release.set_value();
+  }
+  EXPECT_EQ(32u, handled.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,353 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            EventLoopTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the edge-triggered event loop, on socket pairs.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include <Networking/EventLoop.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace Networking;
+
+namespace
+{
+  // A connected pair of non-blocking sockets, closed on destruction.
+  struct SocketPair
+  {
+    SocketPair()
+    {
+      if (0 != ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+    }
+
+    ~SocketPair()
+    {
+      ::close(fds[0]);
+      ::close(fds[1]);
+    }
+
+    void send(const std::string& data)
+    {
+      ASSERT_EQ(static_cast<ssize_t>(data.size()),
+                ::write(fds[1], data.data(), data.size()));
+    }
+
+    int fds[2];
+  };
+
+  // Reads until the socket would block, as an edge-triggered callback must.
+  std::string drain(int fd)
+  {
+    std::string data;
+    char buffer[256];
+    ssize_t length = 0;
+    while (0 < (length = ::read(fd, buffer, sizeof(buffer))))
+      {
+        data.append(buffer, length);
+      }
+    return data;
+  }
+
+  class EventLoopTest : public ::testing::TestWithParam<EventLoop::Engine>
+  {};
+};
+
+TEST_P(EventLoopTest, DispatchesEachEdgeOnce)
+{
+  SocketPair sockets;
+  EventLoop loop{GetParam()};
+  unsigned int calls = 0;
+  loop.add(sockets.fds[0], EventLoop::READABLE,
+           [&calls](unsigned int events)
+           {
+             EXPECT_TRUE(events & EventLoop::READABLE);
+             ++calls;
+           });
+
+  sockets.send("a");
+  loop.runOnce(1000);
+  EXPECT_EQ(1u, calls);
+
+  // The data was not read, but there is no new edge.
+  loop.runOnce(10);
+  EXPECT_EQ(1u, calls);
+
+  sockets.send("b");
+  loop.runOnce(1000);
+  EXPECT_EQ(2u, calls);
+  EXPECT_EQ("ab", drain(sockets.fds[0]));
+  loop.remove(sockets.fds[0]);
+}
+
+TEST_P(EventLoopTest, CallsBackOnTheLoopThread)
+{
+  SocketPair sockets;
+  EventLoop loop{GetParam()};
+  EventLoop* current = nullptr;
+  loop.add(sockets.fds[0], EventLoop::READABLE,
+           [&current](unsigned int)
+           {
+             current = EventLoop::current();
+           });
+
+  sockets.send("a");
+  loop.runOnce(1000);
+  EXPECT_EQ(&loop, current);
+  EXPECT_EQ(nullptr, EventLoop::current());
+  loop.remove(sockets.fds[0]);
+}
+
+TEST_P(EventLoopTest, CallbackMayRemoveItself)
+{
+  SocketPair sockets;
+  EventLoop loop{GetParam()};
+  const int fd = sockets.fds[0];
+  auto token = std::make_shared<int>(0);
+  std::weak_ptr<int> captured = token;
+  loop.add(fd, EventLoop::READABLE,
+           [&loop, fd, token](unsigned int)
+           {
+             loop.remove(fd);
+             // Removal must not destroy the callback that is running.
+             EXPECT_EQ(0, *token);
+           });
+  token.reset();
+
+  sockets.send("a");
+  loop.runOnce(1000);
+  EXPECT_FALSE(loop.contains(fd));
+  // The callback is destroyed once the round is over.
+  EXPECT_TRUE(captured.expired());
+  EXPECT_EQ(0u, loop.size());
+}
+
+TEST_P(EventLoopTest, SkipsEventsForDescriptorsRemovedInTheSameRound)
+{
+  SocketPair first;
+  SocketPair second;
+  EventLoop loop{GetParam()};
+  std::vector<int> called;
+  const int fds[] = {first.fds[0], second.fds[0]};
+  for (int fd : fds)
+    {
+      loop.add(fd, EventLoop::READABLE,
+               [&loop, &called, &fds, fd](unsigned int)
+               {
+                 called.push_back(fd);
+                 // Whichever is dispatched first removes the other.
+                 loop.remove(fd == fds[0] ? fds[1] : fds[0]);
+               });
+    }
+
+  first.send("a");
+  second.send("b");
+  loop.runOnce(1000);
+  loop.runOnce(10);
+  EXPECT_EQ(1u, called.size());
+  EXPECT_EQ(1u, loop.size());
+  loop.remove(called.front());
+}
+
+TEST_P(EventLoopTest, RemovesCallbacksThatThrow)
+{
+  SocketPair sockets;
+  std::vector<std::string> log;
+  EventLoop loop{GetParam(), 256, [&log](const std::string& message)
+    {
+      log.push_back(message);
+    }};
+  loop.add(sockets.fds[0], EventLoop::READABLE,
+           [](unsigned int)
+           {
+             throw std::runtime_error{"expected"};
+           });
+
+  sockets.send("a");
+  loop.runOnce(1000);
+  EXPECT_FALSE(loop.contains(sockets.fds[0]));
+  ASSERT_EQ(1u, log.size());
+  EXPECT_NE(std::string::npos, log.front().find("expected"));
+}
+
+TEST_P(EventLoopTest, ReceivesUntilTheEndOfTheStream)
+{
+  SocketPair sockets;
+  EventLoop loop{GetParam()};
+  std::string received;
+  bool ended = false;
+  loop.receive(sockets.fds[0],
+               [&received, &ended](const char* data, ssize_t length)
+               {
+                 ASSERT_LE(0, length);
+                 if (0 == length)
+                   {
+                     ended = true;
+                     return;
+                   }
+                 received.append(data, length);
+               });
+
+  sockets.send("hello, ");
+  loop.runOnce(1000);
+  sockets.send("world");
+  ::shutdown(sockets.fds[1], SHUT_WR);
+  for (int i = 0; i < 10 && !ended; ++i)
+    {
+      loop.runOnce(100);
+    }
+  EXPECT_EQ("hello, world", received);
+  EXPECT_TRUE(ended);
+  loop.remove(sockets.fds[0]);
+  loop.runOnce(0);
+}
+
+TEST_P(EventLoopTest, SendsQueuedDataOnceTheRoundIsOver)
+{
+  SocketPair sockets;
+  EventLoop loop{GetParam()};
+  loop.receive(sockets.fds[0], [](const char*, ssize_t) {});
+  loop.send(sockets.fds[0], "abc", 3);
+  loop.send(sockets.fds[0], "def", 3);
+  EXPECT_EQ("", drain(sockets.fds[1]));
+
+  std::string received;
+  for (int i = 0; i < 10 && 6 > received.size(); ++i)
+    {
+      loop.runOnce(10);
+      received += drain(sockets.fds[1]);
+    }
+  EXPECT_EQ("abcdef", received);
+  loop.remove(sockets.fds[0]);
+  loop.runOnce(0);
+}
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+  using std::chrono::milliseconds;
+
+  // Runs the loop until the callback sees the end of the stream, or the
+  // time runs out.
+  void runUntil(EventLoop& loop, const bool& ended, milliseconds timeout)
+  {
+    const Clock::time_point deadline = Clock::now() + timeout;
+    while (!ended && Clock::now() < deadline)
+      {
+        loop.runOnce(10);
+      }
+  }
+};
+
+TEST_P(EventLoopTest, HangsUpOnAnIdleSocket)
+{
+  SocketPair sockets;
+  EventLoop loop{GetParam()};
+  bool ended = false;
+  loop.receive(sockets.fds[0], [&ended](const char*, ssize_t length)
+    {
+      ended = ended || 0 == length;
+    });
+
+  const Clock::time_point start = Clock::now();
+  loop.setIdleTimeout(sockets.fds[0], milliseconds{50});
+  runUntil(loop, ended, milliseconds{2000});
+  EXPECT_TRUE(ended);
+  EXPECT_LE(milliseconds{50}, Clock::now() - start);
+  loop.remove(sockets.fds[0]);
+  loop.runOnce(0);
+}
+
+TEST_P(EventLoopTest, HangsUpOnASocketThatIsNeverReadable)
+{
+  SocketPair sockets;
+  EventLoop loop{GetParam()};
+  bool ended = false;
+  loop.receive(sockets.fds[0], [&ended](const char*, ssize_t length)
+    {
+      ended = ended || 0 == length;
+    });
+
+  // The idle timeout is far off: the first read timeout applies.
+  loop.setIdleTimeout(sockets.fds[0], milliseconds{60000}, milliseconds{50});
+  runUntil(loop, ended, milliseconds{2000});
+  EXPECT_TRUE(ended);
+  loop.remove(sockets.fds[0]);
+  loop.runOnce(0);
+}
+
+TEST_P(EventLoopTest, ActivityPostponesTheIdleDeadline)
+{
+  SocketPair sockets;
+  EventLoop loop{GetParam()};
+  bool ended = false;
+  std::string received;
+  loop.receive(sockets.fds[0],
+               [&ended, &received](const char* data, ssize_t length)
+               {
+                 ended = ended || 0 == length;
+                 if (0 < length)
+                   {
+                     received.append(data, length);
+                   }
+               });
+
+  loop.setIdleTimeout(sockets.fds[0], milliseconds{250});
+  // Twice the timeout, never idle for more than a fifth of it.
+  const Clock::time_point busyUntil = Clock::now() + milliseconds{500};
+  while (Clock::now() < busyUntil)
+    {
+      sockets.send("x");
+      loop.runOnce(50);
+    }
+  EXPECT_FALSE(ended);
+  EXPECT_FALSE(received.empty());
+
+  runUntil(loop, ended, milliseconds{2000});
+  EXPECT_TRUE(ended);
+  loop.remove(sockets.fds[0]);
+  loop.runOnce(0);
+}
+
+TEST_P(EventLoopTest, ZeroTimeoutsCancelTheDeadline)
+{
+  SocketPair sockets;
+  EventLoop loop{GetParam()};
+  bool ended = false;
+  loop.receive(sockets.fds[0], [&ended](const char*, ssize_t length)
+    {
+      ended = ended || 0 == length;
+    });
+
+  loop.setIdleTimeout(sockets.fds[0], milliseconds{20});
+  loop.setIdleTimeout(sockets.fds[0], milliseconds{0});
+  runUntil(loop, ended, milliseconds{200});
+  EXPECT_FALSE(ended);
+  loop.remove(sockets.fds[0]);
+  loop.runOnce(0);
+}
+
+INSTANTIATE_TEST_SUITE_P(Engines, EventLoopTest,
+                         ::testing::Values(EventLoop::EPOLL,
+                                           EventLoop::IO_URING));
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            NetworkAddressTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the parsing of IPv4 and IPv6 addresses.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include <Networking/NetworkAddress.h>
+
+#include <stdexcept>
+#include <string>
+
+#include <net/if.h>
+
+using namespace Networking;
+
+TEST(NetworkAddressTest, ParsesIPv4)
+{
+  NetworkAddress address{"192.0.2.1", 80};
+  EXPECT_EQ(AF_INET, address.getFamily());
+  EXPECT_EQ(0xc0000201u, address.getIPHostOrder());
+  EXPECT_EQ("192.0.2.1", address.getIPDotNotation());
+  EXPECT_EQ(80, address.getPortHostOrder());
+  EXPECT_EQ(sizeof(struct sockaddr_in), address.getSockAddrLength());
+  EXPECT_EQ("(192.0.2.1, 80)", address.string());
+  EXPECT_EQ(address, (NetworkAddress{0xc0000201u, 80}));
+}
+
+TEST(NetworkAddressTest, ParsesIPv6)
+{
+  NetworkAddress address{"2001:db8:0::1", 443};
+  EXPECT_EQ(AF_INET6, address.getFamily());
+  EXPECT_EQ("2001:db8::1", address.getIPDotNotation());
+  EXPECT_EQ(443, address.getPortHostOrder());
+  EXPECT_EQ(sizeof(struct sockaddr_in6), address.getSockAddrLength());
+  EXPECT_EQ("(2001:db8::1, 443)", address.string());
+  EXPECT_THROW(address.getIPHostOrder(), std::logic_error);
+
+  EXPECT_EQ(address, (NetworkAddress{"[2001:db8::1]", 443}));
+  EXPECT_NE(address, (NetworkAddress{"2001:db8::1", 80}));
+  EXPECT_NE(address, (NetworkAddress{"2001:db8::2", 443}));
+  EXPECT_EQ((NetworkAddress{address, 80}),
+            (NetworkAddress{"2001:db8::1", 80}));
+}
+
+TEST(NetworkAddressTest, ParsesZones)
+{
+  const unsigned int loopback = ::if_nametoindex("lo");
+  ASSERT_NE(0u, loopback) << "no loopback interface";
+
+  NetworkAddress named{"fe80::1%lo", 0};
+  EXPECT_EQ(AF_INET6, named.getFamily());
+  EXPECT_EQ("fe80::1%lo", named.getIPDotNotation());
+  EXPECT_EQ(loopback, reinterpret_cast<const struct sockaddr_in6*>
+            (named.getSockAddr())->sin6_scope_id);
+
+  // A zone may be given by its index, and is shown by its name.
+  NetworkAddress numbered{"[fe80::1%" + std::to_string(loopback) + "]", 0};
+  EXPECT_EQ(named, numbered);
+  EXPECT_NE(named, (NetworkAddress{"fe80::1", 0}));
+}
+
+TEST(NetworkAddressTest, RejectsInvalidAddresses)
+{
+  for (const char* invalid : {"", "192.0.2", "256.0.0.1", "2001:db8::1::2",
+        "[2001:db8::1", "fe80::1%", "fe80::1%no-such-interface",
+        "localhost"})
+    {
+      EXPECT_THROW((NetworkAddress{invalid, 0}), std::invalid_argument)
+        << invalid;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            PeerAddressTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the formatting and conversion of PeerAddresses.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include <Networking/NetworkAddress.h>
+#include <Networking/PeerAddress.h>
+
+#include <cstring>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+using namespace Networking;
+
+TEST(PeerAddressTest, IsEmptyUntilFilledIn)
+{
+  PeerAddress address;
+  EXPECT_EQ(AF_UNSPEC, address.getFamily());
+  EXPECT_EQ(sizeof(struct sockaddr_storage), address.getLength());
+  EXPECT_EQ("", address.getIPString());
+  EXPECT_EQ(0, address.getPortHostOrder());
+  EXPECT_THROW(address.getNetworkAddress(), std::invalid_argument);
+}
+
+TEST(PeerAddressTest, FormatsIPv4Addresses)
+{
+  const NetworkAddress original{"192.0.2.1", 8080};
+  PeerAddress address{original};
+  EXPECT_EQ(AF_INET, address.getFamily());
+  EXPECT_EQ(sizeof(struct sockaddr_in), address.getLength());
+  EXPECT_EQ("192.0.2.1", address.getIPString());
+  EXPECT_EQ(8080, address.getPortHostOrder());
+  EXPECT_EQ("(192.0.2.1, 8080)", address.string());
+  EXPECT_EQ(original, address.getNetworkAddress());
+}
+
+TEST(PeerAddressTest, FormatsIPv6Addresses)
+{
+  struct sockaddr_in6 raw{};
+  raw.sin6_family = AF_INET6;
+  raw.sin6_port = htons(443);
+  ASSERT_EQ(1, inet_pton(AF_INET6, "2001:db8::1", &raw.sin6_addr));
+  PeerAddress address{reinterpret_cast<const struct sockaddr*>(&raw),
+                      sizeof(raw)};
+  EXPECT_EQ(AF_INET6, address.getFamily());
+  EXPECT_EQ("2001:db8::1", address.getIPString());
+  EXPECT_EQ(443, address.getPortHostOrder());
+  EXPECT_EQ("(2001:db8::1, 443)", address.string());
+  EXPECT_EQ((NetworkAddress{"2001:db8::1", 443}),
+            address.getNetworkAddress());
+}
+
+TEST(PeerAddressTest, IsFilledInThroughItsStorage)
+{
+  const NetworkAddress original{"127.0.0.1", 13001};
+  PeerAddress address;
+  std::memcpy(address.getSockAddr(), original.getSockAddr(),
+              original.getSockAddrLength());
+  address.getLength() = original.getSockAddrLength();
+  EXPECT_EQ("(127.0.0.1, 13001)", address.string());
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            RequestPoolTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the pool that TCP requests are allocated from.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include <Networking/RequestPool.h>
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <vector>
+
+using namespace Networking;
+
+TEST(RequestPoolTest, ReusesReturnedBlocks)
+{
+  auto pool = RequestPool::create(64, 4);
+  void* first = pool->allocate(64);
+  RequestPool::deallocate(first);
+  EXPECT_EQ(first, pool->allocate(32));
+  RequestPool::deallocate(first);
+}
+
+TEST(RequestPoolTest, AlignsBlocksForAnyType)
+{
+  auto pool = RequestPool::create(64);
+  void* block = pool->allocate(8);
+  EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(block)
+            % alignof(std::max_align_t));
+  RequestPool::deallocate(block);
+}
+
+TEST(RequestPoolTest, RejectsRequestsLargerThanABlock)
+{
+  auto pool = RequestPool::create(64);
+  EXPECT_THROW(pool->allocate(65), std::bad_alloc);
+}
+
+TEST(RequestPoolTest, OutlivesItsOwnerWhileBlocksRemain)
+{
+  auto pool = RequestPool::create(64);
+  void* block = pool->allocate(64);
+  pool.reset();
+  // Still writable, and still knows where to go back to.
+  std::memset(block, 0, 64);
+  RequestPool::deallocate(block);
+}
+
+TEST(RequestPoolTest, AcceptsBlocksFromAnyThread)
+{
+  auto pool = RequestPool::create(64, 16);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+    {
+      threads.emplace_back([&pool]()
+        {
+          for (int j = 0; j < 10000; ++j)
+            {
+              RequestPool::deallocate(pool->allocate(64));
+            }
+        });
+    }
+  for (auto& thread : threads)
+    {
+      thread.join();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            ResolverTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the Resolver's caching, through a stub lookup
+//                  that counts the queries that reach it.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include <Networking/Resolver.h>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <future>
+#include <system_error>
+
+using namespace Networking;
+
+namespace
+{
+  std::unique_ptr<Resolver> makeResolver(Resolver::ForwardLookup lookup)
+  {
+    return Resolver::Builder{}
+      .setNumWorkers(2)
+      .setTtl(std::chrono::seconds{60})
+      .setNegativeTtl(std::chrono::seconds{60})
+      .setForwardLookup(std::move(lookup))
+      .build();
+  }
+};
+
+TEST(ResolverTest, AnswersFromTheCache)
+{
+  std::atomic<unsigned int> queries{0};
+  auto resolver = makeResolver([&queries](const std::string&)
+    {
+      ++queries;
+      return Resolver::Addresses{NetworkAddress{"192.0.2.1", 0}};
+    });
+
+  for (int i = 0; i < 3; ++i)
+    {
+      Resolver::Addresses addresses = resolver->resolve("host").get();
+      ASSERT_EQ(1u, addresses.size());
+      EXPECT_EQ("192.0.2.1", addresses.front().getIPDotNotation());
+    }
+  EXPECT_EQ(1u, queries.load());
+  EXPECT_EQ(1u, resolver->getStatistics().lookups);
+
+  resolver->resolve("other").get();
+  EXPECT_EQ(2u, queries.load());
+}
+
+TEST(ResolverTest, CachesFailures)
+{
+  std::atomic<unsigned int> queries{0};
+  auto resolver = makeResolver([&queries](const std::string&)
+                               -> Resolver::Addresses
+    {
+      ++queries;
+      throw std::system_error{EHOSTUNREACH, std::generic_category()};
+    });
+
+  for (int i = 0; i < 3; ++i)
+    {
+      EXPECT_THROW(resolver->resolve("nowhere").get(), std::system_error);
+    }
+  EXPECT_EQ(1u, queries.load());
+}
+
+TEST(ResolverTest, ForgetsWhatIsCleared)
+{
+  std::atomic<unsigned int> queries{0};
+  auto resolver = makeResolver([&queries](const std::string&)
+    {
+      ++queries;
+      return Resolver::Addresses{NetworkAddress{"192.0.2.1", 0}};
+    });
+
+  resolver->resolve("host").get();
+  resolver->clear();
+  resolver->resolve("host").get();
+  EXPECT_EQ(2u, queries.load());
+}
+
+TEST(ResolverTest, SharesALookupInFlight)
+{
+  std::atomic<unsigned int> queries{0};
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  auto resolver = makeResolver([&queries, released](const std::string&)
+    {
+      ++queries;
+      released.wait();
+      return Resolver::Addresses{NetworkAddress{"192.0.2.1", 0}};
+    });
+
+  auto first = resolver->resolve("host");
+  auto second = resolver->resolve("host");
+  auto third = resolver->resolve("host");
+  release.set_value();
+
+  EXPECT_EQ(1u, first.get().size());
+  EXPECT_EQ(1u, second.get().size());
+  EXPECT_EQ(1u, third.get().size());
+  EXPECT_EQ(1u, queries.load());
+  EXPECT_EQ(2u, resolver->getStatistics().coalesced);
+}
+
+///////////////////////////////////////////////////////////////////////////////
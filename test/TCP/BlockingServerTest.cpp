@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            BlockingServerTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the blocking server, with a TCP listener on the
+//                  loopback interface.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include "LoopbackClient.h"
+
+#include <Networking/BlockingServer.h>
+#include <Networking/DelegatorMT.h>
+#include <Networking/NetworkAddress.h>
+#include <Networking/TCP/TCPListener.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Networking;
+using namespace Networking::TCP;
+
+TEST(BlockingServerTest, HandlesConnectionsUntilStopped)
+{
+  std::atomic<unsigned int> handled{0};
+  auto listener = std::make_unique<TCPListener<NetworkAddress>>
+    (TCPListener<NetworkAddress>::Builder()
+     .setListeningAddress(NetworkAddress{"127.0.0.1", 0})
+     .setUserHandler([&handled](unsigned int, const NetworkAddress&)
+       {
+         ++handled;
+       })
+     .build());
+  const int listeningSocket = listener->getDescriptor();
+  BlockingServer server{std::make_unique<DelegatorMT>(2),
+                        std::move(listener)};
+  auto running = std::async(std::launch::async, [&server]()
+    {
+      server.start();
+    });
+
+  std::vector<std::unique_ptr<LoopbackClient>> clients;
+  for (int i = 0; i < 3; ++i)
+    {
+      clients.push_back(std::make_unique<LoopbackClient>(listeningSocket));
+    }
+  const auto deadline = std::chrono::steady_clock::now()
+    + std::chrono::seconds{5};
+  while (3 != handled.load() && std::chrono::steady_clock::now() < deadline)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+  EXPECT_EQ(3u, handled.load());
+
+  server.stop();
+  ASSERT_EQ(std::future_status::ready,
+            running.wait_for(std::chrono::seconds{5}));
+  running.get();
+}
+
+TEST(BlockingServerTest, DrainsQueuedRequestsBeforeReleasingTheListener)
+{
+  std::atomic<unsigned int> started{0};
+  std::atomic<unsigned int> handled{0};
+  auto listener = std::make_unique<TCPListener<NetworkAddress>>
+    (TCPListener<NetworkAddress>::Builder()
+     .setListeningAddress(NetworkAddress{"127.0.0.1", 0})
+     .setUserHandler([&started, &handled](unsigned int,
+                                          const NetworkAddress&)
+       {
+         ++started;
+         std::this_thread::sleep_for(std::chrono::milliseconds{50});
+         ++handled;
+       })
+     .build());
+  const int listeningSocket = listener->getDescriptor();
+  std::vector<std::unique_ptr<LoopbackClient>> clients;
+  {
+    // One worker, so that two of the requests are still queued when the
+    // server is destroyed.
+    BlockingServer server{std::make_unique<DelegatorMT>(1, 8),
+                          std::move(listener)};
+    auto running = std::async(std::launch::async, [&server]()
+      {
+        server.start();
+      });
+
+    for (int i = 0; i < 3; ++i)
+      {
+        clients.push_back(std::make_unique<LoopbackClient>(listeningSocket));
+      }
+    while (0 == started.load())
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+      }
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+
+    server.stop();
+    ASSERT_EQ(std::future_status::ready,
+              running.wait_for(std::chrono::seconds{5}));
+    running.get();
+    EXPECT_GT(3u, handled.load());
+  }
+  EXPECT_EQ(3u, handled.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            FrameCodecTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the FrameCodec: frames split over any number of
+//                  reads, reads holding any number of frames, and frames
+//                  longer than the maximum.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include <Networking/TCP/FrameCodec.h>
+#include <Networking/TCP/Stream.h>
+
+#include <stdexcept>
+#include <string>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace Networking::TCP;
+
+TEST(FrameCodecTest, WaitsForAPartialFrame)
+{
+  FrameCodec codec = FrameCodec::Builder{}.setLengthPrefixed(2)
+    .setMaxFrameSize(1024).build();
+  const std::string frame{"\0\5hello", 7};
+  for (std::size_t i = 0; i + 1 < frame.size(); ++i)
+    {
+      codec.append(frame.substr(i, 1));
+      EXPECT_FALSE(codec.next());
+    }
+
+  codec.append(frame.substr(frame.size() - 1));
+  auto payload = codec.next();
+  ASSERT_TRUE(payload);
+  EXPECT_EQ("hello", *payload);
+  EXPECT_EQ(0u, codec.getBuffered());
+}
+
+TEST(FrameCodecTest, SplitsCoalescedFrames)
+{
+  FrameCodec codec = FrameCodec::Builder{}.setLengthPrefixed(4).build();
+  // Two whole frames (one of them empty), and the start of a third.
+  codec.append(std::string{"\0\0\0\3one\0\0\0\0\0\0\0\5th", 17});
+
+  auto first = codec.next();
+  ASSERT_TRUE(first);
+  EXPECT_EQ("one", *first);
+  auto second = codec.next();
+  ASSERT_TRUE(second);
+  EXPECT_EQ("", *second);
+  EXPECT_FALSE(codec.next());
+  EXPECT_EQ(6u, codec.getBuffered());
+
+  codec.append("ree");
+  auto third = codec.next();
+  ASSERT_TRUE(third);
+  EXPECT_EQ("three", *third);
+}
+
+TEST(FrameCodecTest, FindsADelimiterSplitAcrossReads)
+{
+  FrameCodec codec = FrameCodec::Builder{}.setDelimited("\r\n").build();
+  codec.append("one\r\ntw");
+  auto first = codec.next();
+  ASSERT_TRUE(first);
+  EXPECT_EQ("one", *first);
+  EXPECT_FALSE(codec.next());
+
+  codec.append("o\r");
+  EXPECT_FALSE(codec.next());
+  codec.append("\nthree\r\n");
+  auto second = codec.next();
+  ASSERT_TRUE(second);
+  EXPECT_EQ("two", *second);
+  auto third = codec.next();
+  ASSERT_TRUE(third);
+  EXPECT_EQ("three", *third);
+  EXPECT_FALSE(codec.next());
+}
+
+TEST(FrameCodecTest, RejectsAnOversizeLengthPrefix)
+{
+  FrameCodec codec = FrameCodec::Builder{}.setLengthPrefixed(4)
+    .setMaxFrameSize(16).build();
+  // Before any of the payload has arrived.
+  codec.append(std::string{"\0\0\0\21", 4});
+  EXPECT_THROW(codec.next(), std::runtime_error);
+}
+
+TEST(FrameCodecTest, RejectsAnOversizeDelimitedFrame)
+{
+  FrameCodec codec = FrameCodec::Builder{}.setDelimited("\n")
+    .setMaxFrameSize(16).build();
+  codec.append("0123456789abcdef");
+  EXPECT_FALSE(codec.next());
+  codec.append("g");
+  EXPECT_THROW(codec.next(), std::runtime_error);
+}
+
+TEST(FrameCodecTest, RejectsInvalidConfigurations)
+{
+  EXPECT_THROW(FrameCodec::Builder{}.setLengthPrefixed(3).build(),
+               std::invalid_argument);
+  EXPECT_THROW(FrameCodec::Builder{}.setLengthPrefixed(1)
+               .setMaxFrameSize(256).build(), std::invalid_argument);
+  EXPECT_THROW(FrameCodec::Builder{}.setDelimited("").build(),
+               std::invalid_argument);
+}
+
+TEST(FrameCodecTest, ReadsWhatItWrites)
+{
+  int sockets[2];
+  ASSERT_EQ(0, ::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets));
+  {
+    FrameCodec codec = FrameCodec::Builder{}.setLengthPrefixed(2)
+      .setMaxFrameSize(1024).build();
+    Stream writer{sockets[0]};
+    Stream reader{sockets[1]};
+
+    codec.write(writer, "first");
+    codec.write(writer, std::string(1024, 'x'));
+    EXPECT_THROW(codec.write(writer, std::string(1025, 'x')),
+                 std::invalid_argument);
+    writer.flush();
+
+    std::string payloads;
+    unsigned int frames = 0;
+    while (2 > frames && 0 < codec.fill(reader))
+      {
+        while (auto payload = codec.next())
+          {
+            payloads += *payload;
+            ++frames;
+          }
+      }
+    EXPECT_EQ(2u, frames);
+    EXPECT_EQ("first" + std::string(1024, 'x'), payloads);
+  }
+  ::close(sockets[0]);
+  ::close(sockets[1]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
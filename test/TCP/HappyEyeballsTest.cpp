@@ -0,0 +1,196 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            HappyEyeballsTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of connectFirst(), against sockets on the loopback
+//                  interface that accept, refuse, or never answer.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include <Networking/FileDescriptor.h>
+#include <Networking/NetworkAddress.h>
+#include <Networking/TCP/HappyEyeballs.h>
+
+#include <cerrno>
+#include <chrono>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+using namespace Networking;
+using namespace Networking::TCP;
+using std::chrono::milliseconds;
+
+namespace
+{
+  // A socket bound to an ephemeral port of the loopback interface, which
+  // accepts connections, leaves them unanswered (its backlog being full), or
+  // refuses them (not listening at all).
+  struct Endpoint
+  {
+    enum Kind { ACCEPTING, UNANSWERED, REFUSING };
+
+    explicit Endpoint(Kind kind, const std::string& ip = "127.0.0.1")
+      : address{ip, 0}
+    {
+      socket = FileDescriptor{::socket(address.getFamily(), SOCK_STREAM, 0)};
+      struct sockaddr_storage bound{};
+      socklen_t length = sizeof(bound);
+      if (-1 == socket.get()
+          || -1 == ::bind(socket.get(), address.getSockAddr(),
+                          address.getSockAddrLength())
+          || (REFUSING != kind
+              && -1 == ::listen(socket.get(), ACCEPTING == kind ? 16 : 0))
+          || -1 == ::getsockname(socket.get(),
+                                 reinterpret_cast<struct sockaddr*>(&bound),
+                                 &length))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+      address = NetworkAddress{reinterpret_cast<struct sockaddr*>(&bound),
+                               length};
+
+      if (UNANSWERED == kind)
+        {
+          // Fills the backlog, after which the kernel drops further SYNs.
+          filler = connectFirst({address}, milliseconds{0},
+                                milliseconds{1000});
+        }
+    }
+
+    FileDescriptor socket;
+    NetworkAddress address;
+    FileDescriptor filler;
+  };
+
+  NetworkAddress getPeer(const FileDescriptor& socket)
+  {
+    struct sockaddr_storage peer{};
+    socklen_t length = sizeof(peer);
+    if (-1 == ::getpeername(socket.get(),
+                            reinterpret_cast<struct sockaddr*>(&peer),
+                            &length))
+      {
+        throw std::system_error{errno, std::generic_category()};
+      }
+    return NetworkAddress{reinterpret_cast<struct sockaddr*>(&peer), length};
+  }
+
+  // Whether the loopback interface has an IPv6 address to listen on.
+  bool hasIPv6Loopback()
+  {
+    try
+      {
+        Endpoint probe{Endpoint::REFUSING, "::1"};
+        return true;
+      }
+    catch (const std::system_error&)
+      {
+        return false;
+      }
+  }
+
+  milliseconds since(std::chrono::steady_clock::time_point start)
+  {
+    return std::chrono::duration_cast<milliseconds>
+      (std::chrono::steady_clock::now() - start);
+  }
+};
+
+TEST(HappyEyeballsTest, ReturnsTheConnectionInBlockingMode)
+{
+  Endpoint server{Endpoint::ACCEPTING};
+  FileDescriptor socket = connectFirst({server.address}, milliseconds{250},
+                                       milliseconds{1000});
+  ASSERT_TRUE(socket);
+  EXPECT_EQ(server.address, getPeer(socket));
+  EXPECT_EQ(0, ::fcntl(socket.get(), F_GETFL) & O_NONBLOCK);
+}
+
+TEST(HappyEyeballsTest, MovesOnAtOnceFromARefusedAddress)
+{
+  Endpoint refusing{Endpoint::REFUSING};
+  Endpoint server{Endpoint::ACCEPTING};
+  const auto start = std::chrono::steady_clock::now();
+  FileDescriptor socket = connectFirst({refusing.address, server.address},
+                                       milliseconds{5000},
+                                       milliseconds{5000});
+  EXPECT_GT(milliseconds{1000}, since(start));
+  EXPECT_EQ(server.address, getPeer(socket));
+}
+
+TEST(HappyEyeballsTest, StartsTheNextAttemptAfterTheDelay)
+{
+  Endpoint unanswered{Endpoint::UNANSWERED};
+  Endpoint server{Endpoint::ACCEPTING};
+  const auto start = std::chrono::steady_clock::now();
+  // The first attempt is still in flight when the second wins.
+  FileDescriptor socket = connectFirst({unanswered.address, server.address},
+                                       milliseconds{50},
+                                       milliseconds{5000});
+  EXPECT_LE(milliseconds{50}, since(start));
+  EXPECT_GT(milliseconds{1000}, since(start));
+  EXPECT_EQ(server.address, getPeer(socket));
+}
+
+TEST(HappyEyeballsTest, AbandonsAnAttemptAfterItsTimeout)
+{
+  Endpoint unanswered{Endpoint::UNANSWERED};
+  Endpoint server{Endpoint::ACCEPTING};
+  const auto start = std::chrono::steady_clock::now();
+  FileDescriptor socket = connectFirst({unanswered.address, server.address},
+                                       milliseconds{5000},
+                                       milliseconds{100});
+  EXPECT_LE(milliseconds{100}, since(start));
+  EXPECT_GT(milliseconds{1000}, since(start));
+  EXPECT_EQ(server.address, getPeer(socket));
+}
+
+TEST(HappyEyeballsTest, AlternatesBetweenAddressFamilies)
+{
+  if (!hasIPv6Loopback())
+    {
+      GTEST_SKIP() << "No IPv6 loopback address";
+    }
+
+  Endpoint unanswered{Endpoint::UNANSWERED, "::1"};
+  Endpoint server6{Endpoint::ACCEPTING, "::1"};
+  Endpoint server4{Endpoint::ACCEPTING, "127.0.0.1"};
+  // In the order given, the second IPv6 address would be tried next.
+  FileDescriptor socket = connectFirst({unanswered.address, server6.address,
+                                        server4.address},
+                                       milliseconds{50},
+                                       milliseconds{5000});
+  EXPECT_EQ(server4.address, getPeer(socket));
+}
+
+TEST(HappyEyeballsTest, ThrowsListingEveryFailure)
+{
+  Endpoint refusing{Endpoint::REFUSING};
+  Endpoint unanswered{Endpoint::UNANSWERED};
+  try
+    {
+      connectFirst({refusing.address, unanswered.address},
+                   milliseconds{50}, milliseconds{100});
+      FAIL() << "connectFirst() did not throw";
+    }
+  catch (const std::system_error& e)
+    {
+      const std::string what = e.what();
+      EXPECT_NE(std::string::npos, what.find(refusing.address.string()));
+      EXPECT_NE(std::string::npos, what.find(unanswered.address.string()));
+      EXPECT_EQ(ETIMEDOUT, e.code().value());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
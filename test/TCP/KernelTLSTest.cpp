@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            KernelTLSTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the configuration and checking of kernel TLS.
+//                  Connections over memory BIOs are never offloaded, which
+//                  exercises the report of why not.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include "TLSTestContext.h"
+
+#include <Networking/TCP/KernelTLS.h>
+
+#include <memory>
+#include <string>
+
+#include <openssl/ssl.h>
+
+using namespace Networking::TCP;
+
+TEST(KernelTLSTest, IsNotEnabledByDefault)
+{
+  std::shared_ptr<SSL_CTX> context = TLSTestContext::makeServerContext();
+  configureKernelTLS(context.get(), KTLS_DISABLED);
+#ifdef SSL_OP_ENABLE_KTLS
+  EXPECT_EQ(0u, SSL_CTX_get_options(context.get()) & SSL_OP_ENABLE_KTLS);
+#endif
+}
+
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+TEST(KernelTLSTest, IsEnabledWhenPreferred)
+{
+  std::shared_ptr<SSL_CTX> context = TLSTestContext::makeServerContext();
+  configureKernelTLS(context.get(), KTLS_PREFERRED);
+  EXPECT_NE(0u, SSL_CTX_get_options(context.get()) & SSL_OP_ENABLE_KTLS);
+}
+#endif
+
+TEST(KernelTLSTest, ReportsWhatWasNotOffloaded)
+{
+  std::shared_ptr<SSL_CTX> server = TLSTestContext::makeServerContext();
+  std::shared_ptr<SSL_CTX> client = TLSTestContext::makeClientContext();
+  configureKernelTLS(server.get(), KTLS_PREFERRED);
+  TLSTestContext::Connection connection
+    = TLSTestContext::connect(client.get(), server.get());
+  ASSERT_TRUE(connection.connected);
+
+  const std::string report = checkKernelTLS(connection.server.get());
+  EXPECT_NE(std::string::npos, report.find("writes or reads"));
+  EXPECT_NE(std::string::npos,
+            report.find(SSL_get_version(connection.server.get())));
+  EXPECT_NE(std::string::npos,
+            report.find(SSL_get_cipher_name(connection.server.get())));
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,68 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            LoopbackClient.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     A blocking client socket, connected to a listener on the
+//                  loopback interface.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_LOOPBACKCLIENT__
+#define __ET_LOOPBACKCLIENT__
+
+#include <system_error>
+
+#include <errno.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+class LoopbackClient
+{
+public:
+  // Connects to the address that listeningSocket is bound to.
+  explicit LoopbackClient(int listeningSocket)
+    : m_socket{::socket(AF_INET, SOCK_STREAM, 0)}
+  {
+    struct sockaddr_in address{};
+    socklen_t length = sizeof(address);
+    if (-1 == m_socket
+        || -1 == ::getsockname(listeningSocket,
+                               reinterpret_cast<struct sockaddr*>(&address),
+                               &length)
+        || -1 == ::connect(m_socket,
+                           reinterpret_cast<struct sockaddr*>(&address),
+                           length))
+      {
+        const int error = errno;
+        if (-1 != m_socket)
+          {
+            ::close(m_socket);
+          }
+        throw std::system_error{error, std::generic_category()};
+      }
+  }
+
+  LoopbackClient(const LoopbackClient&) = delete;
+  LoopbackClient& operator=(const LoopbackClient&) = delete;
+  ~LoopbackClient()
+  {
+    ::close(m_socket);
+  }
+
+  int getDescriptor() const
+  {
+    return m_socket;
+  }
+
+private:
+  int m_socket;
+};
+
+#endif // __ET_LOOPBACKCLIENT__
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            StreamTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the buffered Stream, over a pair of connected
+//                  sockets.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include <Networking/RequestPool.h>
+#include <Networking/TCP/Stream.h>
+
+#include <memory>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+using namespace Networking;
+using namespace Networking::TCP;
+
+class StreamTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    ASSERT_EQ(0, ::socketpair(AF_UNIX, SOCK_STREAM, 0, m_sockets));
+  }
+
+  void TearDown() override
+  {
+    ::close(m_sockets[0]);
+    ::close(m_sockets[1]);
+  }
+
+  // Everything available on the peer's end, without waiting.
+  std::string drainPeer()
+  {
+    std::string data;
+    char buffer[256];
+    ssize_t length;
+    while (0 < (length = ::recv(m_sockets[1], buffer, sizeof(buffer),
+                                MSG_DONTWAIT)))
+      {
+        data.append(buffer, length);
+      }
+    return data;
+  }
+
+  int m_sockets[2];
+};
+
+TEST_F(StreamTest, WritesAreBufferedUntilFlushed)
+{
+  Stream stream{m_sockets[0]};
+  stream.write("hello, ", 7);
+  stream.write("world", 5);
+  EXPECT_EQ("", drainPeer());
+
+  stream.flush();
+  EXPECT_EQ("hello, world", drainPeer());
+}
+
+TEST_F(StreamTest, WritevSendsWhatDoesNotFitAlongWithTheBuffer)
+{
+  auto pool = RequestPool::create(16);
+  Stream stream{m_sockets[0], pool};
+  ASSERT_EQ(16u, stream.getBufferSize());
+
+  stream.write("head:", 5);
+  std::string first(10, 'a');
+  std::string second(10, 'b');
+  struct iovec vector[2] = {
+    {&first[0], first.size()},
+    {&second[0], second.size()},
+  };
+  stream.writev(vector, 2);
+  EXPECT_EQ("head:" + first + second, drainPeer());
+}
+
+TEST_F(StreamTest, ReadsAheadIntoTheBuffer)
+{
+  const std::string message = "0123456789";
+  ASSERT_EQ(static_cast<ssize_t>(message.size()),
+            ::send(m_sockets[1], message.data(), message.size(), 0));
+
+  Stream stream{m_sockets[0]};
+  char first[4];
+  char second[3];
+  struct iovec vector[2] = {{first, sizeof(first)}, {second, sizeof(second)}};
+  ASSERT_EQ(7u, stream.readv(vector, 2));
+  EXPECT_EQ("0123", std::string(first, sizeof(first)));
+  EXPECT_EQ("456", std::string(second, sizeof(second)));
+
+  // The rest was read ahead: served from the buffer, even after the peer
+  // has gone.
+  ::shutdown(m_sockets[1], SHUT_WR);
+  char rest[16];
+  ASSERT_EQ(3u, stream.read(rest, sizeof(rest)));
+  EXPECT_EQ("789", std::string(rest, 3));
+  EXPECT_FALSE(stream.atEnd());
+
+  EXPECT_EQ(0u, stream.read(rest, sizeof(rest)));
+  EXPECT_TRUE(stream.atEnd());
+}
+
+TEST_F(StreamTest, NonBlockingReadTellsNothingAvailableFromTheEnd)
+{
+  ::fcntl(m_sockets[0], F_SETFL,
+          ::fcntl(m_sockets[0], F_GETFL) | O_NONBLOCK);
+  Stream stream{m_sockets[0]};
+  char data[8];
+  EXPECT_EQ(0u, stream.read(data, sizeof(data)));
+  EXPECT_FALSE(stream.atEnd());
+
+  ::shutdown(m_sockets[1], SHUT_WR);
+  EXPECT_EQ(0u, stream.read(data, sizeof(data)));
+  EXPECT_TRUE(stream.atEnd());
+}
+
+TEST_F(StreamTest, DestructionFlushesWhatIsLeft)
+{
+  {
+    Stream stream{m_sockets[0]};
+    stream.write("pending", 7);
+  }
+  EXPECT_EQ("pending", drainPeer());
+}
+
+TEST_F(StreamTest, CorkingOnAUnixSocketThrows)
+{
+  Stream stream{m_sockets[0]};
+  EXPECT_THROW(stream.setCork(true), std::system_error);
+  EXPECT_FALSE(stream.isCorked());
+}
+
+///////////////////////////////////////////////////////////////////////////////
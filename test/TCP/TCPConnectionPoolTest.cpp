@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TCPConnectionPoolTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the TCPConnectionPool's reuse of connections,
+//                  its per-host limits, and its timeouts. Connections are
+//                  made to listening sockets on the loopback interface,
+//                  whose backlog completes them.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include <Networking/FileDescriptor.h>
+#include <Networking/NetworkAddress.h>
+#include <Networking/TCP/TCPConnectionPool.h>
+
+#include <cerrno>
+#include <chrono>
+#include <system_error>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+using namespace Networking;
+using namespace Networking::TCP;
+using std::chrono::milliseconds;
+
+using Pool = TCPConnectionPool<NetworkAddress>;
+
+class TCPConnectionPoolTest : public ::testing::Test
+{
+protected:
+  // A socket listening on an ephemeral port of the loopback interface.
+  struct Listener
+  {
+    Listener()
+      : socket{::socket(AF_INET, SOCK_STREAM, 0)}, address{0x7f000001u, 0}
+    {
+      struct sockaddr_in bound{};
+      socklen_t length = sizeof(bound);
+      if (-1 == socket.get()
+          || -1 == ::bind(socket.get(), address.getSockAddr(),
+                          address.getSockAddrLength())
+          || -1 == ::listen(socket.get(), 16)
+          || -1 == ::getsockname(socket.get(),
+                                 reinterpret_cast<struct sockaddr*>(&bound),
+                                 &length))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+      address = NetworkAddress{bound};
+    }
+
+    // The server's end of the next connection.
+    FileDescriptor accept() const
+    {
+      return FileDescriptor{::accept(socket.get(), nullptr, nullptr)};
+    }
+
+    FileDescriptor socket;
+    NetworkAddress address;
+  };
+
+  Listener m_host;
+};
+
+TEST_F(TCPConnectionPoolTest, ReusesReturnedConnections)
+{
+  Pool pool = Pool::Builder{}.build();
+  for (int i = 0; i < 3; ++i)
+    {
+      Pool::Connection connection = pool.checkout(m_host.address);
+      ASSERT_TRUE(connection);
+    }
+
+  Pool::Statistics statistics = pool.getStatistics();
+  EXPECT_EQ(1u, statistics.created);
+  EXPECT_EQ(2u, statistics.reused);
+  EXPECT_EQ(1u, statistics.idle);
+  EXPECT_EQ(0u, statistics.checkedOut);
+}
+
+TEST_F(TCPConnectionPoolTest, TimesOutAtTheLimitOfAHost)
+{
+  const milliseconds timeout{100};
+  Pool pool = Pool::Builder{}.setMaxConnectionsPerHost(2)
+    .setCheckoutTimeout(timeout).build();
+  Pool::Connection first = pool.checkout(m_host.address);
+  Pool::Connection second = pool.checkout(m_host.address);
+
+  const auto start = std::chrono::steady_clock::now();
+  try
+    {
+      pool.checkout(m_host.address);
+      FAIL() << "checked out more than the limit";
+    }
+  catch (const std::system_error& e)
+    {
+      EXPECT_EQ(ETIMEDOUT, e.code().value());
+    }
+  EXPECT_LE(timeout, std::chrono::steady_clock::now() - start);
+
+  // The limit is per host.
+  Listener other;
+  EXPECT_TRUE(pool.checkout(other.address));
+
+  Pool::Statistics statistics = pool.getStatistics();
+  EXPECT_EQ(1u, statistics.waits);
+  EXPECT_EQ(1u, statistics.timeouts);
+  EXPECT_EQ(2u, statistics.checkedOut);
+}
+
+TEST_F(TCPConnectionPoolTest, WaitsForAConnectionToBeReturned)
+{
+  Pool pool = Pool::Builder{}.setMaxConnectionsPerHost(1)
+    .setCheckoutTimeout(milliseconds{5000}).build();
+  Pool::Connection first = pool.checkout(m_host.address);
+  const int socket = first.get();
+
+  std::thread returner{[&first]()
+    {
+      std::this_thread::sleep_for(milliseconds{50});
+      Pool::Connection returned = std::move(first);
+    }};
+  Pool::Connection second = pool.checkout(m_host.address);
+  returner.join();
+
+  EXPECT_EQ(socket, second.get());
+  Pool::Statistics statistics = pool.getStatistics();
+  EXPECT_EQ(1u, statistics.created);
+  EXPECT_EQ(1u, statistics.reused);
+  EXPECT_EQ(1u, statistics.waits);
+  EXPECT_EQ(0u, statistics.timeouts);
+}
+
+TEST_F(TCPConnectionPoolTest, KeepsAtMostMaxIdlePerHost)
+{
+  Pool pool = Pool::Builder{}.setMaxIdlePerHost(1).build();
+  {
+    Pool::Connection first = pool.checkout(m_host.address);
+    Pool::Connection second = pool.checkout(m_host.address);
+  }
+  EXPECT_EQ(1u, pool.getStatistics().idle);
+
+  pool.closeIdleConnections();
+  EXPECT_EQ(0u, pool.getStatistics().idle);
+}
+
+TEST_F(TCPConnectionPoolTest, ExpiresIdleConnections)
+{
+  Pool pool = Pool::Builder{}.setMaxIdleTime(std::chrono::seconds{0})
+    .build();
+  pool.checkout(m_host.address);
+  pool.checkout(m_host.address);
+
+  Pool::Statistics statistics = pool.getStatistics();
+  EXPECT_EQ(2u, statistics.created);
+  EXPECT_EQ(0u, statistics.reused);
+  EXPECT_EQ(1u, statistics.expired);
+}
+
+TEST_F(TCPConnectionPoolTest, EvictsConnectionsClosedByThePeer)
+{
+  Pool pool = Pool::Builder{}.build();
+  pool.checkout(m_host.address);
+  m_host.accept().reset();
+
+  Pool::Connection connection = pool.checkout(m_host.address);
+  EXPECT_TRUE(connection);
+  Pool::Statistics statistics = pool.getStatistics();
+  EXPECT_EQ(2u, statistics.created);
+  EXPECT_EQ(1u, statistics.evicted);
+}
+
+TEST_F(TCPConnectionPoolTest, ClosesDiscardedConnections)
+{
+  Pool pool = Pool::Builder{}.build();
+  {
+    Pool::Connection connection = pool.checkout(m_host.address);
+    connection.discard();
+  }
+  EXPECT_EQ(0u, pool.getStatistics().idle);
+
+  pool.checkout(m_host.address);
+  EXPECT_EQ(2u, pool.getStatistics().created);
+}
+
+///////////////////////////////////////////////////////////////////////////////
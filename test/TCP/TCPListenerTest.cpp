@@ -0,0 +1,152 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TCPListenerTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the TCP listener, against clients on the loopback
+//                  interface.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include "LoopbackClient.h"
+
+#include <Networking/NetworkAddress.h>
+#include <Networking/PeerAddress.h>
+#include <Networking/TCP/TCPListener.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/socket.h>
+
+using namespace Networking;
+using namespace Networking::TCP;
+
+namespace
+{
+  class TCPListenerTest : public ::testing::Test
+  {
+  protected:
+    auto makeListener(bool blocking)
+    {
+      return TCPListener<NetworkAddress>::Builder()
+        .setListeningAddress(NetworkAddress{"127.0.0.1", 0})
+        .setBlocking(blocking)
+        .setUserHandler([this](unsigned int, const NetworkAddress& client)
+          {
+            clients.push_back(client.string());
+          })
+        .build();
+    }
+
+    void connect(int listeningSocket, unsigned int count)
+    {
+      for (unsigned int i = 0; i < count; ++i)
+        {
+          connections.push_back
+            (std::make_unique<LoopbackClient>(listeningSocket));
+        }
+    }
+
+    std::vector<std::string> clients;
+    std::vector<std::unique_ptr<LoopbackClient>> connections;
+  };
+};
+
+TEST_F(TCPListenerTest, ListenBatchAcceptsEveryPendingConnection)
+{
+  auto listener = makeListener(false);
+  connect(listener.getDescriptor(), 5);
+
+  std::vector<std::unique_ptr<Interfaces::IRequest>> batch;
+  EXPECT_EQ(5u, listener.listenBatch(batch, 16));
+  ASSERT_EQ(5u, batch.size());
+  for (auto& request : batch)
+    {
+      request->handle();
+    }
+  EXPECT_EQ(5u, clients.size());
+
+  // The backlog is empty, and a non-blocking listener does not wait.
+  EXPECT_EQ(0u, listener.listenBatch(batch, 16));
+  EXPECT_EQ(5u, batch.size());
+}
+
+TEST_F(TCPListenerTest, ListenBatchStopsAtTheLimit)
+{
+  auto listener = makeListener(false);
+  connect(listener.getDescriptor(), 5);
+
+  std::vector<std::unique_ptr<Interfaces::IRequest>> batch;
+  EXPECT_EQ(2u, listener.listenBatch(batch, 2));
+  EXPECT_EQ(3u, listener.listenBatch(batch, 16));
+  EXPECT_EQ(5u, batch.size());
+}
+
+TEST_F(TCPListenerTest, BlockingListenerAcceptsOneAtATime)
+{
+  auto listener = makeListener(true);
+  connect(listener.getDescriptor(), 2);
+
+  std::vector<std::unique_ptr<Interfaces::IRequest>> batch;
+  EXPECT_EQ(1u, listener.listenBatch(batch, 16));
+  EXPECT_EQ(1u, listener.listenBatch(batch, 16));
+  EXPECT_EQ(2u, batch.size());
+}
+
+TEST_F(TCPListenerTest, TakesAnyCallableAsItsHandler)
+{
+  unsigned int handled = 0;
+  auto handler = [&handled](unsigned int, const NetworkAddress&)
+    {
+      ++handled;
+    };
+  using Listener = TCPListener<NetworkAddress, decltype(handler)>;
+  auto listener = Listener::Builder()
+    .setListeningAddress(NetworkAddress{"127.0.0.1", 0})
+    .setUserHandler(handler)
+    .build();
+  connect(listener.getDescriptor(), 1);
+
+  listener.listen()->handle();
+  EXPECT_EQ(1u, handled);
+}
+
+TEST_F(TCPListenerTest, RequiresAHandlerThatHasNoDefault)
+{
+  auto handler = [this](unsigned int, const NetworkAddress&) {};
+  using Listener = TCPListener<NetworkAddress, decltype(handler)>;
+  EXPECT_THROW(Listener::Builder()
+               .setListeningAddress(NetworkAddress{"127.0.0.1", 0})
+               .build(), std::logic_error);
+}
+
+TEST_F(TCPListenerTest, HandsThePeerAddressToHandlersThatTakeIt)
+{
+  PeerAddress peer;
+  auto handler = [&peer](unsigned int, const PeerAddress& client)
+    {
+      peer = client;
+    };
+  using Listener = TCPListener<NetworkAddress, decltype(handler)>;
+  auto listener = Listener::Builder()
+    .setListeningAddress(NetworkAddress{"127.0.0.1", 0})
+    .setUserHandler(handler)
+    .build();
+  LoopbackClient client{listener.getDescriptor()};
+
+  listener.listen()->handle();
+  PeerAddress local;
+  ASSERT_EQ(0, ::getsockname(client.getDescriptor(), local.getSockAddr(),
+                             &local.getLength()));
+  EXPECT_EQ(local.string(), peer.string());
+}
+
+///////////////////////////////////////////////////////////////////////////////
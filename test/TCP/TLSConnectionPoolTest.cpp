@@ -0,0 +1,185 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSConnectionPoolTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the client-side pool of idle TLS connections,
+//                  over socket pairs.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include "TLSTestContext.h"
+
+#include <Networking/TCP/TLSConnectionPool.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <openssl/bio.h>
+#include <openssl/ssl.h>
+
+using namespace Networking::TCP;
+
+namespace
+{
+  class TLSConnectionPoolTest : public ::testing::Test
+  {
+  protected:
+    ~TLSConnectionPoolTest()
+    {
+      // Before the client context, which the idle connections refer to.
+      pool.reset();
+      for (SSL* ssl : servers)
+        {
+          ::close(SSL_get_fd(ssl));
+          SSL_free(ssl);
+        }
+    }
+
+    void attach(std::size_t maxIdlePerHost,
+                std::chrono::seconds maxIdleTime = std::chrono::seconds{60},
+                std::chrono::seconds maxLifetime = std::chrono::seconds{60})
+    {
+      pool = TLSConnectionPool::attach(client.get(), maxIdlePerHost,
+                                       maxIdleTime, maxLifetime, true);
+    }
+
+    // Opens a connection to host, as TLSClient does, over a socket pair
+    // whose other end is served by a server of our own.
+    BIO* open(const std::string& host)
+    {
+      int fds[2];
+      if (0 != ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+      SSL* server = SSL_new(serverContext.get());
+      SSL_set_fd(server, fds[1]);
+      SSL_set_accept_state(server);
+      servers.push_back(server);
+
+      BIO* bio = BIO_new_ssl(client.get(), 1);
+      BIO_push(bio, BIO_new_socket(fds[0], BIO_CLOSE));
+      SSL* ssl = nullptr;
+      BIO_get_ssl(bio, &ssl);
+      pool->prepare(ssl, host);
+
+      bool clientDone = false;
+      bool serverDone = false;
+      for (int i = 0; i < 32 && !(clientDone && serverDone); ++i)
+        {
+          clientDone = clientDone || 0 < BIO_do_handshake(bio);
+          serverDone = serverDone || 0 < SSL_do_handshake(server);
+        }
+      if (!clientDone || !serverDone)
+        {
+          BIO_free_all(bio);
+          throw std::runtime_error{"TLSConnectionPoolTest: handshake failed"};
+        }
+      pool->connected(ssl);
+      return bio;
+    }
+
+    std::shared_ptr<SSL_CTX> serverContext
+      = TLSTestContext::makeServerContext();
+    std::shared_ptr<SSL_CTX> client = TLSTestContext::makeClientContext();
+    std::unique_ptr<TLSConnectionPool> pool;
+    std::vector<SSL*> servers;
+  };
+};
+
+TEST_F(TLSConnectionPoolTest, ChecksOutTheConnectionCheckedIn)
+{
+  attach(2);
+  BIO* bio = open("a");
+  pool->checkin(bio);
+  EXPECT_EQ(1u, pool->getStatistics().idle);
+
+  EXPECT_EQ(nullptr, pool->checkout("b"));
+  BIO* reused = pool->checkout("a");
+  EXPECT_EQ(bio, reused);
+  EXPECT_EQ(1u, pool->getStatistics().reused);
+  EXPECT_EQ(0u, pool->getStatistics().idle);
+  pool->checkin(reused);
+}
+
+TEST_F(TLSConnectionPoolTest, KeepsAtMostMaxIdlePerHost)
+{
+  attach(2);
+  BIO* first = open("a");
+  BIO* second = open("a");
+  BIO* third = open("a");
+  BIO* other = open("b");
+  pool->checkin(first);
+  pool->checkin(second);
+  pool->checkin(third);
+  pool->checkin(other);
+  EXPECT_EQ(3u, pool->getStatistics().idle);
+
+  // The least recently checked in was dropped; the most recent comes first.
+  EXPECT_EQ(third, pool->checkout("a"));
+  EXPECT_EQ(second, pool->checkout("a"));
+  EXPECT_EQ(nullptr, pool->checkout("a"));
+  pool->checkin(second);
+  pool->checkin(third);
+}
+
+TEST_F(TLSConnectionPoolTest, DropsConnectionsClosedByThePeer)
+{
+  attach(2);
+  pool->checkin(open("a"));
+  // The server's close_notify is waiting on the idle connection.
+  SSL_shutdown(servers.back());
+
+  EXPECT_EQ(nullptr, pool->checkout("a"));
+  EXPECT_EQ(1u, pool->getStatistics().unhealthy);
+  EXPECT_EQ(0u, pool->getStatistics().idle);
+}
+
+TEST_F(TLSConnectionPoolTest, DropsConnectionsIdleForTooLong)
+{
+  attach(2, std::chrono::seconds{0});
+  pool->checkin(open("a"));
+  EXPECT_EQ(nullptr, pool->checkout("a"));
+  EXPECT_EQ(1u, pool->getStatistics().expired);
+}
+
+TEST_F(TLSConnectionPoolTest, DropsConnectionsOpenForTooLong)
+{
+  attach(2, std::chrono::seconds{60}, std::chrono::seconds{0});
+  pool->checkin(open("a"));
+  EXPECT_EQ(1u, pool->getStatistics().expired);
+  EXPECT_EQ(0u, pool->getStatistics().idle);
+}
+
+TEST_F(TLSConnectionPoolTest, ResumesTheLastSessionWithAHost)
+{
+  // TLS 1.2 sessions are complete when the handshake is, whereas TLS 1.3
+  // tickets arrive after it.
+  SSL_CTX_set_max_proto_version(client.get(), TLS1_2_VERSION);
+  attach(0);
+  BIO_free_all(open("a"));
+  BIO_free_all(open("a"));
+  BIO_free_all(open("b"));
+  EXPECT_EQ(2u, pool->getStatistics().fullHandshakes);
+  EXPECT_EQ(1u, pool->getStatistics().resumedHandshakes);
+
+  pool->clear();
+  BIO_free_all(open("a"));
+  EXPECT_EQ(3u, pool->getStatistics().fullHandshakes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSHandshakeTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the non-blocking, deadline-bound TLS handshake,
+//                  over socket pairs.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include "TLSTestContext.h"
+
+#include <Networking/EventLoop.h>
+#include <Networking/TCP/TLSHandshake.h>
+
+#include <cerrno>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <openssl/ssl.h>
+
+using namespace Networking;
+using namespace Networking::TCP;
+using std::chrono::milliseconds;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+  // The server's end of a socket pair is non-blocking, as the listener's
+  // sockets are; the client's end is blocking.
+  class TLSHandshakeTest : public ::testing::Test
+  {
+  protected:
+    TLSHandshakeTest()
+    {
+      if (0 != ::socketpair(AF_UNIX, SOCK_STREAM, 0, fds)
+          || -1 == ::fcntl(fds[0], F_SETFL,
+                           ::fcntl(fds[0], F_GETFL) | O_NONBLOCK))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+      SSL_set_fd(server.get(), fds[0]);
+      SSL_set_accept_state(server.get());
+      SSL_set_fd(client.get(), fds[1]);
+    }
+
+    ~TLSHandshakeTest()
+    {
+      ::close(fds[0]);
+      ::close(fds[1]);
+    }
+
+    int fds[2];
+    std::shared_ptr<SSL_CTX> serverContext
+      = TLSTestContext::makeServerContext();
+    std::shared_ptr<SSL_CTX> clientContext
+      = TLSTestContext::makeClientContext();
+    std::unique_ptr<SSL, void(*)(SSL*)> server{SSL_new(serverContext.get()),
+                                               SSL_free};
+    std::unique_ptr<SSL, void(*)(SSL*)> client{SSL_new(clientContext.get()),
+                                               SSL_free};
+  };
+};
+
+TEST_F(TLSHandshakeTest, CompletesAgainstAClient)
+{
+  auto connected = std::async(std::launch::async, [this]()
+    {
+      return SSL_connect(client.get());
+    });
+  TLSHandshake handshake{server.get(), Clock::now() + milliseconds{5000}};
+  EXPECT_EQ(TLSHandshake::COMPLETE, handshake.run());
+  EXPECT_TRUE(handshake.isOver());
+  EXPECT_EQ(1, connected.get());
+}
+
+TEST_F(TLSHandshakeTest, WaitsToReadTheClientHello)
+{
+  TLSHandshake handshake{server.get(), Clock::now() + milliseconds{5000}};
+  EXPECT_EQ(TLSHandshake::WANT_READ, handshake.step());
+  EXPECT_FALSE(handshake.isOver());
+  EXPECT_EQ(EventLoop::READABLE, handshake.getEvents());
+
+  handshake.expire();
+  EXPECT_EQ(TLSHandshake::TIMED_OUT, handshake.getStatus());
+  EXPECT_TRUE(handshake.isOver());
+  // Once over, stepping does nothing.
+  EXPECT_EQ(TLSHandshake::TIMED_OUT, handshake.step());
+}
+
+TEST_F(TLSHandshakeTest, TimesOutAtTheDeadline)
+{
+  // The client never says anything.
+  const auto start = Clock::now();
+  TLSHandshake handshake{server.get(), start + milliseconds{100}};
+  EXPECT_EQ(TLSHandshake::TIMED_OUT, handshake.run());
+  EXPECT_LE(milliseconds{100}, Clock::now() - start);
+  EXPECT_GT(milliseconds{2000}, Clock::now() - start);
+}
+
+TEST_F(TLSHandshakeTest, TimesOutIfTheDeadlineHasPassed)
+{
+  TLSHandshake handshake{server.get(), Clock::now() - milliseconds{1}};
+  EXPECT_EQ(TLSHandshake::TIMED_OUT, handshake.step());
+}
+
+TEST_F(TLSHandshakeTest, FailsAgainstAClientThatIsNotTLS)
+{
+  const char request[] = "GET / HTTP/1.1\r\n\r\n";
+  ASSERT_EQ(static_cast<ssize_t>(sizeof(request) - 1),
+            ::write(fds[1], request, sizeof(request) - 1));
+  TLSHandshake handshake{server.get(), Clock::now() + milliseconds{5000}};
+  EXPECT_EQ(TLSHandshake::FAILED, handshake.run());
+  EXPECT_FALSE(handshake.getErrors().empty());
+}
+
+TEST_F(TLSHandshakeTest, FailsIfTheClientHangsUp)
+{
+  ::shutdown(fds[1], SHUT_WR);
+  TLSHandshake handshake{server.get(), Clock::now() + milliseconds{5000}};
+  EXPECT_EQ(TLSHandshake::FAILED, handshake.run());
+  EXPECT_FALSE(handshake.getErrors().empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,92 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSListenerTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the TLS listener, against clients on the
+//                  loopback interface.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include "LoopbackClient.h"
+#include "TLSTestContext.h"
+
+#include <Networking/DelegatorMT.h>
+#include <Networking/NetworkAddress.h>
+#include <Networking/TCP/TLSListener.h>
+
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <openssl/ssl.h>
+
+using namespace Networking;
+using namespace Networking::TCP;
+
+TEST(TLSListenerTest, HandlesConcurrentConnectionsOnTheirOwnSSL)
+{
+  TLSTestContext::CredentialFiles files;
+  // Echoes one byte back, on whichever thread the delegator picks.
+  auto listener = TLSListener<NetworkAddress>::Builder()
+    .setListeningAddress(NetworkAddress{"127.0.0.1", 0})
+    .setBacklogSize(32)
+    .setCertificateFile(files.getCertificateFile())
+    .setPrivateKeyFile(files.getPrivateKeyFile())
+    .setUserHandler([](SSL* ssl, const NetworkAddress&)
+      {
+        char byte;
+        if (1 == SSL_read(ssl, &byte, 1))
+          {
+            SSL_write(ssl, &byte, 1);
+          }
+      })
+    .build();
+  std::shared_ptr<SSL_CTX> context = TLSTestContext::makeClientContext();
+
+  static constexpr int COUNT = 16;
+  std::vector<std::future<char>> echoes;
+  {
+    // Destroyed, and so drained, before the listener.
+    DelegatorMT delegator{4, COUNT};
+    const int listeningSocket = listener.getDescriptor();
+    for (int i = 0; i < COUNT; ++i)
+      {
+        echoes.push_back(std::async(std::launch::async,
+                                    [&context, listeningSocket, i]()
+          {
+            LoopbackClient client{listeningSocket};
+            std::unique_ptr<SSL, void(*)(SSL*)> ssl{SSL_new(context.get()),
+                                                    SSL_free};
+            SSL_set_fd(ssl.get(), client.getDescriptor());
+            char byte = static_cast<char>('a' + i);
+            if (1 != SSL_connect(ssl.get())
+                || 1 != SSL_write(ssl.get(), &byte, 1)
+                || 1 != SSL_read(ssl.get(), &byte, 1))
+              {
+                return '\0';
+              }
+            return byte;
+          }));
+      }
+    for (int i = 0; i < COUNT; ++i)
+      {
+        delegator.dispatch(listener.listen());
+      }
+
+    for (int i = 0; i < COUNT; ++i)
+      {
+        EXPECT_EQ(static_cast<char>('a' + i), echoes[i].get());
+      }
+  }
+
+  const auto statistics = listener.getSessionStatistics();
+  EXPECT_EQ(static_cast<std::uint64_t>(COUNT), statistics.fullHandshakes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
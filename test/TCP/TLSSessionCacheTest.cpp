@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSSessionCacheTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the sharded server-side TLS session cache.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include "TLSTestContext.h"
+
+#include <Networking/TCP/TLSSessionCache.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <openssl/ssl.h>
+
+using namespace Networking::TCP;
+
+namespace
+{
+  class TLSSessionCacheTest : public ::testing::Test
+  {
+  protected:
+    // Under TLS 1.2 without tickets, a session keeps its ID when resumed,
+    // whereas TLS 1.3 replaces it with a new session at each handshake.
+    TLSSessionCache& attach(std::size_t capacity, unsigned int numShards)
+    {
+      SSL_CTX_set_options(server.get(), SSL_OP_NO_TICKET);
+      SSL_CTX_set_max_proto_version(client.get(), TLS1_2_VERSION);
+      return TLSSessionCache::attach(server.get(), capacity, numShards);
+    }
+
+    TLSTestContext::Result connect(SSL_SESSION* session = nullptr)
+    {
+      return TLSTestContext::handshake(client.get(), server.get(), session);
+    }
+
+    std::shared_ptr<SSL_CTX> server = TLSTestContext::makeServerContext();
+    std::shared_ptr<SSL_CTX> client = TLSTestContext::makeClientContext();
+  };
+};
+
+TEST_F(TLSSessionCacheTest, ResumesCachedSessions)
+{
+  TLSSessionCache& cache = attach(16, 4);
+  TLSTestContext::Result first = connect();
+  ASSERT_TRUE(first.connected);
+  EXPECT_FALSE(first.reused);
+  EXPECT_EQ(1u, cache.getStatistics().size);
+
+  TLSTestContext::Result second = connect(first.session.get());
+  ASSERT_TRUE(second.connected);
+  EXPECT_TRUE(second.reused);
+  EXPECT_EQ(1u, cache.getStatistics().hits);
+  EXPECT_EQ(0u, cache.getStatistics().misses);
+}
+
+TEST_F(TLSSessionCacheTest, MissesSessionsItDoesNotHold)
+{
+  // A session from another server, with a cache of its own.
+  std::shared_ptr<SSL_CTX> other = TLSTestContext::makeServerContext();
+  SSL_CTX_set_options(other.get(), SSL_OP_NO_TICKET);
+  SSL_CTX_set_max_proto_version(client.get(), TLS1_2_VERSION);
+  TLSSessionCache::attach(other.get(), 16, 4);
+  TLSTestContext::Result foreign
+    = TLSTestContext::handshake(client.get(), other.get());
+  ASSERT_TRUE(foreign.connected);
+
+  TLSSessionCache& cache = attach(16, 4);
+  TLSTestContext::Result result = connect(foreign.session.get());
+  ASSERT_TRUE(result.connected);
+  EXPECT_FALSE(result.reused);
+  EXPECT_EQ(0u, cache.getStatistics().hits);
+  EXPECT_EQ(1u, cache.getStatistics().misses);
+}
+
+TEST_F(TLSSessionCacheTest, EvictsTheLeastRecentlyUsedSession)
+{
+  TLSSessionCache& cache = attach(2, 1);
+  TLSTestContext::Result oldest = connect();
+  TLSTestContext::Result middle = connect();
+  ASSERT_TRUE(oldest.connected && middle.connected);
+
+  // Using the oldest session makes the middle one the least recently used.
+  ASSERT_TRUE(connect(oldest.session.get()).reused);
+  ASSERT_TRUE(connect().connected);
+  EXPECT_EQ(2u, cache.getStatistics().size);
+  EXPECT_EQ(1u, cache.getStatistics().evictions);
+
+  EXPECT_TRUE(connect(oldest.session.get()).reused);
+  EXPECT_FALSE(connect(middle.session.get()).reused);
+}
+
+TEST_F(TLSSessionCacheTest, ExpiresSessionsAfterTheContextTimeout)
+{
+  TLSSessionCache& cache = attach(16, 4);
+  SSL_CTX_set_timeout(server.get(), 1);
+  TLSTestContext::Result first = connect();
+  ASSERT_TRUE(first.connected);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds{1100});
+  EXPECT_FALSE(connect(first.session.get()).reused);
+  EXPECT_EQ(0u, cache.getStatistics().hits);
+  EXPECT_EQ(1u, cache.getStatistics().misses);
+}
+
+///////////////////////////////////////////////////////////////////////////////
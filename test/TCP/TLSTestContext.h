@@ -0,0 +1,262 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSTestContext.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     TLS contexts with a self-signed certificate, and
+//                  handshakes between them over a pair of memory BIOs, for
+//                  testing the TLS classes without sockets.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_TLSTESTCONTEXT__
+#define __ET_TLSTESTCONTEXT__
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <errno.h>
+#include <unistd.h>
+
+#include <openssl/bio.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+
+namespace TLSTestContext
+{
+  // A P-256 key and a certificate for "localhost" that it signs. Generated
+  // once per process, since the tests do not care which key they use.
+  struct Credentials
+  {
+    std::shared_ptr<EVP_PKEY> key;
+    std::shared_ptr<X509> certificate;
+  };
+
+  inline const Credentials& getCredentials()
+  {
+    static const Credentials credentials = []()
+      {
+        std::unique_ptr<EVP_PKEY_CTX, void(*)(EVP_PKEY_CTX*)> context
+          {EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr), EVP_PKEY_CTX_free};
+        EVP_PKEY* rawKey = nullptr;
+        if (!context || 0 >= EVP_PKEY_keygen_init(context.get())
+            || 0 >= EVP_PKEY_CTX_set_ec_paramgen_curve_nid
+            (context.get(), NID_X9_62_prime256v1)
+            || 0 >= EVP_PKEY_keygen(context.get(), &rawKey))
+          {
+            throw std::runtime_error{"TLSTestContext: keygen failed"};
+          }
+        std::shared_ptr<EVP_PKEY> key{rawKey, EVP_PKEY_free};
+
+        std::shared_ptr<X509> certificate{X509_new(), X509_free};
+        X509_set_version(certificate.get(), 2);
+        ASN1_INTEGER_set(X509_get_serialNumber(certificate.get()), 1);
+        X509_gmtime_adj(X509_getm_notBefore(certificate.get()), 0);
+        X509_gmtime_adj(X509_getm_notAfter(certificate.get()), 24 * 60 * 60);
+        X509_set_pubkey(certificate.get(), key.get());
+        X509_NAME* name = X509_get_subject_name(certificate.get());
+        X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+                                   reinterpret_cast<const unsigned char*>
+                                   ("localhost"), -1, -1, 0);
+        X509_set_issuer_name(certificate.get(), name);
+        if (0 >= X509_sign(certificate.get(), key.get(), EVP_sha256()))
+          {
+            throw std::runtime_error{"TLSTestContext: signing failed"};
+          }
+        return Credentials{key, certificate};
+      }();
+    return credentials;
+  }
+
+  // The credentials, written to files for a TLSListener to load, and
+  // removed on destruction.
+  class CredentialFiles
+  {
+  public:
+    CredentialFiles()
+    {
+      char directory[] = "/tmp/NetworkingTests.XXXXXX";
+      if (nullptr == ::mkdtemp(directory))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+      m_directory = directory;
+      m_certificateFile = m_directory + "/cert.pem";
+      m_privateKeyFile = m_directory + "/key.pem";
+
+      const Credentials& credentials = getCredentials();
+      FILE* certificate = std::fopen(m_certificateFile.c_str(), "w");
+      FILE* key = std::fopen(m_privateKeyFile.c_str(), "w");
+      const bool written = nullptr != certificate && nullptr != key
+        && 0 < PEM_write_X509(certificate, credentials.certificate.get())
+        && 0 < PEM_write_PrivateKey(key, credentials.key.get(), nullptr,
+                                    nullptr, 0, nullptr, nullptr);
+      if (nullptr != certificate)
+        {
+          std::fclose(certificate);
+        }
+      if (nullptr != key)
+        {
+          std::fclose(key);
+        }
+      if (!written)
+        {
+          remove();
+          throw std::runtime_error{"TLSTestContext: could not write the"
+              " credentials"};
+        }
+    }
+
+    CredentialFiles(const CredentialFiles&) = delete;
+    CredentialFiles& operator=(const CredentialFiles&) = delete;
+    ~CredentialFiles()
+    {
+      remove();
+    }
+
+    const std::string& getCertificateFile() const
+    {
+      return m_certificateFile;
+    }
+
+    const std::string& getPrivateKeyFile() const
+    {
+      return m_privateKeyFile;
+    }
+
+  private:
+    void remove()
+    {
+      ::unlink(m_certificateFile.c_str());
+      ::unlink(m_privateKeyFile.c_str());
+      ::rmdir(m_directory.c_str());
+    }
+
+    std::string m_directory;
+    std::string m_certificateFile;
+    std::string m_privateKeyFile;
+  };
+
+  inline std::shared_ptr<SSL_CTX> makeServerContext()
+  {
+    std::shared_ptr<SSL_CTX> context{SSL_CTX_new(TLS_server_method()),
+                                     SSL_CTX_free};
+    const Credentials& credentials = getCredentials();
+    if (!context
+        || 0 >= SSL_CTX_use_certificate(context.get(),
+                                        credentials.certificate.get())
+        || 0 >= SSL_CTX_use_PrivateKey(context.get(),
+                                       credentials.key.get()))
+      {
+        throw std::runtime_error{"TLSTestContext: server context failed"};
+      }
+    return context;
+  }
+
+  // Does not verify the server's certificate.
+  inline std::shared_ptr<SSL_CTX> makeClientContext()
+  {
+    std::shared_ptr<SSL_CTX> context{SSL_CTX_new(TLS_client_method()),
+                                     SSL_CTX_free};
+    if (!context)
+      {
+        throw std::runtime_error{"TLSTestContext: client context failed"};
+      }
+    return context;
+  }
+
+  // Both ends of a connection over a pair of memory BIOs.
+  struct Connection
+  {
+    std::unique_ptr<SSL, void(*)(SSL*)> client{nullptr, SSL_free};
+    std::unique_ptr<SSL, void(*)(SSL*)> server{nullptr, SSL_free};
+    bool connected = false;
+  };
+
+  // Runs a handshake between a client of clientContext, offering session
+  // (if not null), and a server of serverContext.
+  inline Connection connect(SSL_CTX* clientContext, SSL_CTX* serverContext,
+                            SSL_SESSION* session = nullptr)
+  {
+    Connection connection;
+    connection.client.reset(SSL_new(clientContext));
+    connection.server.reset(SSL_new(serverContext));
+    SSL* client = connection.client.get();
+    SSL* server = connection.server.get();
+    BIO* clientBio = nullptr;
+    BIO* serverBio = nullptr;
+    if (!client || !server
+        || 0 >= BIO_new_bio_pair(&clientBio, 0, &serverBio, 0))
+      {
+        throw std::runtime_error{"TLSTestContext: could not create SSLs"};
+      }
+    SSL_set_bio(client, clientBio, clientBio);
+    SSL_set_bio(server, serverBio, serverBio);
+    SSL_set_connect_state(client);
+    SSL_set_accept_state(server);
+    if (nullptr != session)
+      {
+        SSL_set_session(client, session);
+      }
+
+    bool clientDone = false;
+    bool serverDone = false;
+    for (int i = 0; i < 32 && !(clientDone && serverDone); ++i)
+      {
+        clientDone = clientDone || 0 < SSL_do_handshake(client);
+        serverDone = serverDone || 0 < SSL_do_handshake(server);
+      }
+    connection.connected = clientDone && serverDone;
+    ERR_clear_error();
+    return connection;
+  }
+
+  struct Result
+  {
+    bool connected;
+    bool reused;
+    // The client's session, to resume next time (null if not connected).
+    std::shared_ptr<SSL_SESSION> session;
+  };
+
+  // As connect(), after which the client reads a byte from the server, so
+  // that TLS 1.3 tickets have arrived when its session is taken.
+  inline Result handshake(SSL_CTX* clientContext, SSL_CTX* serverContext,
+                          SSL_SESSION* session = nullptr)
+  {
+    Connection connection = connect(clientContext, serverContext, session);
+    SSL* client = connection.client.get();
+    SSL* server = connection.server.get();
+    Result result{false, false, nullptr};
+    const char byte = 0;
+    char received;
+    if (connection.connected
+        && 0 < SSL_write(server, &byte, sizeof(byte))
+        && 0 < SSL_read(client, &received, sizeof(received)))
+      {
+        result.connected = true;
+        result.reused = SSL_session_reused(client);
+        result.session = std::shared_ptr<SSL_SESSION>
+          {SSL_get1_session(client), SSL_SESSION_free};
+        // A session whose connection was not shut down cannot be resumed.
+        SSL_shutdown(client);
+        SSL_shutdown(server);
+      }
+    ERR_clear_error();
+    return result;
+  }
+};
+
+#endif // __ET_TLSTESTCONTEXT__
+
+///////////////////////////////////////////////////////////////////////////////
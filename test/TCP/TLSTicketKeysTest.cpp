@@ -0,0 +1,94 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TLSTicketKeysTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the rotating TLS session ticket keys.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include "TLSTestContext.h"
+
+#include <Networking/TCP/TLSTicketKeys.h>
+
+#include <chrono>
+#include <memory>
+
+#include <openssl/ssl.h>
+
+using namespace Networking::TCP;
+
+namespace
+{
+  class TLSTicketKeysTest : public ::testing::Test
+  {
+  protected:
+    // Without a cache, only a ticket can resume a session.
+    TLSTicketKeys& attach()
+    {
+      SSL_CTX_set_session_cache_mode(server.get(), SSL_SESS_CACHE_OFF);
+      return TLSTicketKeys::attach(server.get(), std::chrono::hours{1});
+    }
+
+    TLSTestContext::Result connect(SSL_SESSION* session = nullptr)
+    {
+      return TLSTestContext::handshake(client.get(), server.get(), session);
+    }
+
+    std::shared_ptr<SSL_CTX> server = TLSTestContext::makeServerContext();
+    std::shared_ptr<SSL_CTX> client = TLSTestContext::makeClientContext();
+  };
+};
+
+TEST_F(TLSTicketKeysTest, AcceptsTicketsUnderTheCurrentKey)
+{
+  TLSTicketKeys& keys = attach();
+  TLSTestContext::Result first = connect();
+  ASSERT_TRUE(first.connected);
+  EXPECT_FALSE(first.reused);
+  EXPECT_LT(0u, keys.getStatistics().issued);
+
+  EXPECT_TRUE(connect(first.session.get()).reused);
+  EXPECT_EQ(1u, keys.getStatistics().accepted);
+  EXPECT_EQ(0u, keys.getStatistics().renewed);
+}
+
+TEST_F(TLSTicketKeysTest, RenewsTicketsUnderThePreviousKey)
+{
+  TLSTicketKeys& keys = attach();
+  TLSTestContext::Result first = connect();
+  ASSERT_TRUE(first.connected);
+
+  const auto rotations = keys.getStatistics().rotations;
+  keys.rotate();
+  EXPECT_EQ(rotations + 1, keys.getStatistics().rotations);
+
+  TLSTestContext::Result renewed = connect(first.session.get());
+  EXPECT_TRUE(renewed.reused);
+  EXPECT_EQ(1u, keys.getStatistics().renewed);
+
+  // The renewed ticket is under the current key.
+  EXPECT_TRUE(connect(renewed.session.get()).reused);
+  EXPECT_EQ(1u, keys.getStatistics().accepted);
+}
+
+TEST_F(TLSTicketKeysTest, RejectsTicketsTwoRotationsOld)
+{
+  TLSTicketKeys& keys = attach();
+  TLSTestContext::Result first = connect();
+  ASSERT_TRUE(first.connected);
+
+  keys.rotate();
+  keys.rotate();
+  TLSTestContext::Result result = connect(first.session.get());
+  ASSERT_TRUE(result.connected);
+  EXPECT_FALSE(result.reused);
+  EXPECT_EQ(1u, keys.getStatistics().rejected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
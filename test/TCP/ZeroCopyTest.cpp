@@ -0,0 +1,212 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            ZeroCopyTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of sendFile() and splice(), over socket pairs.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include "TLSTestContext.h"
+
+#include <Networking/TCP/ZeroCopy.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <future>
+#include <memory>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <openssl/ssl.h>
+
+using namespace Networking::TCP;
+
+namespace
+{
+  // A connected pair of stream sockets, closed on destruction.
+  struct SocketPair
+  {
+    explicit SocketPair(int flags = 0)
+    {
+      if (0 != ::socketpair(AF_UNIX, SOCK_STREAM | flags, 0, fds))
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+    }
+
+    ~SocketPair()
+    {
+      ::close(fds[0]);
+      ::close(fds[1]);
+    }
+
+    int fds[2];
+  };
+
+  // A temporary file, holding more than a socket buffer of data.
+  struct TemporaryFile
+  {
+    TemporaryFile()
+      : contents(1 << 20, '\0')
+    {
+      for (std::size_t i = 0; i < contents.size(); ++i)
+        {
+          contents[i] = static_cast<char>('a' + i % 26);
+        }
+
+      char path[] = "/tmp/ZeroCopyTest.XXXXXX";
+      fd = ::mkstemp(path);
+      if (-1 == fd)
+        {
+          throw std::system_error{errno, std::generic_category()};
+        }
+      ::unlink(path);
+      if (static_cast<ssize_t>(contents.size())
+          != ::write(fd, contents.data(), contents.size()))
+        {
+          ::close(fd);
+          throw std::system_error{errno, std::generic_category()};
+        }
+    }
+
+    ~TemporaryFile()
+    {
+      ::close(fd);
+    }
+
+    std::string contents;
+    int fd;
+  };
+
+  // Reads fd to the end of the stream, on another thread.
+  std::future<std::string> readAll(int fd)
+  {
+    return std::async(std::launch::async, [fd]()
+      {
+        std::string data;
+        char buffer[4096];
+        ssize_t length = 0;
+        while (0 < (length = ::read(fd, buffer, sizeof(buffer)))
+               || (-1 == length && EAGAIN == errno))
+          {
+            if (0 < length)
+              {
+                data.append(buffer, length);
+              }
+          }
+        return data;
+      });
+  }
+};
+
+TEST(ZeroCopyTest, SendsPartOfAFile)
+{
+  TemporaryFile file;
+  SocketPair sockets;
+  auto received = readAll(sockets.fds[1]);
+
+  EXPECT_EQ(500000u, sendFile(sockets.fds[0], file.fd, 100, 500000));
+  ::shutdown(sockets.fds[0], SHUT_WR);
+  EXPECT_EQ(file.contents.substr(100, 500000), received.get());
+}
+
+TEST(ZeroCopyTest, SendsUntilTheEndOfTheFile)
+{
+  TemporaryFile file;
+  SocketPair sockets;
+  auto received = readAll(sockets.fds[1]);
+
+  const std::size_t offset = file.contents.size() - 1000;
+  EXPECT_EQ(1000u, sendFile(sockets.fds[0], file.fd, offset, 5000));
+  ::shutdown(sockets.fds[0], SHUT_WR);
+  EXPECT_EQ(file.contents.substr(offset), received.get());
+}
+
+TEST(ZeroCopyTest, WaitsForANonBlockingSocketToDrain)
+{
+  TemporaryFile file;
+  SocketPair sockets{SOCK_NONBLOCK};
+  auto received = readAll(sockets.fds[1]);
+
+  EXPECT_EQ(file.contents.size(),
+            sendFile(sockets.fds[0], file.fd, 0, file.contents.size()));
+  ::shutdown(sockets.fds[0], SHUT_WR);
+  EXPECT_EQ(file.contents, received.get());
+}
+
+TEST(ZeroCopyTest, SplicesBetweenSockets)
+{
+  SocketPair source;
+  SocketPair destination;
+  auto received = readAll(destination.fds[1]);
+
+  ASSERT_EQ(5, ::write(source.fds[1], "hello", 5));
+  ::shutdown(source.fds[1], SHUT_WR);
+  // A blocking source is read until the end of the stream.
+  EXPECT_EQ(5u, splice(source.fds[0], destination.fds[0], 1024));
+  ::shutdown(destination.fds[0], SHUT_WR);
+  EXPECT_EQ("hello", received.get());
+}
+
+TEST(ZeroCopyTest, ReturnsEarlyFromANonBlockingSource)
+{
+  SocketPair source{SOCK_NONBLOCK};
+  SocketPair destination;
+
+  ASSERT_EQ(5, ::write(source.fds[1], "hello", 5));
+  EXPECT_EQ(5u, splice(source.fds[0], destination.fds[0], 1024));
+  char buffer[8];
+  EXPECT_EQ(5, ::read(destination.fds[1], buffer, sizeof(buffer)));
+}
+
+TEST(ZeroCopyTest, SendsAFileOverTLS)
+{
+  TemporaryFile file;
+  SocketPair sockets;
+  std::shared_ptr<SSL_CTX> serverContext
+    = TLSTestContext::makeServerContext();
+  std::shared_ptr<SSL_CTX> clientContext
+    = TLSTestContext::makeClientContext();
+  std::unique_ptr<SSL, void(*)(SSL*)> server{SSL_new(serverContext.get()),
+                                             SSL_free};
+  std::unique_ptr<SSL, void(*)(SSL*)> client{SSL_new(clientContext.get()),
+                                             SSL_free};
+  SSL_set_fd(server.get(), sockets.fds[0]);
+  SSL_set_fd(client.get(), sockets.fds[1]);
+
+  auto received = std::async(std::launch::async, [&client]()
+    {
+      std::string data;
+      if (0 >= SSL_connect(client.get()))
+        {
+          return data;
+        }
+      char buffer[16384];
+      int length = 0;
+      while (0 < (length = SSL_read(client.get(), buffer, sizeof(buffer))))
+        {
+          data.append(buffer, length);
+        }
+      return data;
+    });
+  ASSERT_LT(0, SSL_accept(server.get()));
+
+  // Without kernel TLS, the file goes through SSL_write().
+  EXPECT_FALSE(isKernelTLSSend(server.get()));
+  EXPECT_EQ(file.contents.size(),
+            sendFile(server.get(), file.fd, 0, file.contents.size()));
+  SSL_shutdown(server.get());
+  EXPECT_EQ(file.contents, received.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
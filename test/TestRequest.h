@@ -0,0 +1,61 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TestRequest.h
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     A request that runs a function, for testing delegators
+//                  without a listener.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#ifndef __ET_TESTREQUEST__
+#define __ET_TESTREQUEST__
+
+#include <Networking/Interfaces/IRequest.h>
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+class TestRequest : public Networking::Interfaces::IRequest
+{
+public:
+  // destroyed is called when the request is destroyed, whether or not it
+  // was handled.
+  TestRequest(std::function<void()> handler,
+              std::function<void()> destroyed = nullptr)
+    : m_handler{std::move(handler)}, m_destroyed{std::move(destroyed)}
+  {}
+
+  ~TestRequest()
+  {
+    if (m_destroyed)
+      {
+        m_destroyed();
+      }
+  }
+
+  virtual void handle() override
+  {
+    m_handler();
+  }
+
+  static std::unique_ptr<Networking::Interfaces::IRequest>
+  make(std::function<void()> handler,
+       std::function<void()> destroyed = nullptr)
+  {
+    return std::make_unique<TestRequest>(std::move(handler),
+                                         std::move(destroyed));
+  }
+
+private:
+  std::function<void()> m_handler;
+  std::function<void()> m_destroyed;
+};
+
+#endif // __ET_TESTREQUEST__
+
+///////////////////////////////////////////////////////////////////////////////
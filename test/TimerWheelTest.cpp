@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////
+// NAME:            TimerWheelTest.cpp
+//
+// AUTHOR:          Ethan D. Twardy <edtwardy@mtu.edu>
+//
+// DESCRIPTION:     Tests of the TimerWheel, with the time given to
+//                  advance() rather than read from the clock.
+//
+// CREATED:         10/18/2026
+//
+// LAST EDITED:     10/18/2026
+////
+
+#include "gtest/gtest.h"
+
+#include <Networking/TimerWheel.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Networking;
+using std::chrono::milliseconds;
+
+namespace
+{
+  const milliseconds TICK{1};
+};
+
+TEST(TimerWheelTest, FiresOnceTheDeadlineHasPassed)
+{
+  TimerWheel wheel{TICK};
+  const TimerWheel::Clock::time_point start = TimerWheel::Clock::now();
+  unsigned int called = 0;
+  TimerWheel::Timer timer{[&called]() { ++called; }};
+
+  wheel.schedule(timer, start + milliseconds{5});
+  EXPECT_TRUE(timer.isScheduled());
+  EXPECT_EQ(1u, wheel.size());
+  EXPECT_EQ(0u, wheel.advance(start + milliseconds{4}));
+  EXPECT_EQ(1u, wheel.advance(start + milliseconds{6}));
+  EXPECT_EQ(0u, wheel.advance(start + milliseconds{100}));
+  EXPECT_EQ(1u, called);
+  EXPECT_FALSE(timer.isScheduled());
+  EXPECT_EQ(0u, wheel.size());
+}
+
+// Deadlines on each level of the wheel, and one beyond its reach (64^4
+// ticks), which must cascade down to the first level to be called.
+TEST(TimerWheelTest, CascadesFromEveryLevel)
+{
+  TimerWheel wheel{TICK};
+  const TimerWheel::Clock::time_point start = TimerWheel::Clock::now();
+  const std::vector<milliseconds> delays{milliseconds{3}, milliseconds{100},
+      milliseconds{5000}, milliseconds{300000}, milliseconds{20000000}};
+
+  std::vector<milliseconds> fired;
+  std::vector<std::unique_ptr<TimerWheel::Timer>> timers;
+  for (auto delay = delays.rbegin(); delays.rend() != delay; ++delay)
+    {
+      timers.push_back(std::make_unique<TimerWheel::Timer>
+                       ([&fired, delay = *delay]()
+                        {
+                          fired.push_back(delay);
+                        }));
+      wheel.schedule(*timers.back(), start + *delay);
+    }
+
+  for (std::size_t i = 0; i < delays.size(); ++i)
+    {
+      EXPECT_EQ(0u, wheel.advance(start + delays[i] - TICK));
+      EXPECT_EQ(i, fired.size());
+      EXPECT_EQ(1u, wheel.advance(start + delays[i] + TICK));
+      ASSERT_EQ(i + 1, fired.size());
+      EXPECT_EQ(delays[i], fired.back());
+    }
+  EXPECT_EQ(0u, wheel.size());
+}
+
+TEST(TimerWheelTest, FiresWithinATickWhenAdvancedTickByTick)
+{
+  TimerWheel wheel{TICK};
+  const TimerWheel::Clock::time_point start = TimerWheel::Clock::now();
+  const milliseconds delay{100};
+  milliseconds firedAt{-1};
+  milliseconds now{0};
+  TimerWheel::Timer timer{[&firedAt, &now]() { firedAt = now; }};
+
+  wheel.schedule(timer, start + delay);
+  for (; now < milliseconds{200} && timer.isScheduled(); now += TICK)
+    {
+      wheel.advance(start + now);
+    }
+  EXPECT_LE(delay, firedAt);
+  EXPECT_GE(delay + TICK, firedAt);
+}
+
+TEST(TimerWheelTest, NextExpiryLeadsToTheDeadline)
+{
+  TimerWheel wheel{TICK};
+  EXPECT_EQ(TimerWheel::Clock::time_point::max(), wheel.getNextExpiry());
+
+  const TimerWheel::Clock::time_point deadline = TimerWheel::Clock::now()
+    + milliseconds{5000};
+  TimerWheel::Clock::time_point firedAt;
+  TimerWheel::Clock::time_point now;
+  TimerWheel::Timer timer{[&firedAt, &now]() { firedAt = now; }};
+  wheel.schedule(timer, deadline);
+
+  // Waking only at each expiry (as the EventLoop does) must not miss it,
+  // nor be late by more than the tick the deadline is rounded up to.
+  unsigned int wakes = 0;
+  while (timer.isScheduled())
+    {
+      now = wheel.getNextExpiry();
+      ASSERT_GE(deadline + TICK, now);
+      wheel.advance(now);
+      ASSERT_GT(16u, ++wakes);
+    }
+  EXPECT_LE(deadline, firedAt);
+  EXPECT_EQ(TimerWheel::Clock::time_point::max(), wheel.getNextExpiry());
+}
+
+TEST(TimerWheelTest, CallbackMayScheduleItsTimerAgain)
+{
+  TimerWheel wheel{TICK};
+  const TimerWheel::Clock::time_point start = TimerWheel::Clock::now();
+  TimerWheel::Clock::time_point deadline = start + milliseconds{10};
+  std::unique_ptr<TimerWheel::Timer> timer;
+  timer = std::make_unique<TimerWheel::Timer>([&]()
+    {
+      deadline += milliseconds{10};
+      wheel.schedule(*timer, deadline);
+    });
+
+  wheel.schedule(*timer, deadline);
+  EXPECT_EQ(10u, wheel.advance(start + milliseconds{105}));
+  EXPECT_TRUE(timer->isScheduled());
+}
+
+TEST(TimerWheelTest, CancelledTimersAreNotCalled)
+{
+  TimerWheel wheel{TICK};
+  const TimerWheel::Clock::time_point start = TimerWheel::Clock::now();
+  unsigned int called = 0;
+  TimerWheel::Timer cancelled{[&called]() { ++called; }};
+  wheel.schedule(cancelled, start + milliseconds{5});
+  {
+    TimerWheel::Timer destroyed{[&called]() { ++called; }};
+    wheel.schedule(destroyed, start + milliseconds{5});
+    EXPECT_EQ(2u, wheel.size());
+  }
+
+  wheel.cancel(cancelled);
+  EXPECT_FALSE(cancelled.isScheduled());
+  EXPECT_EQ(0u, wheel.size());
+  EXPECT_EQ(0u, wheel.advance(start + milliseconds{10}));
+  EXPECT_EQ(0u, called);
+}
+
+TEST(TimerWheelTest, LogsCallbacksThatThrow)
+{
+  std::vector<std::string> log;
+  TimerWheel wheel{TICK, [&log](const std::string& message)
+                         {
+                           log.push_back(message);
+                         }};
+  const TimerWheel::Clock::time_point start = TimerWheel::Clock::now();
+  bool called = false;
+  TimerWheel::Timer throws{[]() { throw std::runtime_error{"expected"}; }};
+  TimerWheel::Timer other{[&called]() { called = true; }};
+
+  wheel.schedule(throws, start + milliseconds{5});
+  wheel.schedule(other, start + milliseconds{5});
+  EXPECT_EQ(2u, wheel.advance(start + milliseconds{10}));
+  EXPECT_TRUE(called);
+  ASSERT_EQ(1u, log.size());
+  EXPECT_NE(std::string::npos, log.front().find("expected"));
+}
+
+///////////////////////////////////////////////////////////////////////////////